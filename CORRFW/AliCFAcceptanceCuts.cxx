@@ -28,7 +28,6 @@
 #include "TH1F.h"
 #include "TH2F.h"
 #include "TList.h"
-#include "TBits.h"
 
 ClassImp(AliCFAcceptanceCuts)
 
@@ -43,7 +42,7 @@ AliCFAcceptanceCuts::AliCFAcceptanceCuts() :
   fMinNHitMUON(0),
   fhCutStatistics(0x0),
   fhCutCorrelation(0x0),
-  fBitmap(new TBits(0))
+  fBitmap(0)
 {
   //
   //ctor
@@ -62,7 +61,7 @@ AliCFAcceptanceCuts::AliCFAcceptanceCuts(const Char_t* name, const Char_t* title
   fMinNHitMUON(0),
   fhCutStatistics(0x0),
   fhCutCorrelation(0x0),
-  fBitmap(new TBits(0))
+  fBitmap(0)
 {
   //
   //ctor
@@ -122,8 +121,7 @@ Bool_t AliCFAcceptanceCuts::IsSelected(TObject *obj) {
 
   if (fIsQAOn) FillHistograms(obj,kFALSE);
 
-  for (UInt_t icut=0; icut<fBitmap->GetNbits(); icut++)
-    if (!fBitmap->TestBitNumber(icut)) return kFALSE ;
+  if (fBitmap != AllCutsMask(kNCuts)) return kFALSE ;
   
   if (fIsQAOn) FillHistograms(obj,kTRUE);
   return kTRUE;
@@ -136,7 +134,7 @@ void AliCFAcceptanceCuts::SelectionBitMap(TObject* obj) {
   // 'obj' must be an AliMCParticle
   //
 
-  for (UInt_t i=0; i<kNCuts; i++) fBitmap->SetBitNumber(i,kFALSE);
+  fBitmap=0;
 
   if (!obj) return;
   TString className(obj->ClassName());
@@ -166,15 +164,15 @@ void AliCFAcceptanceCuts::SelectionBitMap(TObject* obj) {
   
   Int_t iCutBit = 0;
 
-  if (nHitsITS  >= fMinNHitITS  ) fBitmap->SetBitNumber(iCutBit,kTRUE);
+  if (nHitsITS  >= fMinNHitITS  ) SetCutBit(fBitmap,iCutBit);
   iCutBit++;
-  if (nHitsTPC  >= fMinNHitTPC  ) fBitmap->SetBitNumber(iCutBit,kTRUE);
+  if (nHitsTPC  >= fMinNHitTPC  ) SetCutBit(fBitmap,iCutBit);
   iCutBit++;
-  if (nHitsTRD  >= fMinNHitTRD  ) fBitmap->SetBitNumber(iCutBit,kTRUE);
+  if (nHitsTRD  >= fMinNHitTRD  ) SetCutBit(fBitmap,iCutBit);
   iCutBit++;
-  if (nHitsTOF  >= fMinNHitTOF  ) fBitmap->SetBitNumber(iCutBit,kTRUE);
+  if (nHitsTOF  >= fMinNHitTOF  ) SetCutBit(fBitmap,iCutBit);
   iCutBit++;
-  if (nHitsMUON  >= fMinNHitMUON) fBitmap->SetBitNumber(iCutBit,kTRUE);
+  if (nHitsMUON  >= fMinNHitMUON) SetCutBit(fBitmap,iCutBit);
 }
 
 
@@ -291,12 +289,12 @@ void AliCFAcceptanceCuts::FillHistograms(TObject* obj, Bool_t afterCuts)
   if (afterCuts) return;
 
   // Number of single cuts in this class
-  UInt_t ncuts = fBitmap->GetNbits();
+  UInt_t ncuts = kNCuts;
   for(UInt_t bit=0; bit<ncuts;bit++) {
-    if (!fBitmap->TestBitNumber(bit)) {
+    if (!TestCutBit(fBitmap,bit)) {
       fhCutStatistics->Fill(bit+1);
       for (UInt_t bit2=bit; bit2<ncuts;bit2++) {
-        if (!fBitmap->TestBitNumber(bit2)) 
+        if (!TestCutBit(fBitmap,bit2)) 
           fhCutCorrelation->Fill(bit+1,bit2+1);
       }
     }
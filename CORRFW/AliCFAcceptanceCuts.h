@@ -32,7 +32,6 @@
 class AliMCEvent;
 class TH1F ;
 class TH2F ;
-class TBits;
 
 class AliCFAcceptanceCuts : public AliCFCutBase
 {
@@ -73,13 +72,13 @@ class AliCFAcceptanceCuts : public AliCFCutBase
   TH1F*  fhCutStatistics;		// Histogram: statistics of what cuts the tracks did not survive
   TH2F*  fhCutCorrelation;		// Histogram: 2d statistics plot
   TH1F*  fhQA[kNCuts][kNStepQA];        // QA Histograms
-  TBits* fBitmap ; 			// stores single selection decisions
+  ULong64_t fBitmap ;                //! stores single selection decisions (bit i = cut i passed)
   void SelectionBitMap(TObject* obj);
   void FillHistograms(TObject* obj, Bool_t afterCuts);
   void AddQAHistograms(TList *qaList) ;
   void DefineHistograms();
 
-  ClassDef(AliCFAcceptanceCuts,1);
+  ClassDef(AliCFAcceptanceCuts,2);
 };
 
 #endif
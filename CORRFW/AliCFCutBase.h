@@ -21,7 +21,6 @@
 // silvia.Arcelli@cern.ch
 
 #include <AliAnalysisCuts.h>
-class TBits;
 class TList;
 //___________________________________________________________________________
 class AliCFCutBase : public AliAnalysisCuts
@@ -40,6 +39,13 @@ class AliCFCutBase : public AliAnalysisCuts
   Bool_t fIsQAOn;//qa checking on/off
   virtual void AddQAHistograms(TList*) {;}; //QA Histos
 
+  //decisions of the single cuts of the derived classes, bit i = single cut i passed (at most 64 single cuts)
+  static ULong64_t AllCutsMask(UInt_t ncuts) {return ncuts>=64 ? ~((ULong64_t)0) : (((ULong64_t)1)<<ncuts)-1;}
+  static Bool_t    TestCutBit(ULong64_t bitmap, UInt_t bit) {return (bitmap>>bit)&1;}
+  static void      SetCutBit(ULong64_t &bitmap, UInt_t bit, Bool_t value=kTRUE) {
+    if (value) bitmap |= ((ULong64_t)1)<<bit; else bitmap &= ~(((ULong64_t)1)<<bit);
+  }
+
   ClassDef(AliCFCutBase, 1); // Base class for Correction Framework Cuts
 };
  
@@ -105,14 +105,7 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
     return kTRUE;
   }
   if(!fPartCutList[isel])return kTRUE;
-  TObjArrayIter iter(fPartCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
-  }
-  return kTRUE;
+  return CheckCuts(fPartCutList[isel],obj,CutsMask(fPartCutList[isel],selcuts));
 }
 
 //_____________________________________________________________________________
@@ -126,12 +119,94 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
       return kTRUE;
   }
   if(!fEvtCutList[isel])return kTRUE;
-  TObjArrayIter iter(fEvtCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+  return CheckCuts(fEvtCutList[isel],obj,CutsMask(fEvtCutList[isel],selcuts));
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, ULong64_t cutsMask) const {
+  //
+  // check whether object obj passes the cuts of particle-level selection isel
+  // selected by cutsMask (see GetParticleCutsMask)
+  //
+
+  if(isel>=fNStepPart){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepPart));
+    return kTRUE;
+  }
+  if(!fPartCutList[isel])return kTRUE;
+  return CheckCuts(fPartCutList[isel],obj,cutsMask);
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, ULong64_t cutsMask) const{
+  //
+  // check whether object obj passes the cuts of event-level selection isel
+  // selected by cutsMask (see GetEventCutsMask)
+  //
+
+  if(isel>=fNStepEvt){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepEvt));
+      return kTRUE;
+  }
+  if(!fEvtCutList[isel])return kTRUE;
+  return CheckCuts(fEvtCutList[isel],obj,cutsMask);
+}
+
+//_____________________________________________________________________________
+ULong64_t AliCFManager::GetParticleCutsMask(Int_t isel, const TString &selcuts) const {
+  //
+  // mask of the cuts of particle-level selection isel whose name is in selcuts
+  //
+
+  if(isel>=fNStepPart || !fPartCutList || !fPartCutList[isel]) return ~((ULong64_t)0);
+  return CutsMask(fPartCutList[isel],selcuts);
+}
+
+//_____________________________________________________________________________
+ULong64_t AliCFManager::GetEventCutsMask(Int_t isel, const TString &selcuts) const {
+  //
+  // mask of the cuts of event-level selection isel whose name is in selcuts
+  //
+
+  if(isel>=fNStepEvt || !fEvtCutList || !fEvtCutList[isel]) return ~((ULong64_t)0);
+  return CutsMask(fEvtCutList[isel],selcuts);
+}
+
+//_____________________________________________________________________________
+ULong64_t AliCFManager::CutsMask(const TObjArray *cuts, const TString &selcuts) const {
+  //
+  // bit i is set if the i-th cut of the list is in selcuts; all the bits are set for "all",
+  // which also selects the cuts beyond the 64th one
+  //
+
+  if(selcuts.Contains("all")) return ~((ULong64_t)0);
+  ULong64_t mask = 0;
+  Int_t ncuts = cuts->GetEntriesFast();
+  for (Int_t icut=0; icut<ncuts; icut++) {
+    TObject *cut = cuts->UncheckedAt(icut);
+    if (!cut || !CompareStrings(cut->GetName(),selcuts)) continue;
+    if (icut>=64) {
+      AliError(Form("Cut %s is beyond the 64th cut of the list and cannot be selected by name",cut->GetName()));
+      continue;
+    }
+    mask |= ((ULong64_t)1)<<icut;
+  }
+  return mask;
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckCuts(const TObjArray *cuts, TObject *obj, ULong64_t cutsMask) {
+  //
+  // check the cuts of the list selected by cutsMask, in the order of the list
+  //
+
+  const Bool_t allCuts = (cutsMask == ~((ULong64_t)0));
+  Int_t ncuts = cuts->GetEntriesFast();
+  for (Int_t icut=0; icut<ncuts; icut++) {
+    AliCFCutBase *cut = (AliCFCutBase*)cuts->UncheckedAt(icut);
+    if (!cut) continue;
+    if (!allCuts && (icut>=64 || !((cutsMask>>icut)&1))) continue;
+    if (!cut->IsSelected(obj)) return kFALSE;
   }
   return kTRUE;
 }
@@ -116,6 +116,14 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //The selection string can be resolved once (e.g. in UserCreateOutputObjects) into a mask
+  //of the cuts of the list (bit i = i-th cut of the list), which is then used for each object
+  //without any string comparison
+  virtual ULong64_t GetEventCutsMask(Int_t isel, const TString &selcuts="all") const;
+  virtual ULong64_t GetParticleCutsMask(Int_t isel, const TString &selcuts="all") const;
+  virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, ULong64_t cutsMask) const;
+  virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, ULong64_t cutsMask) const;
+
  private:
   
   //number of steps
@@ -131,6 +139,8 @@ class AliCFManager : public TNamed
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
 
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
+  ULong64_t CutsMask(const TObjArray *cuts, const TString &selcuts) const;
+  static Bool_t CheckCuts(const TObjArray *cuts, TObject *obj, ULong64_t cutsMask);
 
   ClassDef(AliCFManager,2);
 };
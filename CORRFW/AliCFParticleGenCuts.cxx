@@ -31,7 +31,6 @@
 #include "AliStack.h"
 #include "TH1F.h"
 #include "TH2F.h"
-#include "TBits.h"
 #include "TList.h"
 #include "TArrayF.h"
 #include "TDecayChannel.h"
@@ -73,7 +72,7 @@ AliCFParticleGenCuts::AliCFParticleGenCuts() :
   fhCutStatistics(0x0),
   fhCutCorrelation(0x0),
   fCutValues(new TArrayF(kNCuts)),
-  fBitmap(new TBits(0))
+  fBitmap(0)
 {
   //
   //ctor
@@ -119,7 +118,7 @@ AliCFParticleGenCuts::AliCFParticleGenCuts(const Char_t* name, const Char_t* tit
   fhCutStatistics(0x0),
   fhCutCorrelation(0x0),
   fCutValues(new TArrayF(kNCuts)),
-  fBitmap(new TBits(0))
+  fBitmap(0)
 {
   //
   //ctor
@@ -165,7 +164,7 @@ AliCFParticleGenCuts::AliCFParticleGenCuts(const AliCFParticleGenCuts& c) :
   fhCutStatistics(new TH1F(*c.fhCutStatistics)),
   fhCutCorrelation(new TH2F(*c.fhCutCorrelation)),
   fCutValues(new TArrayF(*c.fCutValues)),
-  fBitmap(new TBits(*c.fBitmap))
+  fBitmap(c.fBitmap)
 {
   //
   //copy ctor
@@ -214,7 +213,7 @@ AliCFParticleGenCuts& AliCFParticleGenCuts::operator=(const AliCFParticleGenCuts
     fDecayRxyMax=c.fDecayRxyMax;
     fDecayChannel=c.fDecayChannel;
     fCutValues=new TArrayF(*c.fCutValues);
-    fBitmap=new TBits(*c.fBitmap);
+    fBitmap=c.fBitmap;
     
     if (fhCutStatistics)  fhCutStatistics =new TH1F(*c.fhCutStatistics) ;
     if (fhCutCorrelation) fhCutCorrelation=new TH2F(*c.fhCutCorrelation);
@@ -243,8 +242,7 @@ Bool_t AliCFParticleGenCuts::IsSelected(TObject* obj) {
 
   if (fIsQAOn) FillHistograms(obj,0);
 
-  for (UInt_t icut=0; icut<fBitmap->GetNbits();icut++)
-    if (!fBitmap->TestBitNumber(icut)) return kFALSE ; 
+  if (fBitmap != AllCutsMask(kNCuts)) return kFALSE ;
   
   if (fIsQAOn) FillHistograms(obj,1);
   return kTRUE;
@@ -258,8 +256,8 @@ void AliCFParticleGenCuts::SelectionBitMap(AliMCParticle* mcPart)
   // and store the information in a bitmap
   //
 
+  fBitmap=0;
   for (UInt_t i=0; i<kNCuts; i++) {
-    fBitmap->SetBitNumber(i,kFALSE);
     fCutValues->SetAt((Double32_t)0,i) ;
   }
 
@@ -379,47 +377,47 @@ void AliCFParticleGenCuts::SelectionBitMap(AliMCParticle* mcPart)
   
   // now array of cut is build, fill the bitmap consequently
   Int_t iCutBit = -1;
-  if ( fCutValues->At(++iCutBit) !=0 )              fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) !=0 )              fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) !=0 )              fBitmap->SetBitNumber(iCutBit,kTRUE);
+  if ( fCutValues->At(++iCutBit) !=0 )              SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) !=0 )              SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) !=0 )              SetCutBit(fBitmap,iCutBit);
 
   ++iCutBit;
   if ( (!fProdVtxRange2D && fCutValues->At(iCutBit) > fProdVtxXMin)
     || ( fProdVtxRange2D && (fProdVtxXMin>0 && fProdVtxYMin>0) && prodVtxXYmin >= 1)
     || ( fProdVtxRange2D && (fProdVtxXMin<=0 || fProdVtxYMin<=0) ) )
-   fBitmap->SetBitNumber(iCutBit,kTRUE);
+   SetCutBit(fBitmap,iCutBit);
 
   ++iCutBit;
   if ( (!fProdVtxRange2D && fCutValues->At(iCutBit) < fProdVtxXMax)
     || ( fProdVtxRange2D && (fProdVtxXMax>0 && fProdVtxYMax>0) && prodVtxXYmax <= 1)
     || ( fProdVtxRange2D && (fProdVtxXMax<=0 || fProdVtxYMax<=0) ) )
-  fBitmap->SetBitNumber(iCutBit,kTRUE);
+  SetCutBit(fBitmap,iCutBit);
 
   ++iCutBit;
   if ( (!fProdVtxRange2D && fCutValues->At(iCutBit) > fProdVtxYMin)
     || ( fProdVtxRange2D &&  (fProdVtxXMin>0 && fProdVtxYMin>0) && prodVtxXYmin >= 1)
     || ( fProdVtxRange2D &&  (fProdVtxXMin<=0 || fProdVtxYMin<=0) ) )
-  fBitmap->SetBitNumber(iCutBit,kTRUE);
+  SetCutBit(fBitmap,iCutBit);
 
   ++iCutBit;
   if ( (!fProdVtxRange2D && fCutValues->At(iCutBit) < fProdVtxYMax)
     || ( fProdVtxRange2D && (fProdVtxXMax>0 && fProdVtxYMax>0) && prodVtxXYmax <= 1)
     || ( fProdVtxRange2D && (fProdVtxXMax<=0 || fProdVtxYMax<=0) ) )
-  fBitmap->SetBitNumber(iCutBit,kTRUE);
-
-  if ( fCutValues->At(++iCutBit) > fProdVtxZMin)    fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fProdVtxZMax)    fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayVtxXMin)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayVtxXMax)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayVtxYMin)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayVtxYMax)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayVtxZMin)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayVtxZMax)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayLengthMin) fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayLengthMax) fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayRxyMin)    fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayRxyMax)    fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) != 0 )             fBitmap->SetBitNumber(iCutBit,kTRUE);
+  SetCutBit(fBitmap,iCutBit);
+
+  if ( fCutValues->At(++iCutBit) > fProdVtxZMin)    SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fProdVtxZMax)    SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayVtxXMin)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayVtxXMax)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayVtxYMin)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayVtxYMax)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayVtxZMin)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayVtxZMax)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayLengthMin) SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayLengthMax) SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayRxyMin)    SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayRxyMax)    SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) != 0 )             SetCutBit(fBitmap,iCutBit);
 }
 
 //__________________________________________________________________________________
@@ -430,8 +428,8 @@ void AliCFParticleGenCuts::SelectionBitMap(AliAODMCParticle* mcPart)
   // and store the information in a bitmap
   //
   
+  fBitmap=0;
   for (UInt_t i=0; i<kNCuts; i++) {
-    fBitmap->SetBitNumber(i,kFALSE);
     fCutValues->SetAt((Double32_t)0,i) ;
   }
 
@@ -557,47 +555,47 @@ void AliCFParticleGenCuts::SelectionBitMap(AliAODMCParticle* mcPart)
   
   // now array of cut is build, fill the bitmap consequently
   Int_t iCutBit = -1;
-  if ( fCutValues->At(++iCutBit) !=0 )              fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) !=0 )              fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) !=0 )              fBitmap->SetBitNumber(iCutBit,kTRUE);
+  if ( fCutValues->At(++iCutBit) !=0 )              SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) !=0 )              SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) !=0 )              SetCutBit(fBitmap,iCutBit);
 
   ++iCutBit;
   if ( (!fProdVtxRange2D && fCutValues->At(iCutBit) > fProdVtxXMin)
        || ( fProdVtxRange2D && (fProdVtxXMin>0 && fProdVtxYMin>0) && prodVtxXYmin >= 1)
        || ( fProdVtxRange2D && (fProdVtxXMin<=0 || fProdVtxYMin<=0) ) )
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   
   ++iCutBit;
   if ( (!fProdVtxRange2D && fCutValues->At(iCutBit) < fProdVtxXMax)
        || ( fProdVtxRange2D && (fProdVtxXMax>0 && fProdVtxYMax>0) && prodVtxXYmax <= 1)
        || ( fProdVtxRange2D && (fProdVtxXMax<=0 || fProdVtxYMax<=0) ) )
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   
   ++iCutBit;
   if ( (!fProdVtxRange2D && fCutValues->At(iCutBit) > fProdVtxYMin)
        || ( fProdVtxRange2D &&  (fProdVtxXMin>0 && fProdVtxYMin>0) && prodVtxXYmin >= 1)
        || ( fProdVtxRange2D &&  (fProdVtxXMin<=0 || fProdVtxYMin<=0) ) )
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   
   ++iCutBit;
   if ( (!fProdVtxRange2D && fCutValues->At(iCutBit) < fProdVtxYMax)
        || ( fProdVtxRange2D && (fProdVtxXMax>0 && fProdVtxYMax>0) && prodVtxXYmax <= 1)
        || ( fProdVtxRange2D && (fProdVtxXMax<=0 || fProdVtxYMax<=0) ) )
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   
-  if ( fCutValues->At(++iCutBit) > fProdVtxZMin)    fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fProdVtxZMax)    fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayVtxXMin)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayVtxXMax)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayVtxYMin)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayVtxYMax)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayVtxZMin)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayVtxZMax)   fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayLengthMin) fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayLengthMax) fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) > fDecayRxyMin)    fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) < fDecayRxyMax)    fBitmap->SetBitNumber(iCutBit,kTRUE);
-  if ( fCutValues->At(++iCutBit) != 0 )             fBitmap->SetBitNumber(iCutBit,kTRUE);
+  if ( fCutValues->At(++iCutBit) > fProdVtxZMin)    SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fProdVtxZMax)    SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayVtxXMin)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayVtxXMax)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayVtxYMin)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayVtxYMax)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayVtxZMin)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayVtxZMax)   SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayLengthMin) SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayLengthMax) SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) > fDecayRxyMin)    SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) < fDecayRxyMax)    SetCutBit(fBitmap,iCutBit);
+  if ( fCutValues->At(++iCutBit) != 0 )             SetCutBit(fBitmap,iCutBit);
 }
 
 
@@ -617,12 +615,12 @@ void AliCFParticleGenCuts::FillHistograms(TObject* /*obj*/, Bool_t afterCuts)
   if (afterCuts) return;
 
   // Number of single cuts in this class
-  UInt_t ncuts = fBitmap->GetNbits();
+  UInt_t ncuts = kNCuts;
   for(UInt_t bit=0; bit<ncuts;bit++) {
-    if (!fBitmap->TestBitNumber(bit)) {
+    if (!TestCutBit(fBitmap,bit)) {
       fhCutStatistics->Fill(bit+1);
       for (UInt_t bit2=bit; bit2<ncuts;bit2++) {
-	if (!fBitmap->TestBitNumber(bit2)) 
+	if (!TestCutBit(fBitmap,bit2)) 
 	  fhCutCorrelation->Fill(bit+1,bit2+1);
       }
     }
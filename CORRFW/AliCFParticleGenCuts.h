@@ -37,7 +37,6 @@ class AliStack;
 class TList;
 class TH1F;
 class TH2F;
-class TBits;
 class TArrayF;
 class TDecayChannel;
 class AliVParticle;
@@ -146,7 +145,7 @@ class AliCFParticleGenCuts : public AliCFCutBase
   TH1F*    fhQA[kNCuts][kNStepQA]; // QA Histograms
   TH2F*    fhProdVtxXY[2];	   // Histogram: production vertex in tranzverse plane
   TArrayF* fCutValues;             // array of cut values
-  TBits* fBitmap ;                 // stores single selection decisions
+  ULong64_t fBitmap ;                //! stores single selection decisions (bit i = cut i passed)
 
   void SelectionBitMap(AliMCParticle*    obj); // for MC got from Kinematics
   void SelectionBitMap(AliAODMCParticle* obj); // for MC got from AOD
@@ -154,7 +153,7 @@ class AliCFParticleGenCuts : public AliCFCutBase
   void AddQAHistograms(TList *qaList) ;
   void DefineHistograms();
 
-  ClassDef(AliCFParticleGenCuts,2);
+  ClassDef(AliCFParticleGenCuts,3);
 };
 
 #endif
@@ -51,7 +51,6 @@
 #include <TCanvas.h>
 #include <TDirectory.h>
 #include <TH2.h>
-#include <TBits.h>
 
 #include <AliESDtrack.h>
 #include <AliAODTrack.h>
@@ -83,7 +82,7 @@ AliCFTrackIsPrimaryCuts::AliCFTrackIsPrimaryCuts() :
   fAcceptKinkDaughters(0),
   fhCutStatistics(0),
   fhCutCorrelation(0),
-  fBitmap(0x0),
+  fBitmap(0),
   fhNBinsNSigma(0),
   fhNBinsRequireSigma(0),
   fhNBinsAcceptKink(0),
@@ -129,7 +128,7 @@ AliCFTrackIsPrimaryCuts::AliCFTrackIsPrimaryCuts(const Char_t* name, const Char_
   fAcceptKinkDaughters(0),
   fhCutStatistics(0),
   fhCutCorrelation(0),
-  fBitmap(0x0),
+  fBitmap(0),
   fhNBinsNSigma(0),
   fhNBinsRequireSigma(0),
   fhNBinsAcceptKink(0),
@@ -272,7 +271,6 @@ AliCFTrackIsPrimaryCuts::~AliCFTrackIsPrimaryCuts()
       if(fhQA[i][j]) 		delete fhQA[i][j];
   }
   if(fEvt) 			delete fEvt;
-  if(fBitmap) 			delete fBitmap;
   if(fhBinLimNSigma) 		delete fhBinLimNSigma;
   if(fhBinLimRequireSigma) 	delete fhBinLimRequireSigma;
   if(fhBinLimAcceptKink) 	delete fhBinLimAcceptKink;
@@ -327,7 +325,7 @@ void AliCFTrackIsPrimaryCuts::Initialise()
   }
   fhCutStatistics = 0;
   fhCutCorrelation = 0;
-  fBitmap=new TBits(0);
+  fBitmap=0;
 
   //set default bining for QA histograms
   SetHistogramBins(kCutNSigmaToVertex,100,0.,10.);
@@ -518,7 +516,7 @@ void AliCFTrackIsPrimaryCuts::SelectionBitMap(TObject* obj)
   //
 
   // bitmap stores the decision of each single cut
-  for(Int_t i=0; i<kNCuts; i++)fBitmap->SetBitNumber(i,kFALSE);
+  fBitmap=0;
 
   // check TObject and cast into ESDtrack
   if (!obj) return;
@@ -564,43 +562,43 @@ void AliCFTrackIsPrimaryCuts::SelectionBitMap(TObject* obj)
   Int_t iCutBit = 0;
 
   if (!dcaInfo || fDCAToVertex2D || (!fDCAToVertex2D && bxy >= fMinDCAToVertexXY && bxy <= fMaxDCAToVertexXY))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
   if (!dcaInfo || fDCAToVertex2D || (!fDCAToVertex2D && bz  >= fMinDCAToVertexZ && bz  <= fMaxDCAToVertexZ))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
   if (!dcaInfo || !fDCAToVertex2D || (fDCAToVertex2D && TMath::Sqrt(b2Dmin) > 1  && TMath::Sqrt(b2Dmax) < 1))
-      fBitmap->SetBitNumber(iCutBit,kTRUE);
+      SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
   if (!dcaInfo || (fDCA[5] >= fNSigmaToVertexMin && fDCA[5] <= fNSigmaToVertexMax))
-      fBitmap->SetBitNumber(iCutBit,kTRUE);
+      SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
   if (!dcaInfo || fDCA[2] < fSigmaDCAxy)
-      fBitmap->SetBitNumber(iCutBit,kTRUE);
+      SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
   if (!dcaInfo || fDCA[3] < fSigmaDCAz)
-      fBitmap->SetBitNumber(iCutBit,kTRUE);
+      SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
   if (!dcaInfo || !fRequireSigmaToVertex || (fDCA[5]>=0 && fRequireSigmaToVertex))
-      fBitmap->SetBitNumber(iCutBit,kTRUE);
+      SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
   if (!dcaInfo || fAcceptKinkDaughters || (!fAcceptKinkDaughters && esdTrack->GetKinkIndex(0)<=0))
-      fBitmap->SetBitNumber(iCutBit,kTRUE);
+      SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
   if (isAODTrack) {
     if (fAODType==AliAODTrack::kUndef || fAODType == aodTrack->GetType()) {
-      fBitmap->SetBitNumber(iCutBit,kTRUE);
+      SetCutBit(fBitmap,iCutBit);
     }
   }
-  else fBitmap->SetBitNumber(iCutBit,kTRUE);
+  else SetCutBit(fBitmap,iCutBit);
 
   return;
 }
@@ -612,16 +610,7 @@ Bool_t AliCFTrackIsPrimaryCuts::IsSelected(TObject* obj) {
   SelectionBitMap(obj);
 
   if (fIsQAOn) FillHistograms(obj,0);
-  Bool_t isSelected = kTRUE;
-
-  for (UInt_t icut=0; icut<fBitmap->GetNbits();icut++) {
-    if(!fBitmap->TestBitNumber(icut)) {
-	isSelected = kFALSE;
-	break;
-    }
-  }
-
-  if (!isSelected) return kFALSE ;
+  if (fBitmap != AllCutsMask(kNCuts)) return kFALSE ;
   if (fIsQAOn) FillHistograms(obj,1);
   return kTRUE;
 }
@@ -875,12 +864,12 @@ void AliCFTrackIsPrimaryCuts::FillHistograms(TObject* obj, Bool_t f)
   SelectionBitMap(obj);
 
   // Number of single cuts in this class
-  UInt_t ncuts = fBitmap->GetNbits();
+  UInt_t ncuts = kNCuts;
   for(UInt_t bit=0; bit<ncuts;bit++) {
-    if (!fBitmap->TestBitNumber(bit)) {
+    if (!TestCutBit(fBitmap,bit)) {
 	fhCutStatistics->Fill(bit+1);
 	for (UInt_t bit2=bit; bit2<ncuts;bit2++) {
-	  if (!fBitmap->TestBitNumber(bit2)) 
+	  if (!TestCutBit(fBitmap,bit2)) 
 	    fhCutCorrelation->Fill(bit+1,bit2+1);
 	}
     }
@@ -55,7 +55,6 @@
 #include "AliAODTrack.h"
 #include <TH2.h>
 #include "AliESDtrackCuts.h"
-class TBits;
 class AliESDtrack;
 class AliAODTrack;
 class AliVEvent;
@@ -150,7 +149,7 @@ class AliCFTrackIsPrimaryCuts : public AliCFCutBase
   TH2F* fhCutCorrelation;		// Histogram: 2d statistics plot
 
   TH1F* fhQA[kNHist][kNStepQA];		// QA Histograms
-  TBits *fBitmap ; 			// stores single selection decisions
+  ULong64_t fBitmap ;                //! stores single selection decisions (bit i = cut i passed)
 
   // QA histogram setters
   Int_t fhNBinsNSigma;			// number of bins+1: dca in units of sigma
@@ -173,7 +172,7 @@ class AliCFTrackIsPrimaryCuts : public AliCFCutBase
   Double_t *fhBinLimSigmaDcaXY; //[fhNBinsSigmaDcaXY] bin limits: impact parameter in transverse plane
   Double_t *fhBinLimSigmaDcaZ; //[fhNBinsSigmaDcaZ] bin limits: impact parameter along beam axis
 
-  ClassDef(AliCFTrackIsPrimaryCuts,3);
+  ClassDef(AliCFTrackIsPrimaryCuts,4);
 };
 
 #endif
@@ -47,7 +47,6 @@
 #include <TCanvas.h>
 #include <TDirectory.h>
 #include <TH2.h>
-#include <TBits.h>
 
 #include <AliVParticle.h>
 #include <AliLog.h>
@@ -78,7 +77,7 @@ AliCFTrackKineCuts::AliCFTrackKineCuts() :
   fRequireIsCharged(0),
   fhCutStatistics(0),
   fhCutCorrelation(0),
-  fBitmap(0x0),
+  fBitmap(0),
   fhNBinsMomentum(0),
   fhNBinsPt(0),
   fhNBinsPx(0),
@@ -126,7 +125,7 @@ AliCFTrackKineCuts::AliCFTrackKineCuts(const Char_t* name, const Char_t* title)
   fRequireIsCharged(0),
   fhCutStatistics(0),
   fhCutCorrelation(0),
-  fBitmap(0x0),
+  fBitmap(0),
   fhNBinsMomentum(0),
   fhNBinsPt(0),
   fhNBinsPx(0),
@@ -270,7 +269,6 @@ AliCFTrackKineCuts::~AliCFTrackKineCuts()
       if(fhQA[i][j]) delete fhQA[i][j];
     }
   }
-  if(fBitmap) delete fBitmap;
   if(fhBinLimMomentum) delete fhBinLimMomentum;
   if(fhBinLimPt) delete fhBinLimPt;
   if(fhBinLimPx) delete fhBinLimPx;
@@ -326,7 +324,7 @@ void AliCFTrackKineCuts::Initialise()
 
   fhCutStatistics = 0;
   fhCutCorrelation = 0;
-  fBitmap=new TBits(0);
+  fBitmap=0;
 
   //set default bining for QA histograms
   SetHistogramBins(kCutP,200,0.,20.);
@@ -367,7 +365,7 @@ void AliCFTrackKineCuts::SelectionBitMap(TObject* obj) {
   //
 
   // bitmap stores the decision of each single cut
-  for(Int_t i=0; i<kNCuts; i++)fBitmap->SetBitNumber(i,kFALSE);
+  fBitmap=0;
 
   // check TObject and cast into VParticle
   if (!obj) return  ;
@@ -377,36 +375,36 @@ void AliCFTrackKineCuts::SelectionBitMap(TObject* obj) {
 
   Int_t iCutBit = 0;
   if((particle->P() >= fMomentumMin) && (particle->P() <= fMomentumMax))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if ((particle->Pt() >= fPtMin) && (particle->Pt() <= fPtMax))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if ((particle->Px() >= fPxMin) && (particle->Px() <= fPxMax))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if ((particle->Py() >= fPyMin) && (particle->Py() <= fPyMax))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if ((particle->Pz() >= fPzMin) && (particle->Pz() <= fPzMax))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if ((particle->Eta() >= fEtaMin) && (particle->Eta() <= fEtaMax))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if ((particle->Y() >= fRapidityMin) && (particle->Y() <= fRapidityMax))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if ((particle->Phi() >= fPhiMin) && (particle->Phi() <= fPhiMax))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if (fCharge >= 10 || (particle->Charge() == fCharge))
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if (fRequireIsCharged && particle->Charge()!=0)
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
   if (!fRequireIsCharged)
-	fBitmap->SetBitNumber(iCutBit,kTRUE);
+	SetCutBit(fBitmap,iCutBit);
 
   return;
 }
@@ -418,15 +416,7 @@ Bool_t AliCFTrackKineCuts::IsSelected(TObject* obj) {
   SelectionBitMap(obj);
 
   if (fIsQAOn) FillHistograms(obj,0);
-  Bool_t isSelected = kTRUE;
-
-  for (UInt_t icut=0; icut<fBitmap->GetNbits();icut++) {
-    if(!fBitmap->TestBitNumber(icut)) {
-	isSelected = kFALSE;
-	break;
-    }
-  }
-  if (!isSelected) return kFALSE ;
+  if (fBitmap != AllCutsMask(kNCuts)) return kFALSE ;
   if (fIsQAOn) FillHistograms(obj,1);
   return kTRUE;
 }
@@ -658,12 +648,12 @@ void AliCFTrackKineCuts::FillHistograms(TObject* obj, Bool_t b)
   if (b) return;
 
   // Number of single cuts in this class
-  UInt_t ncuts = fBitmap->GetNbits();
+  UInt_t ncuts = kNCuts;
   for(UInt_t bit=0; bit<ncuts;bit++) {
-    if (!fBitmap->TestBitNumber(bit)) {
+    if (!TestCutBit(fBitmap,bit)) {
       fhCutStatistics->Fill(bit+1);
       for (UInt_t bit2=bit; bit2<ncuts;bit2++) {
-        if (!fBitmap->TestBitNumber(bit2)) 
+        if (!TestCutBit(fBitmap,bit2)) 
           fhCutCorrelation->Fill(bit+1,bit2+1);
       }
     }
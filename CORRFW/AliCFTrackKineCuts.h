@@ -50,7 +50,6 @@
 #include "AliCFCutBase.h"
 
 class TH2 ;
-class TBits;
 class AliVParticle;
 
 class AliCFTrackKineCuts : public AliCFCutBase
@@ -133,7 +132,7 @@ class AliCFTrackKineCuts : public AliCFCutBase
   TH2F* fhCutCorrelation;		// Histogram: 2d statistics plot
 
   TH1F* fhQA[kNHist][kNStepQA];		// QA Histograms
-  TBits *fBitmap ; 			// stores single selection decisions
+  ULong64_t fBitmap ;                //! stores single selection decisions (bit i = cut i passed)
 
   // QA histogram setters
   Int_t fhNBinsMomentum;		// number of bins+1: momentum
@@ -156,7 +155,7 @@ class AliCFTrackKineCuts : public AliCFCutBase
   Double_t *fhBinLimPhi;	//[fhNBinsPhi] bin limits: phi
   Double_t *fhBinLimCharge;	//[fhNBinsCharge] bin limits: charge
 
-  ClassDef(AliCFTrackKineCuts,2);
+  ClassDef(AliCFTrackKineCuts,3);
 };
 
 #endif
@@ -49,7 +49,6 @@
 #include <TCanvas.h>
 #include <TDirectory.h>
 #include <TH2.h>
-#include <TBits.h>
 
 #include <AliESDtrack.h>
 #include <AliESDtrackCuts.h>
@@ -80,7 +79,7 @@ AliCFTrackQualityCuts::AliCFTrackQualityCuts() :
   fStatus(0),
   fhCutStatistics(0),
   fhCutCorrelation(0),
-  fBitmap(0x0),
+  fBitmap(0),
   fTrackCuts(0x0),
   fhNBinsClusterTPC(0),
   fhNBinsClusterITS(0),
@@ -139,7 +138,7 @@ AliCFTrackQualityCuts::AliCFTrackQualityCuts(const Char_t* name, const Char_t* t
   fStatus(0),
   fhCutStatistics(0),
   fhCutCorrelation(0),
-  fBitmap(0x0),
+  fBitmap(0),
   fTrackCuts(0x0),
   fhNBinsClusterTPC(0),
   fhNBinsClusterITS(0),
@@ -318,7 +317,6 @@ AliCFTrackQualityCuts::~AliCFTrackQualityCuts()
       if(fhQA[i][j]) delete fhQA[i][j];
     }
   }
-  if(fBitmap) delete fBitmap;
   if(fTrackCuts) delete fTrackCuts;
   if(fhBinLimClusterTPC) delete fhBinLimClusterTPC;
   if(fhBinLimClusterITS) delete fhBinLimClusterITS;
@@ -378,7 +376,7 @@ void AliCFTrackQualityCuts::Initialise()
   }
   fhCutStatistics = 0;
   fhCutCorrelation = 0;
-  fBitmap=new TBits(0);
+  fBitmap=0;
   fTrackCuts=new AliESDtrackCuts("aliESDtrackCuts","aliESDtrackCuts");
 
   //set default bining for QA histograms
@@ -427,7 +425,7 @@ void AliCFTrackQualityCuts::SelectionBitMap(TObject* obj)
   //
 
   // bitmap stores the decision of each single cut
-  for(Int_t i=0; i<kNCuts; i++)fBitmap->SetBitNumber(i,kFALSE);
+  fBitmap=0;
 
   if (!obj) return;
   if (!obj->InheritsFrom("AliVParticle")) {
@@ -488,77 +486,77 @@ void AliCFTrackQualityCuts::SelectionBitMap(TObject* obj)
   Int_t iCutBit = 0;
 
 // // // include following lines when AliESDtrackCuts is updated
-//   fBitmap->SetBitNumber(iCutBit,fTrackCuts->GetCutDecision(2)); iCutBit++; // nClustersTPC
-//   fBitmap->SetBitNumber(iCutBit,fTrackCuts->GetCutDecision(3)); iCutBit++; // nClustersITS
+//   SetCutBit(fBitmap,iCutBit,fTrackCuts->GetCutDecision(2)); iCutBit++; // nClustersTPC
+//   SetCutBit(fBitmap,iCutBit,fTrackCuts->GetCutDecision(3)); iCutBit++; // nClustersITS
 // // // remove following 6 lines when AliESDtrackCuts is updated
    if (nClustersTPC >= fMinNClusterTPC)
-     fBitmap->SetBitNumber(iCutBit,kTRUE);
+     SetCutBit(fBitmap,iCutBit);
    iCutBit++;
    if (nClustersITS >= fMinNClusterITS)
-     fBitmap->SetBitNumber(iCutBit,kTRUE);
+     SetCutBit(fBitmap,iCutBit);
    iCutBit++;
 
   if (nClustersTRD >= fMinNClusterTRD)
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 // // //   if ((fMinFoundClusterTPC <= 0) || (fTrackCuts->GetCutVariable(2) > 0 && (fractionFoundClustersTPC >= fMinFoundClusterTPC)))
   if ((fMinFoundClusterTPC <= 0) || (nClustersTPC > 0 && (fractionFoundClustersTPC >= fMinFoundClusterTPC)))
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if (nTrackletsTRD >= fMinNTrackletTRD)
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if (!isESDTrack || esdTrack->GetTRDntrackletsPID() >= fMinNTrackletTRDpid)
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
 // // // include following lines when AliESDtrackCuts is updated
-//   fBitmap->SetBitNumber(iCutBit,fTrackCuts->GetCutDecision(4)); iCutBit++; // chi2PerClusterTPC
-//   fBitmap->SetBitNumber(iCutBit,fTrackCuts->GetCutDecision(5)); iCutBit++; // chi2PerClusterITS
+//   SetCutBit(fBitmap,iCutBit,fTrackCuts->GetCutDecision(4)); iCutBit++; // chi2PerClusterTPC
+//   SetCutBit(fBitmap,iCutBit,fTrackCuts->GetCutDecision(5)); iCutBit++; // chi2PerClusterITS
 // // // remove following 6 lines when AliESDtrackCuts is updated
    if (chi2PerClusterTPC <= fMaxChi2PerClusterTPC)
-     fBitmap->SetBitNumber(iCutBit,kTRUE);
+     SetCutBit(fBitmap,iCutBit);
    iCutBit++;
    if (chi2PerClusterITS <= fMaxChi2PerClusterITS)
-     fBitmap->SetBitNumber(iCutBit,kTRUE);
+     SetCutBit(fBitmap,iCutBit);
    iCutBit++;
 
   if (chi2PerTrackletTRD <= fMaxChi2PerTrackletTRD)
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   iCutBit++;
   if (!isESDTrack || esdTrack->GetTPCsignalN() >= fMinNdEdxClusterTPC)
-    fBitmap->SetBitNumber(iCutBit,kTRUE);
+    SetCutBit(fBitmap,iCutBit);
   iCutBit++;
 
 // // // include following lines when AliESDtrackCuts is updated
-//   fBitmap->SetBitNumber(iCutBit,fTrackCuts->GetCutDecision(6)); iCutBit++; // extCov[0]
-//   fBitmap->SetBitNumber(iCutBit,fTrackCuts->GetCutDecision(7)); iCutBit++; // extCov[2]
-//   fBitmap->SetBitNumber(iCutBit,fTrackCuts->GetCutDecision(8)); iCutBit++; // extCov[5]
-//   fBitmap->SetBitNumber(iCutBit,fTrackCuts->GetCutDecision(9)); iCutBit++; // extCov[9]
-//   fBitmap->SetBitNumber(iCutBit,fTrackCuts->GetCutDecision(10)); iCutBit++; // extCov[14]
+//   SetCutBit(fBitmap,iCutBit,fTrackCuts->GetCutDecision(6)); iCutBit++; // extCov[0]
+//   SetCutBit(fBitmap,iCutBit,fTrackCuts->GetCutDecision(7)); iCutBit++; // extCov[2]
+//   SetCutBit(fBitmap,iCutBit,fTrackCuts->GetCutDecision(8)); iCutBit++; // extCov[5]
+//   SetCutBit(fBitmap,iCutBit,fTrackCuts->GetCutDecision(9)); iCutBit++; // extCov[9]
+//   SetCutBit(fBitmap,iCutBit,fTrackCuts->GetCutDecision(10)); iCutBit++; // extCov[14]
 // // // remove following lines when AliESDtrackCuts is updated
    if (extCov[0]  <= fCovariance11Max)
-     fBitmap->SetBitNumber(iCutBit,kTRUE);
+     SetCutBit(fBitmap,iCutBit);
    iCutBit++;
    if (extCov[2]  <= fCovariance22Max)
-     fBitmap->SetBitNumber(iCutBit,kTRUE);
+     SetCutBit(fBitmap,iCutBit);
    iCutBit++;
    if (extCov[5]  <= fCovariance33Max)
-     fBitmap->SetBitNumber(iCutBit,kTRUE);
+     SetCutBit(fBitmap,iCutBit);
    iCutBit++;
    if (extCov[9]  <= fCovariance44Max)
-     fBitmap->SetBitNumber(iCutBit,kTRUE);
+     SetCutBit(fBitmap,iCutBit);
    iCutBit++;
    if (extCov[14] <= fCovariance55Max)
-     fBitmap->SetBitNumber(iCutBit,kTRUE);
+     SetCutBit(fBitmap,iCutBit);
    iCutBit++;
 
 
   if (isESDTrack) {
-    if ( (esdTrack->GetStatus() & fStatus) == fStatus ) fBitmap->SetBitNumber(iCutBit,kTRUE);
+    if ( (esdTrack->GetStatus() & fStatus) == fStatus ) SetCutBit(fBitmap,iCutBit);
   }
   else {
-    if ( (aodTrack->GetStatus() & fStatus) == fStatus ) fBitmap->SetBitNumber(iCutBit,kTRUE);
+    if ( (aodTrack->GetStatus() & fStatus) == fStatus ) SetCutBit(fBitmap,iCutBit);
   }
 
   return;
@@ -571,15 +569,7 @@ Bool_t AliCFTrackQualityCuts::IsSelected(TObject* obj) {
   SelectionBitMap(obj);
 
   if (fIsQAOn) FillHistograms(obj,0);
-  Bool_t isSelected = kTRUE;
-
-  for (UInt_t icut=0; icut<fBitmap->GetNbits();icut++) {
-    if(!fBitmap->TestBitNumber(icut)) {
-	isSelected = kFALSE;
-	break;
-    }
-  }
-  if (!isSelected) return kFALSE ;
+  if (fBitmap != AllCutsMask(kNCuts)) return kFALSE ;
   if (fIsQAOn) FillHistograms(obj,1);
   return kTRUE;
 }
@@ -998,12 +988,12 @@ void AliCFTrackQualityCuts::FillHistograms(TObject* obj, Bool_t b)
   SelectionBitMap(obj);
 
   // Number of single cuts in this class
-  UInt_t ncuts = fBitmap->GetNbits();
+  UInt_t ncuts = kNCuts;
   for(UInt_t bit=0; bit<ncuts;bit++) {
-    if (!fBitmap->TestBitNumber(bit)) {
+    if (!TestCutBit(fBitmap,bit)) {
 	fhCutStatistics->Fill(bit+1);
 	for (UInt_t bit2=bit; bit2<ncuts;bit2++) {
-	  if (!fBitmap->TestBitNumber(bit2)) 
+	  if (!TestCutBit(fBitmap,bit2)) 
 	    fhCutCorrelation->Fill(bit+1,bit2+1);
 	}
     }
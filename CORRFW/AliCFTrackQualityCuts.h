@@ -51,7 +51,6 @@
 
 class TH2F;
 class TH1F;
-class TBits;
 class AliESDtrack;
 class AliESDtrackCuts;
 
@@ -143,7 +142,7 @@ class AliCFTrackQualityCuts : public AliCFCutBase
   TH2F* fhCutCorrelation;		// Histogram: 2d statistics plot
 
   TH1F* fhQA[kNHist][kNStepQA];		// QA Histograms
-  TBits *fBitmap ; 			// stores single selection decisions
+  ULong64_t fBitmap ;                //! stores single selection decisions (bit i = cut i passed)
   AliESDtrackCuts *fTrackCuts;		// use some functionality from this class
 
   // QA histogram setters
@@ -179,7 +178,7 @@ class AliCFTrackQualityCuts : public AliCFCutBase
   Double_t *fhBinLimCovariance44;//[fhNBinsCovariance44] bin limits: covariance matrix element 44
   Double_t *fhBinLimCovariance55;//[fhNBinsCovariance55] bin limits: covariance matrix element 55
 
-  ClassDef(AliCFTrackQualityCuts,4);
+  ClassDef(AliCFTrackQualityCuts,5);
 };
 
 #endif
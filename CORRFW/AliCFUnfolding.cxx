@@ -56,6 +56,8 @@
 // Documentation about correlated error calculation method can be      //
 // found in AliCFUnfolding::CalculateCorrelatedErrors()                //
 // Author: marta.verweij@cern.ch                                       //
+// The randomized unfoldings run on a compressed copy of the response  //
+// matrix, optionally on several threads (::SetNThreads)               //
 //                                                                     //
 // An optional possibility is to smooth the unfolded spectrum at the   //
 // end of each iteration, either using a fit function                  //
@@ -92,10 +94,126 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TRandom3.h"
+#include <algorithm>
+#include <map>
+#include <vector>
+#if __cplusplus >= 201103L
+#include <thread>
+#endif
 
 
 ClassImp(AliCFUnfolding)
 
+namespace {
+  //
+  // Compressed representation of the unfolding inputs, used for the randomized unfoldings :
+  // the cells of the measured (M) and true (T) spaces met in the inputs are numbered
+  // contiguously, and the response matrix becomes a list of (M,T) entries
+  //
+  class CellIndex {
+  public:
+    CellIndex(const THnSparse* h, Int_t firstDim, Int_t nDim) : fNCells(), fIndex() {
+      for (Int_t iDim=0; iDim<nDim; iDim++) fNCells.push_back(h->GetAxis(firstDim+iDim)->GetNbins()+2);
+    }
+    Int_t Get(const Int_t* coord) { // compressed index of the cell, numbered when first met
+      Long64_t cell = 0;
+      for (Int_t iDim=fNCells.size()-1; iDim>=0; iDim--) cell = cell*fNCells[iDim] + coord[iDim];
+      std::map<Long64_t,Int_t>::const_iterator it = fIndex.find(cell);
+      if (it != fIndex.end()) return it->second;
+      Int_t index = fIndex.size();
+      fIndex[cell] = index;
+      return index;
+    }
+    Int_t GetSize() const {return fIndex.size();}
+  private:
+    std::vector<Long64_t>    fNCells; // number of cells (including under/overflow) per dimension
+    std::map<Long64_t,Int_t> fIndex;  // global cell number -> compressed index
+  };
+
+  struct RandomizedCell {
+    Int_t    fCell;  // compressed index
+    Double_t fMean;  // original content
+    Double_t fSigma; // original error
+  };
+
+  struct ToyInput { // shared by all the threads, read only
+    Int_t                       fNIterations;
+    Int_t                       fNCellsM;
+    Int_t                       fNCellsT;
+    std::vector<Int_t>          fEntryM;      // M cell of each response entry
+    std::vector<Int_t>          fEntryT;      // T cell of each response entry
+    std::vector<Double_t>       fConditional; // P(M|T) of each response entry
+    std::vector<Double_t>       fInverse;     // inverse response of each entry at the start of the randomized unfoldings
+    std::vector<Double_t>       fPrior;       // original prior per T cell
+    std::vector<RandomizedCell> fEfficiency;  // filled cells of the original efficiency
+    std::vector<RandomizedCell> fMeasured;    // filled cells of the original measured spectrum
+    std::vector<Int_t>          fFinalCell;   // T cell of each bin of the final unfolded spectrum
+    std::vector<Double_t>       fFinalValue;  // content of each bin of the final unfolded spectrum
+    std::vector<UInt_t>         fSeeds;       // one random seed per randomized unfolding
+  };
+
+  struct ToyOutput { // sums of (final - randomized unfolded) over the randomized unfoldings of one thread
+    std::vector<Double_t> fSumDelta;
+    std::vector<Double_t> fSumDelta2;
+  };
+
+  void UnfoldToys(const ToyInput* in, Int_t firstToy, Int_t lastToy, TRandom3* random, ToyOutput* out) {
+    //
+    // Same steps as CreateRandomizedDist + Unfold (without smoothing) + FillDeltaUnfoldedProfile,
+    // for the randomized unfoldings firstToy to lastToy-1
+    //
+    const Int_t nEntries = in->fConditional.size();
+    const Int_t nFinal   = in->fFinalCell.size();
+    std::vector<Double_t> efficiency(in->fNCellsT), prior(in->fNCellsT), priorTimesEff(in->fNCellsT), unfolded(in->fNCellsT);
+    std::vector<Double_t> measured(in->fNCellsM), estMeasured(in->fNCellsM);
+    std::vector<Double_t> inverse;
+    out->fSumDelta .assign(nFinal,0.);
+    out->fSumDelta2.assign(nFinal,0.);
+
+    for (Int_t iToy=firstToy; iToy<lastToy; iToy++) {
+      // randomized distributions
+      // (the randomized response matrix is not needed : the conditional matrix is created once from the original one)
+      random->SetSeed(in->fSeeds[iToy]);
+      std::fill(efficiency.begin(),efficiency.end(),0.);
+      for (UInt_t i=0; i<in->fEfficiency.size(); i++) efficiency[in->fEfficiency[i].fCell] = random->Gaus(in->fEfficiency[i].fMean,in->fEfficiency[i].fSigma);
+      std::fill(measured.begin(),measured.end(),0.);
+      for (UInt_t i=0; i<in->fMeasured.size(); i++) measured[in->fMeasured[i].fCell] = random->Gaus(in->fMeasured[i].fMean,in->fMeasured[i].fSigma);
+      prior   = in->fPrior;
+      inverse = in->fInverse;
+
+      // bayes iterations
+      for (Int_t iIter=0; iIter<in->fNIterations; iIter++) {
+	for (Int_t iT=0; iT<in->fNCellsT; iT++) priorTimesEff[iT] = prior[iT] * efficiency[iT];
+	// measured estimate (CreateEstMeasured)
+	std::fill(estMeasured.begin(),estMeasured.end(),0.);
+	for (Int_t iEntry=0; iEntry<nEntries; iEntry++) {
+	  Double_t fill = in->fConditional[iEntry] * priorTimesEff[in->fEntryT[iEntry]];
+	  if (fill>0.) estMeasured[in->fEntryM[iEntry]] += fill;
+	}
+	// inverse response (CreateInvResponse) and unfolded spectrum (CreateUnfolded)
+	std::fill(unfolded.begin(),unfolded.end(),0.);
+	for (Int_t iEntry=0; iEntry<nEntries; iEntry++) {
+	  const Int_t iM = in->fEntryM[iEntry];
+	  const Int_t iT = in->fEntryT[iEntry];
+	  Double_t fill = (estMeasured[iM]>0. ? in->fConditional[iEntry] * priorTimesEff[iT] / estMeasured[iM] : 0.);
+	  if (fill>0. || inverse[iEntry]>0.) inverse[iEntry] = fill;
+	  fill = (efficiency[iT]>0. ? inverse[iEntry] * measured[iM] / efficiency[iT] : 0.);
+	  if (fill>0.) unfolded[iT] += fill;
+	}
+	// update the prior distribution
+	prior.swap(unfolded);
+      }
+
+      // prior now holds the unfolded spectrum of the last iteration
+      for (Int_t iBin=0; iBin<nFinal; iBin++) {
+	Double_t delta = in->fFinalValue[iBin] - prior[in->fFinalCell[iBin]];
+	out->fSumDelta [iBin] += delta;
+	out->fSumDelta2[iBin] += delta*delta;
+      }
+    }
+  }
+}
+
 //______________________________________________________________
 
 AliCFUnfolding::AliCFUnfolding() :
@@ -130,7 +248,8 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fNThreads(1)
 {
   //
   // default constructor
@@ -174,7 +293,8 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fNThreads(1)
 {
   //
   // named constructor
@@ -457,30 +577,33 @@ void AliCFUnfolding::CalculateCorrelatedErrors() {
 
 
   //Do fNRandomIterations = bayes iterations performed
-  for (int i=0; i<fNRandomIterations; i++) {
+  //Without smoothing the randomized unfoldings do not need the THnSparse machinery
+  if (!UnfoldRandomizedDistributions()) {
+    for (int i=0; i<fNRandomIterations; i++) {
     
-    // reset prior to original one
-    if (fPrior) delete fPrior ;
-    fPrior = (THnSparse*) fPriorOrig->Clone();
+      // reset prior to original one
+      if (fPrior) delete fPrior ;
+      fPrior = (THnSparse*) fPriorOrig->Clone();
 
-    // create randomized distribution and stick measured spectrum to it
-    CreateRandomizedDist();
+      // create randomized distribution and stick measured spectrum to it
+      CreateRandomizedDist();
 
-    if (fResponse) delete fResponse ;
-    fResponse = (THnSparse*) fRandomResponse->Clone();
-    fResponse->SetTitle("Response");
+      if (fResponse) delete fResponse ;
+      fResponse = (THnSparse*) fRandomResponse->Clone();
+      fResponse->SetTitle("Response");
 
-    if (fEfficiency) delete fEfficiency ;
-    fEfficiency = (THnSparse*) fRandomEfficiency->Clone();
-    fEfficiency->SetTitle("Efficiency");
+      if (fEfficiency) delete fEfficiency ;
+      fEfficiency = (THnSparse*) fRandomEfficiency->Clone();
+      fEfficiency->SetTitle("Efficiency");
 
-    if (fMeasured)   delete fMeasured   ;
-    fMeasured = (THnSparse*) fRandomMeasured->Clone();
-    fMeasured->SetTitle("Measured");
+      if (fMeasured)   delete fMeasured   ;
+      fMeasured = (THnSparse*) fRandomMeasured->Clone();
+      fMeasured->SetTitle("Measured");
 
-    //unfold with randomized distributions
-    Unfold();
-    FillDeltaUnfoldedProfile();
+      //unfold with randomized distributions
+      Unfold();
+      FillDeltaUnfoldedProfile();
+    }
   }
 
   // Get statistical errors for final unfolded spectrum
@@ -573,6 +696,112 @@ void AliCFUnfolding::FillDeltaUnfoldedProfile() {
   }
 }
 
+//______________________________________________________________
+Bool_t AliCFUnfolding::UnfoldRandomizedDistributions() {
+  //
+  // Unfolds the fNRandomIterations randomized distributions and fills fDeltaUnfoldedP,
+  // as the loop on CreateRandomizedDist, Unfold and FillDeltaUnfoldedProfile does,
+  // but on a compressed copy of the response matrix and spectra built once :
+  // each bayes iteration is then two passes over the filled cells of the response matrix.
+  // The randomized unfoldings are shared among fNThreads threads, each one using its own
+  // random seed drawn from fRandom3, so that the result does not depend on the number of threads.
+  // Returns kFALSE if the randomized unfoldings have to be done with the THnSparse (smoothing)
+  //
+
+  if (fUseSmoothing || fMaxNumIterations<=0 || !fUnfoldedFinal) return kFALSE;
+  if (fNRandomIterations<=0) return kTRUE;
+
+  CellIndex indexM(fResponseOrig,0,fNVariables);
+  CellIndex indexT(fResponseOrig,fNVariables,fNVariables);
+  ToyInput in;
+  in.fNIterations = fMaxNumIterations;
+
+  // response matrix entries : the bins of fConditional and fInverseResponse are those of the response matrix
+  for (Long_t iBin=0; iBin<fConditional->GetNbins(); iBin++) {
+    Double_t conditionalValue = fConditional->GetBinContent(iBin,fCoordinates2N);
+    GetCoordinates();
+    in.fEntryM.push_back(indexM.Get(fCoordinatesN_M));
+    in.fEntryT.push_back(indexT.Get(fCoordinatesN_T));
+    in.fConditional.push_back(conditionalValue);
+    in.fInverse.push_back(fInverseResponse->GetBinContent(fCoordinates2N));
+  }
+  std::vector<Int_t>    priorCell;
+  std::vector<Double_t> priorValue;
+  for (Long_t iBin=0; iBin<fPriorOrig->GetNbins(); iBin++) {
+    priorValue.push_back(fPriorOrig->GetBinContent(iBin,fCoordinatesN_T));
+    priorCell .push_back(indexT.Get(fCoordinatesN_T));
+  }
+  for (Long_t iBin=0; iBin<fEfficiencyOrig->GetNbins(); iBin++) {
+    RandomizedCell cell;
+    cell.fMean  = fEfficiencyOrig->GetBinContent(iBin,fCoordinatesN_T);
+    cell.fSigma = fEfficiencyOrig->GetBinError(iBin);
+    cell.fCell  = indexT.Get(fCoordinatesN_T);
+    in.fEfficiency.push_back(cell);
+  }
+  for (Long_t iBin=0; iBin<fMeasuredOrig->GetNbins(); iBin++) {
+    RandomizedCell cell;
+    cell.fMean  = fMeasuredOrig->GetBinContent(iBin,fCoordinatesN_M);
+    cell.fSigma = fMeasuredOrig->GetBinError(iBin);
+    cell.fCell  = indexM.Get(fCoordinatesN_M);
+    in.fMeasured.push_back(cell);
+  }
+  for (Long_t iBin=0; iBin<fUnfoldedFinal->GetNbins(); iBin++) {
+    in.fFinalValue.push_back(fUnfoldedFinal->GetBinContent(iBin,fCoordinatesN_T));
+    in.fFinalCell .push_back(indexT.Get(fCoordinatesN_T));
+  }
+  in.fNCellsM = indexM.GetSize();
+  in.fNCellsT = indexT.GetSize();
+  in.fPrior.assign(in.fNCellsT,0.);
+  for (UInt_t i=0; i<priorCell.size(); i++) in.fPrior[priorCell[i]] = priorValue[i];
+
+  // seed 0 would mean a time-dependent seed in TRandom3
+  for (Int_t iToy=0; iToy<fNRandomIterations; iToy++) in.fSeeds.push_back(1+fRandom3->Integer(kMaxUInt-1));
+
+  Int_t nThreads = fNThreads;
+#if __cplusplus >= 201103L
+  if (nThreads<=0) nThreads = std::thread::hardware_concurrency();
+#else
+  nThreads = 1;
+#endif
+  if (nThreads<1) nThreads = 1;
+  if (nThreads>fNRandomIterations) nThreads = fNRandomIterations;
+
+  AliInfo(Form("Unfolding %d randomized distributions on %d thread(s) : %d response entries, %d measured and %d true cells",
+	       fNRandomIterations,nThreads,(Int_t)in.fConditional.size(),in.fNCellsM,in.fNCellsT));
+
+  // the random generators are created here, the threads do not create any ROOT object
+  std::vector<TRandom3*> random(nThreads);
+  for (Int_t iThread=0; iThread<nThreads; iThread++) random[iThread] = new TRandom3(1);
+  std::vector<ToyOutput> out(nThreads);
+#if __cplusplus >= 201103L
+  std::vector<std::thread> threads;
+  for (Int_t iThread=1; iThread<nThreads; iThread++)
+    threads.push_back(std::thread(UnfoldToys,&in,iThread*fNRandomIterations/nThreads,(iThread+1)*fNRandomIterations/nThreads,random[iThread],&out[iThread]));
+#endif
+  UnfoldToys(&in,0,fNRandomIterations/nThreads,random[0],&out[0]);
+#if __cplusplus >= 201103L
+  for (UInt_t iThread=0; iThread<threads.size(); iThread++) threads[iThread].join();
+#endif
+  for (Int_t iThread=0; iThread<nThreads; iThread++) delete random[iThread];
+
+  // fill fDeltaUnfoldedP with the mean and mean square of the differences, as FillDeltaUnfoldedProfile
+  for (Long_t iBin=0; iBin<fUnfoldedFinal->GetNbins(); iBin++) {
+    Double_t sumDelta = 0., sumDelta2 = 0.;
+    for (Int_t iThread=0; iThread<nThreads; iThread++) {
+      sumDelta  += out[iThread].fSumDelta [iBin];
+      sumDelta2 += out[iThread].fSumDelta2[iBin];
+    }
+    fUnfoldedFinal->GetBinContent(iBin,fCoordinatesN_M);
+    Double_t entriesInBin = fDeltaUnfoldedN->GetBinContent(fCoordinatesN_M);
+    Double_t mean   = (entriesInBin*fDeltaUnfoldedP->GetBinContent(fCoordinatesN_M) + sumDelta ) / (entriesInBin+fNRandomIterations);
+    Double_t meanx2 = (entriesInBin*fDeltaUnfoldedP->GetBinError  (fCoordinatesN_M) + sumDelta2) / (entriesInBin+fNRandomIterations);
+    fDeltaUnfoldedP->SetBinError  (fCoordinatesN_M,meanx2);
+    fDeltaUnfoldedP->SetBinContent(fCoordinatesN_M,mean);
+    fDeltaUnfoldedN->SetBinContent(fCoordinatesN_M,entriesInBin+fNRandomIterations);
+  }
+  return kTRUE;
+}
+
 //______________________________________________________________
 
 void AliCFUnfolding::GetCoordinates() {
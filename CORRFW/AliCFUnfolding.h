@@ -36,6 +36,7 @@ class AliCFUnfolding : public TNamed {
   }
 
   void SetNRandomIterations(Int_t n = 100) {fNRandomIterations = n;};
+  void SetNThreads(Int_t n = 0) {fNThreads = n;} // threads used for the randomized unfoldings, 0 = all available cores
 
   void UseSmoothing(TF1* fcn=0x0, Option_t* opt="iremn") { // if fcn=0x0 then smooth using neighbouring bins 
     fUseSmoothing=kTRUE;                                   // this function must NOT be used if fNVariables > 3
@@ -111,6 +112,7 @@ class AliCFUnfolding : public TNamed {
   THnSparse     *fDeltaUnfoldedN;    // Entries of the delta-unfolded distribution (count for each bin)
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
+  Int_t          fNThreads;          // Number of threads for the randomized unfoldings (0 = all available cores)
 
 
   // functions
@@ -130,9 +132,10 @@ class AliCFUnfolding : public TNamed {
   void     CalculateCorrelatedErrors(); // Calculates correlated errors for the final unfolded spectrum
   void     CreateRandomizedDist();      // Create randomized dist from measured distribution
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
+  Bool_t   UnfoldRandomizedDistributions(); // Unfolds all the randomized distributions on a compressed response matrix and fills fDeltaUnfoldedP
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
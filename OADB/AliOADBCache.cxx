@@ -0,0 +1,212 @@
+//-------------------------------------------------------------------------
+//     Process-wide cache of OADB containers and objects
+//
+//     Usage, e.g. in a task at run change:
+//       AliOADBMultSelection *obj = (AliOADBMultSelection*)
+//         AliOADBCache::Acquire(fileName, "MultSel", run, "Default");
+//     and in its destructor (or before acquiring the object of the next run):
+//       if (obj) AliOADBCache::Release(fileName, "MultSel");
+//     The runs of the input dataset can be loaded upfront with Prefetch(),
+//     which, if it finds any of them, also keeps a reference until the
+//     matching Release().
+//-------------------------------------------------------------------------
+
+#include "AliOADBCache.h"
+#include "AliOADBContainer.h"
+#include "AliLog.h"
+#include "TFile.h"
+#include "TH1.h"
+#include "TString.h"
+#include "TSystem.h"
+#include "TMutex.h"
+#include "TVirtualMutex.h"
+#include <map>
+#include <string>
+#include <stdlib.h>
+
+ClassImp(AliOADBCache)
+
+namespace {
+  struct CachedContainer {
+    AliOADBContainer* fContainer; // container read from the file, owned
+    Int_t fNReferences;           // number of Acquire() not yet released
+  };
+  typedef std::map<std::string, CachedContainer> ContainerMap;
+  typedef std::map<std::string, TObject*> ObjectMap;
+
+  // function statics, so that the cache can be used from other static initialisers
+  ContainerMap& Containers() { static ContainerMap containers; return containers; }
+  ObjectMap& Objects() { static ObjectMap objects; return objects; }
+  // recursive, held by every public function of AliOADBCache
+  TMutex& CacheMutex() { static TMutex mutex(kTRUE); return mutex; }
+
+  std::string NormalizedFileName(const char* fileName) {
+    // the same file can be given as $ALICE_PHYSICS/..., as a relative path or through
+    // symbolic links; local files are keyed by their canonical absolute path
+    TString name(fileName);
+    gSystem->ExpandPathName(name);
+    if (name.BeginsWith("file:")) name.Remove(0, 5);
+    else if (name.Contains("://")) return name.Data();
+    char* resolved = realpath(name.Data(), 0);
+    if (!resolved) return name.Data();
+    std::string canonical(resolved);
+    free(resolved);
+    return canonical;
+  }
+
+  std::string ContainerKey(const char* fileName, const char* containerName) {
+    return NormalizedFileName(fileName) + "#" + containerName;
+  }
+  std::string ObjectKey(const std::string& containerKey, Int_t run, const char* defaultName, const char* passName) {
+    return containerKey + Form("#%d#%s#%s", run, passName, defaultName);
+  }
+
+  CachedContainer* Load(const char* fileName, const char* containerName) {
+    // returns the cache entry of the container, reading it from the file the first time
+    std::string key = ContainerKey(fileName, containerName);
+    ContainerMap::iterator it = Containers().find(key);
+    if (it != Containers().end()) return &(it->second);
+
+    // histograms in the OADB objects must not be attached to the file, which is closed below
+    Bool_t oldStatus = TH1::AddDirectoryStatus();
+    TH1::AddDirectory(kFALSE);
+    TFile* file = TFile::Open(fileName);
+    AliOADBContainer* container = 0;
+    if (!file || !file->IsOpen()) {
+      AliErrorGeneral("AliOADBCache", Form("Cannot open OADB file %s", fileName));
+    } else {
+      container = dynamic_cast<AliOADBContainer*>(file->Get(containerName));
+      if (!container) AliErrorGeneral("AliOADBCache", Form("OADB file %s does not contain OADBContainer named %s", fileName, containerName));
+      file->Close();
+    }
+    delete file;
+    TH1::AddDirectory(oldStatus);
+    if (!container) return 0;
+
+    CachedContainer& entry = Containers()[key];
+    entry.fContainer = container;
+    entry.fNReferences = 0;
+    return &entry;
+  }
+
+  TObject* Find(CachedContainer* entry, const std::string& containerKey, Int_t run, const char* defaultName, const char* passName) {
+    // run lookup in the container, done once per (run, pass, default)
+    std::string key = ObjectKey(containerKey, run, defaultName, passName);
+    ObjectMap::iterator it = Objects().find(key);
+    if (it != Objects().end()) return it->second;
+    TObject* obj = entry->fContainer->GetObject(run, defaultName, passName);
+    Objects()[key] = obj;
+    return obj;
+  }
+
+  void Erase(ContainerMap::iterator it) {
+    // removes the container and all the objects looked up in it
+    const std::string prefix = it->first + "#";
+    ObjectMap::iterator obj = Objects().lower_bound(prefix);
+    while (obj != Objects().end() && obj->first.compare(0, prefix.size(), prefix) == 0) Objects().erase(obj++);
+    delete it->second.fContainer;
+    Containers().erase(it);
+  }
+}
+
+AliOADBCache::AliOADBCache() : TObject() {
+  // not instantiated, all the interface is static
+}
+
+AliOADBContainer* AliOADBCache::AcquireContainer(const char* fileName, const char* containerName) {
+  // returns the container, reading it on the first call, and takes a reference on it
+  TLockGuard lock(&CacheMutex());
+  CachedContainer* entry = Load(fileName, containerName);
+  if (!entry) return 0;
+  entry->fNReferences++;
+  return entry->fContainer;
+}
+
+TObject* AliOADBCache::Acquire(const char* fileName, const char* containerName, Int_t run,
+                               const char* defaultName, const char* passName) {
+  // returns the object for the run (or the default object defaultName); if it is found,
+  // a reference is taken on the container, which is kept in memory until the matching Release
+  TLockGuard lock(&CacheMutex());
+  CachedContainer* entry = Load(fileName, containerName);
+  if (!entry) return 0;
+  TObject* obj = Find(entry, ContainerKey(fileName, containerName), run, defaultName, passName);
+  if (obj) entry->fNReferences++;
+  return obj;
+}
+
+TObject* AliOADBCache::AcquireDefaultObject(const char* fileName, const char* containerName, const char* key) {
+  // returns the default object key of the container, with a reference as Acquire
+  TLockGuard lock(&CacheMutex());
+  CachedContainer* entry = Load(fileName, containerName);
+  if (!entry) return 0;
+  TObject* obj = entry->fContainer->GetDefaultObject(key);
+  if (obj) entry->fNReferences++;
+  return obj;
+}
+
+void AliOADBCache::Release(const char* fileName, const char* containerName) {
+  // gives back a reference taken by one of the accessors or Prefetch, the container is freed by Trim
+  TLockGuard lock(&CacheMutex());
+  ContainerMap::iterator it = Containers().find(ContainerKey(fileName, containerName));
+  if (it == Containers().end() || it->second.fNReferences <= 0) {
+    AliWarningGeneral("AliOADBCache", Form("Release of %s from %s without Acquire", containerName, fileName));
+    return;
+  }
+  it->second.fNReferences--;
+}
+
+Int_t AliOADBCache::Prefetch(const char* fileName, const char* containerName, Int_t nRuns, const Int_t* runs,
+                             const char* defaultName, const char* passName) {
+  // loads the container and looks up the given runs, e.g. all the runs of the input dataset;
+  // returns the number of runs for which an object is found.
+  // If it is not 0, a reference is taken on the container, to be given back with Release
+  TLockGuard lock(&CacheMutex());
+  CachedContainer* entry = Load(fileName, containerName);
+  if (!entry) return 0;
+  std::string key = ContainerKey(fileName, containerName);
+  Int_t nFound = 0;
+  for (Int_t i = 0; i < nRuns; i++) {
+    if (Find(entry, key, runs[i], defaultName, passName)) nFound++;
+  }
+  if (nFound > 0) entry->fNReferences++;
+  return nFound;
+}
+
+Int_t AliOADBCache::GetNContainers() {
+  TLockGuard lock(&CacheMutex());
+  return Containers().size();
+}
+
+Int_t AliOADBCache::GetNReferences(const char* fileName, const char* containerName) {
+  TLockGuard lock(&CacheMutex());
+  ContainerMap::const_iterator it = Containers().find(ContainerKey(fileName, containerName));
+  return it != Containers().end() ? it->second.fNReferences : 0;
+}
+
+void AliOADBCache::Trim() {
+  // frees the containers which are not referenced anymore
+  TLockGuard lock(&CacheMutex());
+  ContainerMap::iterator it = Containers().begin();
+  while (it != Containers().end()) {
+    if (it->second.fNReferences > 0) { ++it; continue; }
+    Erase(it++);
+  }
+}
+
+void AliOADBCache::ClearCache() {
+  // frees all the containers, the objects still referenced become invalid
+  TLockGuard lock(&CacheMutex());
+  while (!Containers().empty()) {
+    ContainerMap::iterator it = Containers().begin();
+    if (it->second.fNReferences > 0)
+      AliWarningGeneral("AliOADBCache", Form("Clearing %s which has still %d references", it->first.c_str(), it->second.fNReferences));
+    Erase(it);
+  }
+}
+
+void AliOADBCache::PrintStatus() {
+  TLockGuard lock(&CacheMutex());
+  Printf("AliOADBCache: %d containers, %d objects looked up", (Int_t) Containers().size(), (Int_t) Objects().size());
+  for (ContainerMap::const_iterator it = Containers().begin(); it != Containers().end(); ++it)
+    Printf("  %s : %d references", it->first.c_str(), it->second.fNReferences);
+}
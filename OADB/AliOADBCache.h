@@ -0,0 +1,54 @@
+#ifndef AliOADBCache_H
+#define AliOADBCache_H
+/* Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//     Process-wide cache of OADB containers and objects
+//
+//     Each OADB container is read once per process from its file and
+//     kept in memory; objects are looked up by (file, container, run,
+//     pass) and shared by all the tasks of the train instead of every
+//     task opening the file and holding its own copy at each run change.
+//     The returned objects are owned by the cache and must not be
+//     deleted nor modified by the caller.
+//
+//     Every accessor takes a reference on the container: a call which
+//     returns a non-null pointer (or a non-zero Prefetch) has to be matched by one
+//     Release() when the object is not needed anymore. The objects stay
+//     valid as long as the caller holds its reference; Trim() only frees
+//     the containers with no reference left. All the functions lock the
+//     cache, so tasks running in different threads can share it.
+//-------------------------------------------------------------------------
+
+#include <TObject.h>
+
+class AliOADBContainer;
+
+class AliOADBCache : public TObject {
+
+ public :
+  static AliOADBContainer* AcquireContainer(const char* fileName, const char* containerName);
+  static TObject* Acquire(const char* fileName, const char* containerName, Int_t run,
+                          const char* defaultName = "", const char* passName = "");
+  static TObject* AcquireDefaultObject(const char* fileName, const char* containerName, const char* key);
+  static void Release(const char* fileName, const char* containerName);
+
+  static Int_t Prefetch(const char* fileName, const char* containerName, Int_t nRuns, const Int_t* runs,
+                        const char* defaultName = "", const char* passName = "");
+
+  static Int_t GetNContainers();
+  static Int_t GetNReferences(const char* fileName, const char* containerName);
+  static void Trim();
+  static void ClearCache();
+  static void PrintStatus();
+
+ private :
+  AliOADBCache();
+  AliOADBCache(const AliOADBCache& cont);
+  AliOADBCache& operator=(const AliOADBCache& cont);
+
+  ClassDef(AliOADBCache, 0);
+};
+
+#endif
@@ -96,6 +96,7 @@
 #include "TPRegexp.h"
 #include "TFile.h"
 #include "AliOADBContainer.h"
+#include "AliOADBCache.h"
 #include "AliOADBPhysicsSelection.h"
 #include "AliOADBFillingScheme.h"
 #include "AliOADBTriggerAnalysis.h"
@@ -131,6 +132,8 @@ fHistStat(0),
 fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
+fUseOADBCache(kFALSE),
+fOADBCacheRefs(0),
 fTriggerToFormula(new StringToFormula()),
 fTriggerToRegexp(new StringToRegexp())
 {
@@ -161,6 +164,8 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fPSOADB(0),
  fFillOADB(0),
  fTriggerOADB(0),
+ fUseOADBCache(kFALSE),
+ fOADBCacheRefs(0),
  fTriggerToFormula(new StringToFormula()),
  fTriggerToRegexp(new StringToRegexp())
  {
@@ -174,6 +179,7 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  }
 
 AliPhysicsSelection::~AliPhysicsSelection(){
+  ReleaseOADBCache();
   if (fPSOADB)       delete fPSOADB;
   if (fFillOADB)     delete fFillOADB;
   if (fTriggerOADB)  delete fTriggerOADB;
@@ -352,6 +358,15 @@ Bool_t AliPhysicsSelection::Initialize(const AliVEvent* event){
   return Initialize(event->GetRunNumber());
 }
 
+void AliPhysicsSelection::ReleaseOADBCache(){
+  // gives back the OADB objects taken from AliOADBCache, they are owned by the cache
+  TString oadbfilename = AliPhysicsSelection::GetOADBFileName();
+  if (fOADBCacheRefs & kOADBCachePS)      { AliOADBCache::Release(oadbfilename, "physSel");      fPSOADB = 0; }
+  if (fOADBCacheRefs & kOADBCacheFill)    { AliOADBCache::Release(oadbfilename, "fillScheme");   fFillOADB = 0; }
+  if (fOADBCacheRefs & kOADBCacheTrigger) { delete fTriggerOADB; fTriggerOADB = 0; } // own copy, see Initialize
+  fOADBCacheRefs = 0;
+}
+
 Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
   // initializes the object for the given run  
   AliInfo(Form("Initializing for run %d", runNumber));
@@ -362,28 +377,51 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
   /// Open OADB file and fetch OADB objects
   TString oadbfilename = AliPhysicsSelection::GetOADBFileName();
   
-  TFile * foadb = TFile::Open(oadbfilename);
-  if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
+  // with the cache the file is read once per process and the objects are shared, not owned
+  ReleaseOADBCache();
+  TFile * foadb = 0;
+  if (!fUseOADBCache) {
+    foadb = TFile::Open(oadbfilename);
+    if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
+  }
   
   if(!fPSOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
     AliInfo("Using Standard OADB");
-    AliOADBContainer * psContainer = (AliOADBContainer*) foadb->Get("physSel");
-    if (!psContainer) AliFatal("Cannot fetch OADB container for Physics selection");
-    fPSOADB = (AliOADBPhysicsSelection*) psContainer->GetObject(runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb",fPassName);
+    if (fUseOADBCache) {
+      fPSOADB = (AliOADBPhysicsSelection*) AliOADBCache::Acquire(oadbfilename, "physSel", runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb", fPassName);
+      if (fPSOADB) fOADBCacheRefs |= kOADBCachePS;
+    } else {
+      AliOADBContainer * psContainer = (AliOADBContainer*) foadb->Get("physSel");
+      if (!psContainer) AliFatal("Cannot fetch OADB container for Physics selection");
+      fPSOADB = (AliOADBPhysicsSelection*) psContainer->GetObject(runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb",fPassName);
+    }
     if (!fPSOADB) AliFatal(Form("Cannot find physics selection object for run %d", runNumber));
   } else {
     AliInfo("Using Custom OADB");
   }
   if(!fFillOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * fillContainer = (AliOADBContainer*) foadb->Get("fillScheme");
-    if (!fillContainer) AliFatal("Cannot fetch OADB container for filling scheme");
-    fFillOADB = (AliOADBFillingScheme*) fillContainer->GetObject(runNumber, "Default",fPassName);
+    if (fUseOADBCache) {
+      fFillOADB = (AliOADBFillingScheme*) AliOADBCache::Acquire(oadbfilename, "fillScheme", runNumber, "Default", fPassName);
+      if (fFillOADB) fOADBCacheRefs |= kOADBCacheFill;
+    } else {
+      AliOADBContainer * fillContainer = (AliOADBContainer*) foadb->Get("fillScheme");
+      if (!fillContainer) AliFatal("Cannot fetch OADB container for filling scheme");
+      fFillOADB = (AliOADBFillingScheme*) fillContainer->GetObject(runNumber, "Default",fPassName);
+    }
     if (!fFillOADB) AliFatal(Form("Cannot find  filling scheme object for run %d", runNumber));
   }
   if(!fTriggerOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * triggerContainer = (AliOADBContainer*) foadb->Get("trigAnalysis");
-    if (!triggerContainer) AliFatal("Cannot fetch OADB container for trigger analysis");
-    fTriggerOADB = (AliOADBTriggerAnalysis*) triggerContainer->GetObject(runNumber, "Default",fPassName);
+    if (fUseOADBCache) {
+      // the thresholds below are overridden in the object, so it is copied from the shared one
+      TObject * triggerShared = AliOADBCache::Acquire(oadbfilename, "trigAnalysis", runNumber, "Default", fPassName);
+      fTriggerOADB = triggerShared ? (AliOADBTriggerAnalysis*) triggerShared->Clone() : 0;
+      if (triggerShared) AliOADBCache::Release(oadbfilename, "trigAnalysis");
+      fOADBCacheRefs |= kOADBCacheTrigger;
+    } else {
+      AliOADBContainer * triggerContainer = (AliOADBContainer*) foadb->Get("trigAnalysis");
+      if (!triggerContainer) AliFatal("Cannot fetch OADB container for trigger analysis");
+      fTriggerOADB = (AliOADBTriggerAnalysis*) triggerContainer->GetObject(runNumber, "Default",fPassName);
+    }
     if (!fTriggerOADB) AliFatal(Form("Cannot find  trigger analysis object for run %d", runNumber));
     fTriggerOADB->Print();
   }
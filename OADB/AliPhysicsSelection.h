@@ -87,6 +87,7 @@ public:
   void SetAnalyzeMC(Bool_t flag = kTRUE) { fMC = flag; }
   void SetUseBXNumbers(Bool_t flag = kTRUE) {fUseBXNumbers = flag;}
   void SetCustomOADBObjects(AliOADBPhysicsSelection * oadbPS, AliOADBFillingScheme * oadbFS, AliOADBTriggerAnalysis * oadbTA = 0) { fPSOADB = oadbPS; fFillOADB = oadbFS; fTriggerOADB = oadbTA; fUsingCustomClasses = kTRUE;}
+  void SetUseOADBCache(Bool_t flag = kTRUE) { fUseOADBCache = flag; } // share the OADB objects with the other users of AliOADBCache
   
   virtual TObject *GetStatistics(const Option_t *option) const { return fHistList.FindObject("fHistStat"); }
   void SetBin0Callback( const char * cb) { AliError("This method is deprecated"); } 
@@ -103,6 +104,8 @@ protected:
   UInt_t CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const;
   Bool_t EvaluateTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, const char* triggerLogic, Bool_t offline);
   const char * GetTriggerString(TObjString * obj);
+  void ReleaseOADBCache();
+  enum { kOADBCachePS = BIT(0), kOADBCacheFill = BIT(1), kOADBCacheTrigger = BIT(2) };
 
   TString fPassName;          // pass name for current run
   Int_t fCurrentRun;          // run number for which the object is initialized
@@ -121,6 +124,8 @@ protected:
   AliOADBPhysicsSelection* fPSOADB;      // Physics selection OADB object
   AliOADBFillingScheme*    fFillOADB;    // Filling scheme OADB object
   AliOADBTriggerAnalysis*  fTriggerOADB; // Trigger analysis OADB object
+  Bool_t fUseOADBCache;                  // take the OADB objects from AliOADBCache instead of reading them for each run
+  UInt_t fOADBCacheRefs;                 //! bits of the OADB objects above taken from AliOADBCache (not owned, except the copy of the trigger analysis object)
 
   StringToFormula *fTriggerToFormula; //! Map trigger strings to TFormulas
   FormulaAndBits& FindForumla(const char* triggerLogic); //! Returns pair of TFormula and trigger bits
@@ -128,7 +133,7 @@ protected:
   StringToRegexp* fTriggerToRegexp; //!
   TPRegexp& FindRegexp(const std::string& triggers) const;
 
-  ClassDef(AliPhysicsSelection, 24)
+  ClassDef(AliPhysicsSelection, 25)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
   AliPhysicsSelection& operator=(const AliPhysicsSelection&);
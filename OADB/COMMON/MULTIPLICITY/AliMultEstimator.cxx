@@ -20,8 +20,17 @@
 #include "TBrowser.h"
 #include "TFormula.h"
 #include "RVersion.h"
+#include "TMath.h"
+#include <cstdlib>
+#include <cstring>
 
 ClassImp(AliMultEstimator);
+
+namespace AliMultEstimatorOps {
+    //Op codes of the compiled definitions, kPushVar and kPushConst are followed by an index
+    enum EOpCode { kPushVar, kPushConst, kNeg, kNot, kAdd, kSub, kMul, kDiv, kIntDiv,
+        kLess, kGreater, kLessEq, kGreaterEq, kEqual, kNotEqual, kAnd, kOr };
+}
 //________________________________________________________________
 AliMultEstimator::AliMultEstimator() :
   TNamed(), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
@@ -46,6 +55,8 @@ fValue(e.fValue),
 fMean(e.fMean),
 fPercentile(e.fPercentile),
 fFormula(0),
+fCode(e.fCode),
+fConstants(e.fConstants),
 fkUseAnchor(e.fkUseAnchor),
 fAnchorPoint(e.fAnchorPoint),
 fAnchorPercentile(e.fAnchorPercentile)
@@ -67,6 +78,8 @@ AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
     if (fFormula) delete fFormula;
     fFormula = 0;
     if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+    fCode        = e.fCode;
+    fConstants   = e.fConstants;
     
     //Anchor point configs
     fkUseAnchor         = e.fkUseAnchor;
@@ -107,7 +120,7 @@ Float_t AliMultEstimator::GetZ() const {
     return lReturnVal; 
 }
 //________________________________________________________________
-void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
+void AliMultEstimator::SetupFormula(const AliMultInput* lInput, Bool_t lCompile)
 {
     TString expr = fDefinition;
     Int_t   nVar = lInput->GetNVariables();
@@ -121,6 +134,13 @@ void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
         lVarName.Prepend("(");
         expr.ReplaceAll(lVarName, repl);
     }
+    if (fFormula) delete fFormula;
+    fFormula = 0;
+    fCode.clear();
+    fConstants.clear();
+    //Compiled evaluation whenever the definition allows it
+    if (lCompile && CompileFormula(expr, nVar)) return;
+    
     fFormula = new TFormula(Form("e%s", GetName()), expr);
 #if ROOT_VERSION_CODE < ROOT_VERSION(5,99,4)
     fFormula->Optimize();
@@ -129,6 +149,7 @@ void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
 //________________________________________________________________
 Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
 {
+    if (IsCompiled()) return Evaluate(lInput->GetValues());
     if (!fFormula) return fValue = 0;
     for (Int_t i = 0; i < lInput->GetNVariables(); i++) {
         AliMultVariable* v = lInput->GetVariable(i);
@@ -138,3 +159,240 @@ Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
     }
     return fValue = fFormula->Eval(0);
 }
+//________________________________________________________________
+Float_t AliMultEstimator::Evaluate(const Double_t* lValues)
+{
+    //Evaluation of the compiled definition over the packed input values;
+    //only for compiled estimators, use Evaluate(const AliMultInput*) otherwise
+    using namespace AliMultEstimatorOps;
+    if (!IsCompiled()) return fValue = 0;
+    Double_t lStack[kMaxStack];
+    Int_t    lTop = -1;
+    const Int_t  lN    = fCode.size();
+    const Int_t* lCode = &fCode[0];
+    for (Int_t i = 0; i < lN; i++) {
+        switch (lCode[i]) {
+            case kPushVar:   lStack[++lTop] = lValues[lCode[++i]]; break;
+            case kPushConst: lStack[++lTop] = fConstants[lCode[++i]]; break;
+            case kNeg:       lStack[lTop] = -lStack[lTop]; break;
+            case kNot:       lStack[lTop] = !lStack[lTop]; break;
+            case kAdd:       lTop--; lStack[lTop] = lStack[lTop] +  lStack[lTop+1]; break;
+            case kSub:       lTop--; lStack[lTop] = lStack[lTop] -  lStack[lTop+1]; break;
+            case kMul:       lTop--; lStack[lTop] = lStack[lTop] *  lStack[lTop+1]; break;
+            case kDiv:       lTop--; lStack[lTop] = lStack[lTop] /  lStack[lTop+1]; break;
+            case kIntDiv:    lTop--; lStack[lTop] = (lStack[lTop+1] != 0) ? (Double_t)((Long64_t)lStack[lTop] / (Long64_t)lStack[lTop+1]) : 0; break;
+            case kLess:      lTop--; lStack[lTop] = lStack[lTop] <  lStack[lTop+1]; break;
+            case kGreater:   lTop--; lStack[lTop] = lStack[lTop] >  lStack[lTop+1]; break;
+            case kLessEq:    lTop--; lStack[lTop] = lStack[lTop] <= lStack[lTop+1]; break;
+            case kGreaterEq: lTop--; lStack[lTop] = lStack[lTop] >= lStack[lTop+1]; break;
+            case kEqual:     lTop--; lStack[lTop] = lStack[lTop] == lStack[lTop+1]; break;
+            case kNotEqual:  lTop--; lStack[lTop] = lStack[lTop] != lStack[lTop+1]; break;
+            case kAnd:       lTop--; lStack[lTop] = lStack[lTop] && lStack[lTop+1]; break;
+            case kOr:        lTop--; lStack[lTop] = lStack[lTop] || lStack[lTop+1]; break;
+        }
+    }
+    return fValue = lStack[0];
+}
+//________________________________________________________________
+namespace {
+    //Recursive descent compiler of the estimator definitions, C operator
+    //precedence. Operands are typed as in the C++ code generated by TFormula:
+    //parameters are double, integer literals and logical results are int,
+    //so that e.g. int/int is still an integer division. Sub-expressions of
+    //constants only are folded at compile time.
+    class AliMultFormulaCompiler {
+    public:
+        AliMultFormulaCompiler(const char* lExpr, Int_t lNVar, std::vector<Int_t>& lCode, std::vector<Double_t>& lConst)
+        : fPos(lExpr), fNVar(lNVar), fDepth(0), fMaxDepth(0), fOk(kTRUE), fCode(lCode), fConst(lConst) {}
+        
+        Bool_t Compile(Int_t lMaxStack) {
+            ParseOr();
+            SkipSpaces();
+            return fOk && *fPos == 0 && fDepth == 1 && fMaxDepth <= lMaxStack && !fCode.empty();
+        }
+        
+    private:
+        struct Operand { Bool_t fIsConst; Bool_t fIsInt; };
+        
+        void SkipSpaces() { while (*fPos == ' ' || *fPos == '\t') fPos++; }
+        Bool_t Accept(const char* lTok) {
+            SkipSpaces();
+            Int_t n = strlen(lTok);
+            if (strncmp(fPos, lTok, n)) return kFALSE;
+            //do not take the first character of a two character operator
+            if (n == 1 && (lTok[0] == '<' || lTok[0] == '>' || lTok[0] == '!' || lTok[0] == '=') && fPos[1] == '=') return kFALSE;
+            fPos += n;
+            return kTRUE;
+        }
+        void Push(Int_t lOp) { fCode.push_back(lOp); }
+        void PushConst(Double_t lVal) {
+            fCode.push_back(AliMultEstimatorOps::kPushConst);
+            fCode.push_back(fConst.size());
+            fConst.push_back(lVal);
+            if (++fDepth > fMaxDepth) fMaxDepth = fDepth;
+        }
+        Double_t PopConst() {
+            //removes the last kPushConst, the constant itself stays unused
+            Double_t lVal = fConst[fCode.back()];
+            fCode.pop_back(); fCode.pop_back();
+            fDepth--;
+            return lVal;
+        }
+        
+        Operand Unary(Int_t lOp, Operand a) {
+            Operand r = { a.fIsConst, lOp == AliMultEstimatorOps::kNot ? kTRUE : a.fIsInt };
+            if (a.fIsConst) {
+                Double_t v = PopConst();
+                PushConst(lOp == AliMultEstimatorOps::kNot ? (Double_t)(!v) : -v);
+            } else Push(lOp);
+            return r;
+        }
+        Operand Binary(Int_t lOp, Operand a, Operand b) {
+            using namespace AliMultEstimatorOps;
+            Bool_t lLogical = (lOp >= kLess);
+            Bool_t lInt = lLogical || (a.fIsInt && b.fIsInt);
+            if (lOp == kDiv && a.fIsInt && b.fIsInt) lOp = kIntDiv;
+            Operand r = { a.fIsConst && b.fIsConst, lInt };
+            if (!r.fIsConst) { Push(lOp); fDepth--; return r; }
+            Double_t y = PopConst(), x = PopConst(), v = 0;
+            switch (lOp) {
+                case kAdd: v = x + y; break;
+                case kSub: v = x - y; break;
+                case kMul: v = x * y; break;
+                case kDiv: v = x / y; break;
+                case kIntDiv:
+                    if (y == 0) { fOk = kFALSE; break; }
+                    v = (Double_t)((Long64_t)x / (Long64_t)y); break;
+                case kLess: v = x < y; break;
+                case kGreater: v = x > y; break;
+                case kLessEq: v = x <= y; break;
+                case kGreaterEq: v = x >= y; break;
+                case kEqual: v = x == y; break;
+                case kNotEqual: v = x != y; break;
+                case kAnd: v = x && y; break;
+                case kOr: v = x || y; break;
+            }
+            PushConst(v);
+            return r;
+        }
+        
+        Operand ParseOr() {
+            Operand a = ParseAnd();
+            while (fOk && Accept("||")) a = Binary(AliMultEstimatorOps::kOr, a, ParseAnd());
+            return a;
+        }
+        Operand ParseAnd() {
+            Operand a = ParseEquality();
+            while (fOk && Accept("&&")) a = Binary(AliMultEstimatorOps::kAnd, a, ParseEquality());
+            return a;
+        }
+        Operand ParseEquality() {
+            using namespace AliMultEstimatorOps;
+            Operand a = ParseRelational();
+            while (fOk) {
+                if (Accept("==")) a = Binary(kEqual, a, ParseRelational());
+                else if (Accept("!=")) a = Binary(kNotEqual, a, ParseRelational());
+                else break;
+            }
+            return a;
+        }
+        Operand ParseRelational() {
+            using namespace AliMultEstimatorOps;
+            Operand a = ParseAdditive();
+            while (fOk) {
+                if (Accept("<=")) a = Binary(kLessEq, a, ParseAdditive());
+                else if (Accept(">=")) a = Binary(kGreaterEq, a, ParseAdditive());
+                else if (Accept("<")) a = Binary(kLess, a, ParseAdditive());
+                else if (Accept(">")) a = Binary(kGreater, a, ParseAdditive());
+                else break;
+            }
+            return a;
+        }
+        Operand ParseAdditive() {
+            using namespace AliMultEstimatorOps;
+            Operand a = ParseMultiplicative();
+            while (fOk) {
+                if (Accept("+")) a = Binary(kAdd, a, ParseMultiplicative());
+                else if (Accept("-")) a = Binary(kSub, a, ParseMultiplicative());
+                else break;
+            }
+            return a;
+        }
+        Operand ParseMultiplicative() {
+            using namespace AliMultEstimatorOps;
+            Operand a = ParseUnary();
+            while (fOk) {
+                if (Accept("*")) a = Binary(kMul, a, ParseUnary());
+                else if (Accept("/")) a = Binary(kDiv, a, ParseUnary());
+                else break;
+            }
+            return a;
+        }
+        Operand ParseUnary() {
+            using namespace AliMultEstimatorOps;
+            if (Accept("-")) return Unary(kNeg, ParseUnary());
+            if (Accept("+")) return ParseUnary();
+            if (Accept("!")) return Unary(kNot, ParseUnary());
+            return ParsePrimary();
+        }
+        Operand ParsePrimary() {
+            Operand r = { kFALSE, kFALSE };
+            SkipSpaces();
+            if (!fOk) return r;
+            if (Accept("(")) {
+                r = ParseOr();
+                if (!Accept(")")) fOk = kFALSE;
+                return r;
+            }
+            if (Accept("[")) {
+                char* lEnd = 0;
+                Long_t lIdx = strtol(fPos, &lEnd, 10);
+                if (lEnd == fPos || lIdx < 0 || lIdx >= fNVar) { fOk = kFALSE; return r; }
+                fPos = lEnd;
+                if (!Accept("]")) { fOk = kFALSE; return r; }
+                fCode.push_back(AliMultEstimatorOps::kPushVar);
+                fCode.push_back(lIdx);
+                if (++fDepth > fMaxDepth) fMaxDepth = fDepth;
+                return r;
+            }
+            if ((*fPos >= '0' && *fPos <= '9') || *fPos == '.') {
+                char* lEnd = 0;
+                Double_t lVal = strtod(fPos, &lEnd);
+                //literals without '.' nor exponent are int in C++
+                Bool_t lIsInt = kTRUE;
+                for (const char* c = fPos; c < lEnd; c++) if (*c == '.' || *c == 'e' || *c == 'E') lIsInt = kFALSE;
+                fPos = lEnd;
+                //suffixes, hexadecimal... are left to TFormula
+                if ((*fPos >= 'a' && *fPos <= 'z') || (*fPos >= 'A' && *fPos <= 'Z') || *fPos == '_') { fOk = kFALSE; return r; }
+                PushConst(lVal);
+                r.fIsConst = kTRUE;
+                r.fIsInt = lIsInt;
+                return r;
+            }
+            //functions, named constants, other operators: not compiled
+            fOk = kFALSE;
+            return r;
+        }
+        
+        const char* fPos;
+        Int_t fNVar;
+        Int_t fDepth;
+        Int_t fMaxDepth;
+        Bool_t fOk;
+        std::vector<Int_t>& fCode;
+        std::vector<Double_t>& fConst;
+    };
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::CompileFormula(const TString& lExpr, Int_t lNVar)
+{
+    //Translates the definition (variables already replaced by [i]) into
+    //the stack program fCode; returns kFALSE if it can not be compiled
+    fCode.clear();
+    fConstants.clear();
+    AliMultFormulaCompiler lCompiler(lExpr.Data(), lNVar, fCode, fConstants);
+    if (lCompiler.Compile(kMaxStack)) return kTRUE;
+    fCode.clear();
+    fConstants.clear();
+    return kFALSE;
+}
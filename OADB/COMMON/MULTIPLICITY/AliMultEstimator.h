@@ -1,6 +1,7 @@
 #ifndef AliMultEstimator_H
 #define AliMultEstimator_H
 #include <TNamed.h>
+#include <vector>
 class AliMultInput;
 class TFormula;
 
@@ -40,11 +41,20 @@ public:
     
     Float_t GetZ () const; //check for zero
 
-    //Pre-processing for speed
-    void SetupFormula(const AliMultInput* lInput);
+    //Pre-processing for speed: the definition is compiled once into a small
+    //stack program over the packed input values (see AliMultInput::GetValues),
+    //definitions which can not be compiled fall back to a TFormula
+    void SetupFormula(const AliMultInput* lInput, Bool_t lCompile = kTRUE);
     Float_t Evaluate(const AliMultInput* lInput);
+    Float_t Evaluate(const Double_t* lValues);
+    Bool_t IsCompiled() const { return !fCode.empty(); }
     
 private:
+    Bool_t CompileFormula(const TString& lExpr, Int_t lNVar);
+    
+    enum { kMaxStack = 32 }; //max. depth of the evaluation stack of a compiled definition
+    
+
     TString fDefinition; //How to evaluate based on AliMultVariables
     Bool_t fIsInteger; //Requires special treatment when calibrating
     
@@ -52,12 +62,14 @@ private:
     Float_t fMean;   // estimator mean value
     Float_t fPercentile;   //Percentile
     TFormula* fFormula; //!
+    std::vector<Int_t>    fCode;      //! compiled definition: op codes, followed by an index for kPushVar/kPushConst
+    std::vector<Double_t> fConstants; //! constants of the compiled definition
     
     //Anchor point definition
     Bool_t  fkUseAnchor;        //Use Anchor Logic (default: No)
     Float_t fAnchorPoint;       //Raw value below which
     Float_t fAnchorPercentile;  //Percentile of X-section at anchor point
     
-    ClassDef(AliMultEstimator, 1)
+    ClassDef(AliMultEstimator, 2)
 };
 #endif
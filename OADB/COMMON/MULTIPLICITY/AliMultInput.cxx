@@ -17,21 +17,21 @@
 ClassImp(AliMultInput);
 
 AliMultInput::AliMultInput() :
-  TNamed(), fNVars(0), fVariableList(0x0)
+  TNamed(), fNVars(0), fVariableList(0x0), fValues()
 {
   // Constructor
     fVariableList = new TList();
 }
 
 AliMultInput::AliMultInput(const char * name, const char * title):
-TNamed(name,title), fNVars(0), fVariableList(0x0)
+TNamed(name,title), fNVars(0), fVariableList(0x0), fValues()
 {
   // Constructor
     fVariableList = new TList();
 }
 
 AliMultInput::AliMultInput(const AliMultInput& o)
-: TNamed(o), fNVars(0), fVariableList(0x0)
+: TNamed(o), fNVars(0), fVariableList(0x0), fValues()
 {
     // Constructor
     fVariableList = new TList();
@@ -92,6 +92,18 @@ AliMultVariable* AliMultInput::GetVariable (Long_t iIdx) const
     return static_cast<AliMultVariable*>(fVariableList->At(iIdx));
 }
 
+const Double_t* AliMultInput::GetValues() const
+{
+    fValues.resize(fNVars);
+    if (fNVars == 0) return 0;
+    TIter next(fVariableList);
+    AliMultVariable* var = 0;
+    Int_t i = 0;
+    while ((var = static_cast<AliMultVariable*>(next())))
+        fValues[i++] = var->IsInteger() ? var->GetValueInteger() : var->GetValue();
+    return &fValues[0];
+}
+
 void AliMultInput::Clear(Option_t* option)
 {
     TIter next(fVariableList);
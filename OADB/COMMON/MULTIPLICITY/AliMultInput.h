@@ -1,6 +1,7 @@
 #ifndef AliMultInput_H
 #define AliMultInput_H
 #include <TNamed.h>
+#include <vector>
 #include "AliMultVariable.h"
 
 class AliMultInput : public TNamed {
@@ -16,6 +17,8 @@ public:
     AliMultVariable* GetVariable (const TString& lName) const;
     AliMultVariable* GetVariable (Long_t iIdx) const;
     Long_t GetNVariables         () const { return fNVars; }
+    //Values of all the variables packed in one array (integers converted), in the order of GetVariable(i)
+    const Double_t* GetValues() const;
     void Clear(Option_t* option="");
     void Set(const AliMultInput* other);
     void Print(Option_t* option="") const;
@@ -23,7 +26,8 @@ public:
 private:
     Long_t fNVars;
     TList *fVariableList; //List containing all AliMultVariables
+    mutable std::vector<Double_t> fValues; //! packed values, filled by GetValues
     
-    ClassDef(AliMultInput, 1)
+    ClassDef(AliMultInput, 2)
 };
 #endif
@@ -240,10 +240,14 @@ void AliMultSelection::Evaluate( AliMultInput *lInput )
 //a set of input variables. Error handling to be done with care...
 {
     //Loop over estimators defined in the acquired list
+    //The input values are packed once and shared by all compiled estimators
+    const Double_t*   values    = lInput->GetValues();
     AliMultEstimator* estimator = 0;
     TIter             next(fEstimatorList);
-    while ((estimator = static_cast<AliMultEstimator*>(next())))
-        estimator->Evaluate(lInput);
+    while ((estimator = static_cast<AliMultEstimator*>(next()))) {
+        if (estimator->IsCompiled()) estimator->Evaluate(values);
+        else estimator->Evaluate(lInput);
+    }
 
 //deprecated evaluation
 #if 0
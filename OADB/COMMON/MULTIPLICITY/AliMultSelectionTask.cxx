@@ -82,6 +82,7 @@ class AliESDAD; //AD
 
 //For MultSelection Framework
 #include "AliOADBContainer.h"
+#include "AliOADBCache.h"
 #include "AliOADBMultSelection.h"
 #include "AliMultEstimator.h"
 #include "AliMultVariable.h"
@@ -106,7 +107,7 @@ AliMultSelectionTask::AliMultSelectionTask()
 fkCalibration ( kFALSE ), fkAddInfo(kTRUE), fkFilterMB(kTRUE), fkAttached(0), fkStoreQA(kFALSE),
 fkHighMultQABinning(kFALSE), fkGeneratorOnly(kFALSE), fkSkipMCHeaders(kFALSE), fkDebug(kTRUE),
 fkDebugAliCentrality ( kFALSE ), fkDebugAliPPVsMultUtils( kFALSE ), fkDebugIsMC( kFALSE ), fkDebugAdditional2DHisto( kFALSE ),
-fkUseDefaultCalib (kFALSE), fkUseDefaultMCCalib (kFALSE),
+fkUseDefaultCalib (kFALSE), fkUseDefaultMCCalib (kFALSE), fkUseOADBCache (kFALSE),
 fkSkipVertexZ(kFALSE),
 fDownscaleFactor(2.0), //2.0: no downscaling
 fRand(0),
@@ -265,7 +266,7 @@ AliMultSelectionTask::AliMultSelectionTask(const char *name, TString lExtraOptio
 fkCalibration ( lCalib ), fkAddInfo(kTRUE), fkFilterMB(kTRUE), fkAttached(0), fkStoreQA(kFALSE),
 fkHighMultQABinning(kFALSE), fkGeneratorOnly(kFALSE), fkSkipMCHeaders(kFALSE), fkDebug(kTRUE),
 fkDebugAliCentrality ( kFALSE ), fkDebugAliPPVsMultUtils( kFALSE ), fkDebugIsMC ( kFALSE ), fkDebugAdditional2DHisto( kFALSE ),
-fkUseDefaultCalib (kFALSE), fkUseDefaultMCCalib (kFALSE),
+fkUseDefaultCalib (kFALSE), fkUseDefaultMCCalib (kFALSE), fkUseOADBCache (kFALSE),
 fkSkipVertexZ(kFALSE), 
 fDownscaleFactor(2.0), //2.0: no downscaling
 fRand(0),
@@ -1781,25 +1782,13 @@ void AliMultSelectionTask::UserExec(Option_t *)
         fEvSelCode = lSelection->GetEvSelCode();
         
         //Determine Quantiles from calibration histogram
-        TH1F *lThisCalibHisto = 0x0;
-        TString lThisCalibHistoName;
+        //Flat tables built in AliOADBMultSelection::Setup, same as FindBin on hCalib_<estimator>
         Float_t lThisQuantile = -1;
         for(Long_t iEst=0; iEst<lSelection->GetNEstimators(); iEst++) {
             //Changed: no need for run number, object already matches required one
-            lThisCalibHistoName = Form("hCalib_%s",lSelection->GetEstimator(iEst)->GetName());
-            lThisCalibHisto = 0x0;
-            lThisCalibHisto = fOadbMultSelection->GetCalibHisto( lThisCalibHistoName );
-            if ( ! lThisCalibHisto ) {
-                lThisQuantile = AliMultSelectionCuts::kNoCalib;
-                if( iEst < fNDebug ) fQuantiles[iEst] = lThisQuantile;
-                lSelection->GetEstimator(iEst)->SetPercentile(lThisQuantile);
-            } else {
-                lThisQuantile = lThisCalibHisto->GetBinContent( lThisCalibHisto->FindBin( lSelection->GetEstimator(iEst)->GetValue() ));
-                if( iEst < fNDebug ) {
-                    fQuantiles[iEst] = lThisQuantile; //Debug, please
-                }
-                lSelection->GetEstimator(iEst)->SetPercentile(lThisQuantile);
-            }
+            lThisQuantile = fOadbMultSelection->GetPercentile( iEst, lSelection->GetEstimator(iEst)->GetValue() );
+            if( iEst < fNDebug ) fQuantiles[iEst] = lThisQuantile; //Debug, please
+            lSelection->GetEstimator(iEst)->SetPercentile(lThisQuantile);
         }
         
         //=============================================================================
@@ -2145,14 +2134,22 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
         lOADBref = Form("BYPASS: %s", fAlternateOADBFullManualBypass.Data());
     }
     
-    //Open File without calling InitFromFile, don't load it all!
-    TFile * foadb = TFile::Open(fileName);
-    if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", fileName.Data()));
+    AliOADBContainer * MultContainer = 0x0;
+    if ( fkUseOADBCache ) {
+        //Shared container, read only the first time any task asks for it
+        //The reference is given back once the object of the run is copied
+        MultContainer = AliOADBCache::AcquireContainer(fileName, "MultSel");
+        if(!MultContainer) AliFatal(Form("Cannot get OADBContainer named MultSel from OADB file %s", fileName.Data()));
+    } else {
+        //Open File without calling InitFromFile, don't load it all!
+        TFile * foadb = TFile::Open(fileName);
+        if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", fileName.Data()));
+        MultContainer = (AliOADBContainer*) foadb->Get("MultSel");
+    }
     
     //Managed to open, save name of opened OADB file
     lHistTitle.Append(Form(", OADB: %s",lOADBref.Data()));
     
-    AliOADBContainer * MultContainer = (AliOADBContainer*) foadb->Get("MultSel");
     if(!MultContainer) AliFatal(Form("OADB file %s does not contain OADBContainer named MultSel, stopping here", fileName.Data()));
     
     //Get Object for this run!
@@ -2172,6 +2169,7 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
             AliWarning("======================================================================");
             AliWarning(Form(" Multiplicity OADB does not exist for run %d, will return kNoCalib!",fCurrentRun ));
             AliWarning("======================================================================");
+            if ( fkUseOADBCache ) AliOADBCache::Release(fileName, "MultSel");
             //Create an empty OADB for us, please !
             CreateEmptyOADB();
             //Set histo title for posterity
@@ -2190,6 +2188,7 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
     fOadbMultSelection = new AliOADBMultSelection(*lObjTypecast);
     // De-couple histograms from the underlying file
     fOadbMultSelection->Dissociate();
+    if ( fkUseOADBCache ) AliOADBCache::Release(fileName, "MultSel");
     // Update cache map from estimator to histogram for fast look-up
     fOadbMultSelection->Setup();
     
@@ -2236,15 +2235,21 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
         //Managed to open, save name of opened OADB file
         lHistTitle.Append(Form(", muOADB: %s",lmuOADBref.Data()));
         
-        //Open fileNameAlter
-        TFile * foadbAlter = 0x0;
-        foadbAlter = TFile::Open(fileNameAlter);
-        
-        //Check existence, please
-        if(!foadbAlter) AliFatal(Form("Cannot open OADB file %s", fileNameAlter.Data()));
-        if(!foadbAlter->IsOpen()) AliFatal(Form("Cannot open OADB file %s", fileNameAlter.Data()));
-        
-        AliOADBContainer * MultContainerAlter = (AliOADBContainer*) foadbAlter->Get("MultSel");
+        AliOADBContainer * MultContainerAlter = 0x0;
+        if ( fkUseOADBCache ) {
+            MultContainerAlter = AliOADBCache::AcquireContainer(fileNameAlter, "MultSel");
+            if(!MultContainerAlter) AliFatal(Form("Cannot get OADBContainer named MultSel from OADB file %s", fileNameAlter.Data()));
+        } else {
+            //Open fileNameAlter
+            TFile * foadbAlter = 0x0;
+            foadbAlter = TFile::Open(fileNameAlter);
+            
+            //Check existence, please
+            if(!foadbAlter) AliFatal(Form("Cannot open OADB file %s", fileNameAlter.Data()));
+            if(!foadbAlter->IsOpen()) AliFatal(Form("Cannot open OADB file %s", fileNameAlter.Data()));
+            
+            MultContainerAlter = (AliOADBContainer*) foadbAlter->Get("MultSel");
+        }
         if(!MultContainerAlter) AliFatal(Form("OADB file %s does not contain OADBContainer named MultSel, stopping here", fileNameAlter.Data()));
         
         //Get Object for this run
@@ -2262,6 +2267,7 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
                 AliWarning("======================================================================");
                 AliWarning(Form(" MC Multiplicity OADB does not exist for run %d, will return kNoCalib!",fCurrentRun ));
                 AliWarning("======================================================================");
+                if ( fkUseOADBCache ) AliOADBCache::Release(fileNameAlter, "MultSel");
                 //Create an empty OADB for us, please !
                 CreateEmptyOADB();
                 //Set histo title for posterity
@@ -2291,6 +2297,7 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
             }
         }
         //Cleanup, please
+        if ( fkUseOADBCache ) AliOADBCache::Release(fileNameAlter, "MultSel");
         
         //That should be it...
     }
@@ -2378,6 +2385,7 @@ Int_t AliMultSelectionTask::SetupRunFromOADB(const AliVEvent* const esd)
     fOadbMultSelection = new AliOADBMultSelection(*lObjTypecast);
     // De-couple histograms from the underlying file
     fOadbMultSelection->Dissociate();
+    if ( fkUseOADBCache ) AliOADBCache::Release(fileName, "MultSel");
     // Update cache map from estimator to histogram for fast look-up
     fOadbMultSelection->Setup();
     
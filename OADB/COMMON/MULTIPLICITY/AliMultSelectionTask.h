@@ -134,6 +134,10 @@ public:
     void SetUseDefaultMCCalib ( Bool_t lVar ){ fkUseDefaultMCCalib = lVar; }
     Bool_t GetUseDefaultMCCalib () const { return fkUseDefaultMCCalib; }
     
+    //Read the OADB containers once per process through AliOADBCache
+    void SetUseOADBCache ( Bool_t lVar ){ fkUseOADBCache = lVar; }
+    Bool_t GetUseOADBCache () const { return fkUseOADBCache; }
+    
     void SetSkipVertexZ ( Bool_t lVar ){ fkSkipVertexZ = lVar; }
     Bool_t GetSkipVertexZ () const { return fkSkipVertexZ; }
 
@@ -179,6 +183,7 @@ private:
     //Default options
     Bool_t fkUseDefaultCalib; //if true, allow for default data calibration
     Bool_t fkUseDefaultMCCalib; //if true, allow for default scaling factor in MC
+    Bool_t fkUseOADBCache; //if true, get the OADB containers from AliOADBCache instead of opening the file at each run
     
     Bool_t fkSkipVertexZ; //if true, skip vertex-Z selection for evselcode determination
 
@@ -384,7 +389,7 @@ private:
     AliMultSelectionTask(const AliMultSelectionTask&);            // not implemented
     AliMultSelectionTask& operator=(const AliMultSelectionTask&); // not implemented
 
-    ClassDef(AliMultSelectionTask, 10);
+    ClassDef(AliMultSelectionTask, 11);
     //3 - extra QA histograms
     //8 - fOADB ponter
 };
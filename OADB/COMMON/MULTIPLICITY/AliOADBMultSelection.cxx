@@ -10,6 +10,7 @@
 #include "TObjString.h"
 #include "TBrowser.h"
 #include <TMap.h>
+#include <TMath.h>
 #include <TROOT.h>
 
 ClassImp(AliOADBMultSelection);
@@ -17,7 +18,8 @@ ClassImp(AliOADBMultSelection);
 //________________________________________________________________
 //Constructors/Destructor
 AliOADBMultSelection::AliOADBMultSelection() :
-TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0),
+fTableNBins(), fTableXmin(), fTableXmax(), fTableEdges(), fTableValues(), fTableData()
 {
     // constructor
     // fCalibList = new TList();
@@ -29,7 +31,8 @@ AliOADBMultSelection::AliOADBMultSelection(const AliOADBMultSelection& o)
 fCalibList(0),
 fEventCuts(0),
 fSelection(0),
-fMap(0)
+fMap(0),
+fTableNBins(), fTableXmin(), fTableXmax(), fTableEdges(), fTableValues(), fTableData()
 {
     fCalibList = new TList();
     fCalibList->SetOwner (kTRUE);
@@ -41,7 +44,8 @@ fMap(0)
 }
 //________________________________________________________________
 AliOADBMultSelection::AliOADBMultSelection(const char * name, const char * title) :
-TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0),
+fTableNBins(), fTableXmin(), fTableXmax(), fTableEdges(), fTableValues(), fTableData()
 {
     // constructor
     fCalibList = new TList();
@@ -231,13 +235,25 @@ void AliOADBMultSelection::Setup()
         delete fMap;
         fMap = 0;
     }
+    fTableNBins.clear();
+    fTableXmin.clear();
+    fTableXmax.clear();
+    fTableEdges.clear();
+    fTableValues.clear();
+    fTableData.clear();
     AliMultSelection* sel = GetMultSelection();
     if (!sel) return;
     
     fMap = new TMap;
     fMap->SetOwner(false);
     
-    for(Long_t iEst=0; iEst<sel->GetNEstimators(); iEst++) {
+    const Long_t lNEst = sel->GetNEstimators();
+    fTableNBins.assign(lNEst, 0);
+    fTableXmin.assign(lNEst, 0.);
+    fTableXmax.assign(lNEst, 0.);
+    fTableEdges.assign(lNEst, -1);
+    fTableValues.assign(lNEst, -1);
+    for(Long_t iEst=0; iEst<lNEst; iEst++) {
         AliMultEstimator* e = sel->GetEstimator(iEst);
         if (!e) continue;
         
@@ -246,7 +262,40 @@ void AliOADBMultSelection::Setup()
         if (!h) continue;
         
         fMap->Add(e, h);
+        
+        //Flat table: the percentile lookup becomes a few arithmetic operations
+        //(fixed bins) or a binary search (variable bins), without name lookups
+        const TAxis* ax = h->GetXaxis();
+        const Int_t  nb = ax->GetNbins();
+        fTableNBins[iEst] = nb;
+        fTableXmin[iEst]  = ax->GetXmin();
+        fTableXmax[iEst]  = ax->GetXmax();
+        if (ax->GetXbins()->GetSize()) {
+            fTableEdges[iEst] = fTableData.size();
+            for (Int_t i = 0; i <= nb; i++) fTableData.push_back(ax->GetXbins()->At(i));
+        }
+        fTableValues[iEst] = fTableData.size();
+        for (Int_t i = 0; i <= nb+1; i++) fTableData.push_back(h->GetBinContent(i));
+    }
+}
+//________________________________________________________________
+Float_t AliOADBMultSelection::GetPercentile(Long_t iEst, Double_t x) const
+{
+    if (iEst < 0 || iEst >= (Long_t) fTableNBins.size() || fTableNBins[iEst] == 0)
+        return AliMultSelectionCuts::kNoCalib;
+    //Same bin finding as TAxis::FindFixBin, NaN goes to the overflow
+    const Int_t nb = fTableNBins[iEst];
+    Int_t bin = 0;
+    if (x < fTableXmin[iEst]) {
+        bin = 0;
+    } else if (!(x < fTableXmax[iEst])) {
+        bin = nb+1;
+    } else if (fTableEdges[iEst] < 0) {
+        bin = 1 + int (nb*(x-fTableXmin[iEst])/(fTableXmax[iEst]-fTableXmin[iEst]));
+    } else {
+        bin = 1 + TMath::BinarySearch(nb+1, &fTableData[fTableEdges[iEst]], x);
     }
+    return fTableData[fTableValues[iEst]+bin];
 }
 
 
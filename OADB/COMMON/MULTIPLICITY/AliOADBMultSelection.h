@@ -2,6 +2,7 @@
 #define ALIOADBMULTSELECTION_H
 
 #include <TNamed.h>
+#include <vector>
 #include <AliMultSelection.h>
 class TBrowser;
 class TH1F;
@@ -39,6 +40,9 @@ public:
     //Use internal map
     void Setup();
     TH1F* FindHisto(AliMultEstimator* e);
+    //Percentile of estimator iEst for value x from the flat tables built by Setup,
+    //identical to GetBinContent(FindBin(x)) of its calibration histogram
+    Float_t GetPercentile(Long_t iEst, Double_t x) const;
     void Print(Option_t* option="") const;
     
 private:
@@ -46,7 +50,14 @@ private:
     AliMultSelectionCuts * fEventCuts; // EventCuts
     AliMultSelection     * fSelection; // Definition of Estimators
     TMap*                  fMap; //! Map estimator to histogram
-    ClassDef(AliOADBMultSelection, 1)
+    //Flat copies of the calibration histograms, per estimator index of fSelection
+    std::vector<Int_t>     fTableNBins;  //! number of bins, 0 if no calibration
+    std::vector<Double_t>  fTableXmin;   //! lower edge
+    std::vector<Double_t>  fTableXmax;   //! upper edge
+    std::vector<Int_t>     fTableEdges;  //! offset of the bin edges in fTableData, -1 for fixed bins
+    std::vector<Int_t>     fTableValues; //! offset of the bin contents (with under- and overflow) in fTableData
+    std::vector<Double_t>  fTableData;   //! bin edges and contents of all estimators
+    ClassDef(AliOADBMultSelection, 2)
     
     
 };
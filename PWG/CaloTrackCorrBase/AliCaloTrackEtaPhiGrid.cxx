@@ -0,0 +1,195 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+
+// --- C++ ---
+#include <algorithm>
+
+#include "AliCaloTrackEtaPhiGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(AliCaloTrackEtaPhiGrid) ;
+/// \endcond
+
+//______________________________________________________________
+/// Constructor.
+//______________________________________________________________
+AliCaloTrackEtaPhiGrid::AliCaloTrackEtaPhiGrid()
+: TObject(),
+  fCellSize(0.1),  fBuilt(kFALSE), fNEntries(0),
+  fNEta(0),        fNPhi(0),
+  fEtaMin(0),      fPhiMin(0),
+  fCellStart(),    fCellEntries(), fAlways()
+{
+}
+
+//______________________________________________________________
+/// Forget the index of the previous event.
+//______________________________________________________________
+void AliCaloTrackEtaPhiGrid::Reset()
+{
+  fBuilt    = kFALSE;
+  fNEntries = 0;
+  fNEta     = 0;
+  fNPhi     = 0;
+  fEtaMin   = 0;
+  fPhiMin   = 0;
+  fCellStart  .clear();
+  fCellEntries.clear();
+  fAlways     .clear();
+}
+
+//______________________________________________________________
+/// \return cell of coordinate x, clamped to the grid. Monotonous in x,
+/// so that all the entries in [xmin,xmax] are in the cells of xmin to xmax.
+//______________________________________________________________
+Int_t AliCaloTrackEtaPhiGrid::GetCell(Double_t x, Double_t min, Int_t n) const
+{
+  Double_t cell = (x - min) / fCellSize;
+  
+  if ( !(cell > 0) ) return 0;     // also NaN
+  if ( cell >= n   ) return n - 1;
+  
+  return (Int_t) cell;
+}
+
+//______________________________________________________________
+/// Sort the entries of a list in the eta-phi cells.
+/// \param nEntries: number of entries of the list.
+/// \param eta: pseudorapidity of each entry.
+/// \param phi: azimuthal angle of each entry.
+/// Entries with |eta| or |phi| larger than 10 or undefined (no eta-phi) are
+/// not put in the cells but returned by every selection.
+//______________________________________________________________
+void AliCaloTrackEtaPhiGrid::Build(Int_t nEntries, const Float_t * eta, const Float_t * phi)
+{
+  Reset();
+  
+  fNEntries = nEntries;
+  fBuilt    = kTRUE;
+  
+  if ( fCellSize <= 0 ) fCellSize = 0.1;
+  
+  // Grid range from the entries, far away or undefined values
+  // are kept out of the grid
+  std::vector<Bool_t> inGrid(nEntries, kFALSE);
+  Double_t etaMax = 0, phiMax = 0;
+  Int_t nValid = 0;
+  for(Int_t i = 0; i < nEntries; i++)
+  {
+    if ( !(TMath::Abs(eta[i]) < 10) || !(TMath::Abs(phi[i]) < 10) ) continue;
+    
+    inGrid[i] = kTRUE;
+    
+    if ( nValid == 0 || eta[i] < fEtaMin ) fEtaMin = eta[i];
+    if ( nValid == 0 || eta[i] > etaMax  ) etaMax  = eta[i];
+    if ( nValid == 0 || phi[i] < fPhiMin ) fPhiMin = phi[i];
+    if ( nValid == 0 || phi[i] > phiMax  ) phiMax  = phi[i];
+    nValid++;
+  }
+  
+  // No entry in the grid: empty grid, all the entries are always returned
+  if ( nValid == 0 )
+  {
+    for(Int_t i = 0; i < nEntries; i++) fAlways.push_back(i);
+    return;
+  }
+  
+  fNEta = (Int_t) ((etaMax - fEtaMin) / fCellSize) + 1;
+  fNPhi = (Int_t) ((phiMax - fPhiMin) / fCellSize) + 1;
+  
+  // Count, then fill the cells in increasing list index
+  std::vector<Int_t> cell(nEntries, -1);
+  fCellStart.assign(fNEta*fNPhi+1, 0);
+  for(Int_t i = 0; i < nEntries; i++)
+  {
+    if ( !inGrid[i] )
+    {
+      fAlways.push_back(i);
+      continue;
+    }
+    
+    cell[i] = GetCell(eta[i], fEtaMin, fNEta) * fNPhi + GetCell(phi[i], fPhiMin, fNPhi);
+    fCellStart[cell[i]+1]++;
+  }
+  
+  for(Int_t icell = 0; icell < fNEta*fNPhi; icell++)
+    fCellStart[icell+1] += fCellStart[icell];
+  
+  fCellEntries.resize(nValid);
+  std::vector<Int_t> next(fCellStart.begin(), fCellStart.end()-1);
+  for(Int_t i = 0; i < nEntries; i++)
+  {
+    if ( cell[i] >= 0 ) fCellEntries[next[cell[i]]++] = i;
+  }
+}
+
+//______________________________________________________________
+/// Add to indices the list indices of the entries in the cells overlapping
+/// the window etaMin < eta < etaMax, phiMin < phi < phiMax, and those without
+/// valid eta-phi. Call SortSelection() after the last window of a selection.
+//______________________________________________________________
+void AliCaloTrackEtaPhiGrid::Select(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax,
+                                    std::vector<Int_t> & indices) const
+{
+  indices.insert(indices.end(), fAlways.begin(), fAlways.end());
+  
+  if ( fNEta == 0 || etaMax < etaMin || phiMax < phiMin ) return;
+  
+  Int_t etaFirst = GetCell(etaMin, fEtaMin, fNEta);
+  Int_t etaLast  = GetCell(etaMax, fEtaMin, fNEta);
+  Int_t phiFirst = GetCell(phiMin, fPhiMin, fNPhi);
+  Int_t phiLast  = GetCell(phiMax, fPhiMin, fNPhi);
+  
+  for(Int_t ieta = etaFirst; ieta <= etaLast; ieta++)
+  {
+    // cells of consecutive phi are contiguous in fCellEntries
+    Int_t first = fCellStart[ieta*fNPhi + phiFirst  ];
+    Int_t last  = fCellStart[ieta*fNPhi + phiLast +1];
+    indices.insert(indices.end(), fCellEntries.begin()+first, fCellEntries.begin()+last);
+  }
+}
+
+//______________________________________________________________
+/// Same as Select() for a phi window taken modulo 2pi, for entries with
+/// phi in [0,2pi]: the parts of the window below 0 or above 2pi are
+/// selected at the other end of the phi range.
+//______________________________________________________________
+void AliCaloTrackEtaPhiGrid::SelectPeriodicPhi(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax,
+                                               std::vector<Int_t> & indices) const
+{
+  if ( phiMax - phiMin >= TMath::TwoPi() )
+  {
+    Select(etaMin, etaMax, -100, 100, indices);
+    return;
+  }
+  
+  Select(etaMin, etaMax, phiMin, phiMax, indices);
+  
+  if ( phiMin < 0              ) Select(etaMin, etaMax, phiMin + TMath::TwoPi(), 100, indices);
+  if ( phiMax > TMath::TwoPi() ) Select(etaMin, etaMax, -100, phiMax - TMath::TwoPi(), indices);
+}
+
+//______________________________________________________________
+/// Put the selected indices in increasing order, without duplicates
+/// (an entry can be selected by several windows).
+//______________________________________________________________
+void AliCaloTrackEtaPhiGrid::SortSelection(std::vector<Int_t> & indices)
+{
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
@@ -0,0 +1,90 @@
+#ifndef ALICALOTRACKETAPHIGRID_H
+#define ALICALOTRACKETAPHIGRID_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliCaloTrackEtaPhiGrid
+/// \ingroup CaloTrackCorrelationsBase
+/// \brief Binned eta-phi index of the tracks or clusters of the event.
+///
+/// The entries of one of the reader lists (CTS tracks, EMCal or PHOS clusters)
+/// are sorted in cells of fixed size in eta and phi. Select() returns the indices,
+/// in the list, of the entries in the cells overlapping a given eta-phi window,
+/// in increasing order, so that a loop over them visits the entries in the same
+/// order as the loop over the full list. SelectPeriodicPhi() takes the phi
+/// window modulo 2pi, for entries with phi in [0,2pi]. Entries without valid eta-phi
+/// (|eta| or |phi| >= 10 or undefined) are returned by every selection.
+///
+/// The index is built once per event by AliCaloTrackReader::GetEtaPhiGrid()
+/// and shared by all the analyses, e.g. for the isolation cone sums in AliIsolationCut.
+///
+/// \author Gustavo Conesa Balbastre <Gustavo.Conesa.Balbastre@cern.ch>, LPSC-IN2P3-CNRS
+//_________________________________________________________________________
+
+#include <vector>
+#include <TObject.h>
+
+class AliCaloTrackEtaPhiGrid : public TObject {
+  
+ public:
+  
+  AliCaloTrackEtaPhiGrid() ;
+  
+  /// Destructor
+  virtual ~AliCaloTrackEtaPhiGrid() { ; }
+  
+  void             Reset() ;
+  
+  void             Build(Int_t nEntries, const Float_t * eta, const Float_t * phi) ;
+  
+  void             Select(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax, std::vector<Int_t> & indices) const ;
+  
+  void             SelectPeriodicPhi(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax, std::vector<Int_t> & indices) const ;
+  
+  static void      SortSelection(std::vector<Int_t> & indices) ;
+  
+  Bool_t           IsBuilt()                         const { return fBuilt                 ; }
+  
+  Int_t            GetNEntries()                     const { return fNEntries              ; }
+  
+  Float_t          GetCellSize()                     const { return fCellSize              ; }
+  void             SetCellSize(Float_t size)               { fCellSize = size              ; }
+  
+ private:
+  
+  Int_t            GetCell(Double_t x, Double_t min, Int_t n) const ;
+  
+  Float_t          fCellSize ;            ///<  Size of the cells in eta and phi (rad).
+  
+  Bool_t           fBuilt ;               //!<! Index built for the current event.
+  
+  Int_t            fNEntries ;            //!<! Number of entries in the indexed list.
+  
+  Int_t            fNEta ;                //!<! Number of cells in eta.
+  
+  Int_t            fNPhi ;                //!<! Number of cells in phi.
+  
+  Double_t         fEtaMin ;              //!<! Lower eta edge of the first cell.
+  
+  Double_t         fPhiMin ;              //!<! Lower phi edge of the first cell.
+  
+  std::vector<Int_t> fCellStart ;         //!<! Position in fCellEntries of the first entry of each cell, size fNEta*fNPhi+1.
+  
+  std::vector<Int_t> fCellEntries ;       //!<! List indices sorted by cell, increasing in each cell.
+  
+  std::vector<Int_t> fAlways ;            //!<! List indices without valid eta-phi, returned by every selection.
+  
+  /// Copy constructor not implemented.
+  AliCaloTrackEtaPhiGrid(              const AliCaloTrackEtaPhiGrid & g) ;
+  
+  /// Assignment operator not implemented.
+  AliCaloTrackEtaPhiGrid & operator = (const AliCaloTrackEtaPhiGrid & g) ;
+  
+  /// \cond CLASSIMP
+  ClassDef(AliCaloTrackEtaPhiGrid,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALICALOTRACKETAPHIGRID_H
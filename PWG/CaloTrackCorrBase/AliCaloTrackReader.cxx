@@ -17,6 +17,8 @@
 #include <TFile.h>
 #include <TGeoManager.h>
 #include <TStreamerInfo.h>
+#include <TVector3.h>
+#include <vector>
 
 // ---- ANALYSIS system ----
 #include "AliMCEvent.h"
@@ -44,6 +46,8 @@
 // ---- CaloTrackCorr ---
 #include "AliCalorimeterUtils.h"
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiGrid.h"
+#include "AliCaloTrackParticle.h"
 #include "AliMCAnalysisUtils.h"
 
 // ---- Jets ----
@@ -135,7 +139,9 @@ fNonStandardJets(new TClonesArray("AliAODJet",100)),          fInputNonStandardJ
 fFillInputBackgroundJetBranch(kFALSE), 
 fBackgroundJets(0x0),fInputBackgroundJetBranchName("jets"),
 fAcceptEventsWithBit(0),     fRejectEventsWithBit(0),         fRejectEMCalTriggerEventsWith2Tresholds(0),
-fMomentum(),                 fOutputContainer(0x0),           
+fMomentum(),
+fUseEtaPhiGrid(kFALSE),      fEtaPhiGridCellSize(0.1),
+fOutputContainer(0x0),           
 fhEMCALClusterEtaPhi(0),     fhEMCALClusterEtaPhiFidCut(0),     
 fhEMCALClusterTimeE(0),
 fEnergyHistogramNbins(0),
@@ -146,6 +152,7 @@ fGenEventHeader(0),          fGenPythiaEventHeader(0)
   for(Int_t i = 0; i < 7; i++) fhPHOSClusterCutsE  [i]= 0x0 ;  
   for(Int_t i = 0; i < 6; i++) fhCTSTrackCutsPt    [i]= 0x0 ;    
   for(Int_t j = 0; j < 5; j++) { fMCGenerToAccept  [j] =  ""; fMCGenerIndexToAccept[j] = -1; }
+  for(Int_t i = 0; i < 3; i++) fEtaPhiGrid         [i]= 0x0 ;
   
   InitParameters();
 }
@@ -220,6 +227,8 @@ void AliCaloTrackReader::DeletePointers()
   }
   delete fBackgroundJets ;
 
+  for(Int_t i = 0; i < 3; i++) delete fEtaPhiGrid[i] ;
+  
   fRejectEventsWithBit.Reset();
   fAcceptEventsWithBit.Reset();
   
@@ -1181,6 +1190,87 @@ void AliCaloTrackReader::InitParameters()
   for(Int_t ism = 0; ism < 22; ism++) fScaleFactorPerSM[ism] = 1. ;    
 }
 
+//___________________________________________________________________________
+/// Eta-phi index of the EMCal clusters (detector = AliFiducialCut::kEMCAL),
+/// PHOS clusters (kPHOS) or CTS tracks (kCTS) of the event. It is built at
+/// the first request in the event and shared by all the analyses until
+/// ResetLists(). The eta and phi of the entries are calculated as in
+/// AliIsolationCut, clusters with respect to the vertex of their event.
+/// \return 0x0 if switched off or if the array is not available.
+//___________________________________________________________________________
+AliCaloTrackEtaPhiGrid * AliCaloTrackReader::GetEtaPhiGrid(Int_t detector)
+{
+  if ( !fUseEtaPhiGrid ) return 0x0;
+  
+  TObjArray * list = 0x0;
+  if      ( detector == AliFiducialCut::kEMCAL ) list = fEMCALClusters;
+  else if ( detector == AliFiducialCut::kPHOS  ) list = fPHOSClusters;
+  else if ( detector == AliFiducialCut::kCTS   ) list = fCTSTracks;
+  
+  if ( !list ) return 0x0;
+  
+  if ( !fEtaPhiGrid[detector] ) fEtaPhiGrid[detector] = new AliCaloTrackEtaPhiGrid();
+  
+  AliCaloTrackEtaPhiGrid * grid = fEtaPhiGrid[detector];
+  
+  // Rebuild if the array changed after the index was built
+  Int_t nEntries = list->GetEntries();
+  if ( grid->IsBuilt() && grid->GetNEntries() == nEntries ) return grid;
+  
+  // Entries without kinematics are out of the grid range, returned by every selection
+  std::vector<Float_t> eta(nEntries, 100.);
+  std::vector<Float_t> phi(nEntries, 100.);
+  TVector3 trackVector;
+  for(Int_t i = 0; i < nEntries; i++)
+  {
+    TObject * obj = list->At(i);
+    
+    if ( detector == AliFiducialCut::kCTS )
+    {
+      AliVTrack * track = dynamic_cast<AliVTrack*>(obj);
+      if ( track )
+      {
+        trackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+        eta[i] = trackVector.Eta();
+        phi[i] = trackVector.Phi();
+      }
+      else if ( AliCaloTrackParticle * trackmix = dynamic_cast<AliCaloTrackParticle*>(obj) )
+      {
+        eta[i] = trackmix->Eta();
+        phi[i] = trackmix->Phi();
+      }
+      else continue;
+    }
+    else
+    {
+      AliVCluster * calo = dynamic_cast<AliVCluster*>(obj);
+      if ( calo )
+      {
+        Int_t evtIndex = 0 ;
+        if ( fMixedEvent )
+          evtIndex = fMixedEvent->EventIndexForCaloCluster(calo->GetID()) ;
+        
+        calo->GetMomentum(fMomentum, fVertex[evtIndex]) ;
+        eta[i] = fMomentum.Eta();
+        phi[i] = fMomentum.Phi();
+      }
+      else if ( AliCaloTrackParticle * calomix = dynamic_cast<AliCaloTrackParticle*>(obj) )
+      {
+        eta[i] = calomix->Eta();
+        phi[i] = calomix->Phi();
+      }
+      else continue;
+    }
+    
+    if ( phi[i] < 0 ) phi[i] += TMath::TwoPi();
+  }
+  
+  grid->SetCellSize(fEtaPhiGridCellSize);
+  grid->Build(nEntries, nEntries > 0 ? &eta[0] : 0x0, nEntries > 0 ? &phi[0] : 0x0);
+  
+  return grid;
+}
+
 //__________________________________________________________________________
 /// Select the cluster depending on a time window, either a simple
 /// range or a parametrization depending on the energy.
@@ -3147,6 +3237,7 @@ void AliCaloTrackReader::Print(const Option_t * opt) const
   printf("    \n") ;
  
   printf("Write delta AOD =     %d\n",     fWriteOutputDeltaAOD) ;
+  printf("Eta-phi index   =     %d, cell size %2.2f\n", fUseEtaPhiGrid, fEtaPhiGridCellSize) ;
   printf("Recalculate Clusters = %d, E linearity = %d\n",    fRecalculateClusters, fCorrectELinearity) ;
   
   printf("Use Triggers selected in SE base class %d; If not what Trigger Mask? %d; MB Trigger Mask for mixed %d \n",
@@ -3284,6 +3375,11 @@ void AliCaloTrackReader::ResetLists()
   
   if(fNonStandardJets) fNonStandardJets -> Clear("C");
   fBackgroundJets->Reset();
+  
+  for(Int_t i = 0; i < 3; i++)
+  {
+    if ( fEtaPhiGrid[i] ) fEtaPhiGrid[i]->Reset();
+  }
 }
 
 //___________________________________________
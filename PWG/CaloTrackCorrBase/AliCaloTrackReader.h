@@ -52,6 +52,7 @@ class AliVCluster;
 // --- CaloTrackCorr / EMCAL ---
 #include "AliFiducialCut.h"
 class AliCalorimeterUtils;
+class AliCaloTrackEtaPhiGrid;
 #include "AliAnaWeights.h"
 #include "AliMCAnalysisUtils.h"
 
@@ -311,6 +312,15 @@ public:
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
   
+  // Eta-phi index of the arrays, shared by the analyses
+  
+  AliCaloTrackEtaPhiGrid * GetEtaPhiGrid(Int_t detector) ;
+  
+  Bool_t           IsEtaPhiGridOn()                  const { return fUseEtaPhiGrid         ; }
+  void             SwitchOnEtaPhiGrid()                    { fUseEtaPhiGrid = kTRUE        ; }
+  void             SwitchOffEtaPhiGrid()                   { fUseEtaPhiGrid = kFALSE       ; }
+  void             SetEtaPhiGridCellSize(Float_t size)     { fEtaPhiGridCellSize = size    ; }
+  
   //-------------------------------------
   // Event/track selection methods
   //-------------------------------------
@@ -990,6 +1000,10 @@ public:
   Bool_t           fRejectEMCalTriggerEventsWith2Tresholds; ///< Reject events EG2 also triggered by EG1 or EJ2 also triggered by EJ1.
   
   TLorentzVector   fMomentum;                      //!<! Temporal TLorentzVector container, avoid declaration of TLorentzVectors per event.
+  
+  Bool_t           fUseEtaPhiGrid;                 ///<  Build the eta-phi index of the tracks and clusters, see GetEtaPhiGrid(). Off by default.
+  Float_t          fEtaPhiGridCellSize;            ///<  Size of the cells of the eta-phi index, eta and phi (rad).
+  AliCaloTrackEtaPhiGrid * fEtaPhiGrid[3];         //!<! Eta-phi index of EMCal clusters, PHOS clusters and CTS tracks of the event.
     
   // cut control histograms
   
@@ -1024,7 +1038,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,82) ;
+  ClassDef(AliCaloTrackReader,83) ;
   /// \endcond
 
 } ;
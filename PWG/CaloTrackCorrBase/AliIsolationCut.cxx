@@ -27,6 +27,7 @@
 
 // --- CaloTrackCorrelations --- 
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiGrid.h"
 #include "AliCalorimeterUtils.h"
 #include "AliCaloPID.h"
 #include "AliFiducialCut.h"
@@ -89,7 +90,8 @@ fhFractionClusterOutConePhi(0),             fhFractionClusterOutConePhiTrigEtaPh
 fhFractionClusterOutConeEtaPhi(0),          fhFractionClusterOutConeEtaPhiTrigEtaPhi(0),
 fhConeSumPtUEBandSubClustervsTrack(0),       
 fhBandClustervsTrack(0),                    fhBandNormClustervsTrack(0),             
-fhConeSumPtTrackSubVsNoSub(0),              fhConeSumPtClusterSubVsNoSub(0)  
+fhConeSumPtTrackSubVsNoSub(0),              fhConeSumPtClusterSubVsNoSub(0),
+fGridSelection()
 {
   InitParameters();
 }
@@ -177,11 +179,25 @@ void AliIsolationCut::CalculateCaloSignalInCone
   TObjArray * refclusters  = 0x0;
   Int_t       nclusterrefs = 0;
   
+  // Loop only on the clusters in the cells of the event eta-phi index
+  // overlapping the cone and UE regions, in the same order as on the full array.
+  // Not for mixed events or references, or when all the clusters fill eta-phi histograms
+  //
+  AliCaloTrackEtaPhiGrid * grid = 0x0;
+  if ( !bgCls && !useRefs && !(fFillHistograms && fFillEtaPhiHistograms) )
+    grid = reader->GetEtaPhiGrid(calorimeter);
+  
+  if ( grid ) SelectFromEtaPhiGrid(grid, etaC, phiC, kFALSE);
+  
+  Int_t nclusters = grid ? (Int_t) fGridSelection.size() : plNe->GetEntries();
+  
   // Get the clusters
   //
   //printf("Loop calo\n");
-  for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+  for(Int_t isel = 0; isel < nclusters ; isel ++ )
   {
+    Int_t ipr = grid ? fGridSelection[isel] : isel ;
+    
     AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
     
     if ( calo )
@@ -490,12 +506,26 @@ void AliIsolationCut::CalculateTrackSignalInCone
   TObjArray * reftracks  = 0x0;
   Int_t       ntrackrefs = 0;
     
+  // Loop only on the tracks in the cells of the event eta-phi index
+  // overlapping the cone, UE bands and perpendicular cones, in the same order as on
+  // the full array. Not for mixed events or references, or when all the tracks fill eta-phi histograms
+  //
+  AliCaloTrackEtaPhiGrid * grid = 0x0;
+  if ( !bgTrk && !useRefs && !(fFillHistograms && fFillEtaPhiHistograms) )
+    grid = reader->GetEtaPhiGrid(AliFiducialCut::kCTS);
+  
+  if ( grid ) SelectFromEtaPhiGrid(grid, etaTrig, phiTrig, kTRUE);
+  
+  Int_t ntracks = grid ? (Int_t) fGridSelection.size() : plCTS->GetEntries();
+  
   //-----------------------------------------------------------
   // Get the tracks in cone
   //
   //-----------------------------------------------------------
-  for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+  for(Int_t isel = 0; isel < ntracks ; isel ++ )
   {
+    Int_t ipr = grid ? fGridSelection[isel] : isel ;
+    
     AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
     
     if(track)
@@ -750,6 +780,49 @@ void AliIsolationCut::CalculateTrackSignalInCone
   if ( bFillAOD && reftracks ) pCandidate->AddObjArray(reftracks);  
 }
 
+//_________________________________________________________________________________________________________________________________
+/// Select in the eta-phi index of the event the tracks or clusters in the cells
+/// overlapping the regions where they can contribute to the candidate sums:
+/// cone, and if UE subtraction, eta and phi bands and (tracks) perpendicular cones.
+/// The windows are slightly larger than the regions and taken modulo 2pi in phi,
+/// as the distance in Radius(), so that they are split at 0/2pi. The selection of
+/// each track or cluster in the loop is unchanged. Result in fGridSelection.
+///
+/// \param grid: eta-phi index of the tracks or clusters of the event.
+/// \param etaC: pseudorapidity of candidate particle.
+/// \param phiC: azimuthal angle of candidate particle, in [0,2pi].
+/// \param tracks: kTRUE for the tracks (phi band on the candidate side and perpendicular cones).
+//_________________________________________________________________________________________________________________________________
+void AliIsolationCut::SelectFromEtaPhiGrid(AliCaloTrackEtaPhiGrid * grid, Float_t etaC, Float_t phiC, Bool_t tracks)
+{
+  const Float_t margin = 0.001;
+  Float_t r = fConeSize + margin;
+  
+  fGridSelection.clear();
+  
+  // Cone
+  grid->SelectPeriodicPhi(etaC-r, etaC+r, phiC-r, phiC+r, fGridSelection);
+  
+  if ( fICMethod >= kSumBkgSubIC )
+  {
+    // Phi band, only half TPC with respect candidate for tracks
+    if ( tracks ) grid->SelectPeriodicPhi(etaC-r, etaC+r, phiC-TMath::PiOver2()-margin, phiC+TMath::PiOver2()+margin, fGridSelection);
+    else          grid->Select           (etaC-r, etaC+r, -100, 100, fGridSelection);
+    
+    // Eta band
+    grid->SelectPeriodicPhi(-100, 100, phiC-r, phiC+r, fGridSelection);
+  }
+  
+  // Perpendicular cones, +-90 degrees in phi
+  if ( tracks && fICMethod == kSumBkgSubIC )
+  {
+    grid->SelectPeriodicPhi(etaC-r, etaC+r, phiC+TMath::PiOver2()-r, phiC+TMath::PiOver2()+r, fGridSelection);
+    grid->SelectPeriodicPhi(etaC-r, etaC+r, phiC-TMath::PiOver2()-r, phiC-TMath::PiOver2()+r, fGridSelection);
+  }
+  
+  AliCaloTrackEtaPhiGrid::SortSelection(fGridSelection);
+}
+
 //_________________________________________________________________________________________________________________________________
 /// Get normalization of cluster background band.
 //_________________________________________________________________________________________________________________________________
@@ -20,6 +20,7 @@
 
 // --- ROOT system ---
 #include <TObject.h>
+#include <vector>
 class TObjArray ;
 class TList   ;
 #include <TLorentzVector.h>
@@ -27,6 +28,7 @@ class TList   ;
 // --- ANALYSIS system ---
 class AliCaloTrackParticleCorrelation ;
 class AliCaloTrackReader ;
+class AliCaloTrackEtaPhiGrid ;
 class AliCaloPID;
 class AliHistogramRanges;
 
@@ -99,6 +101,10 @@ class AliIsolationCut : public TObject {
                                         Float_t & etaBandPtSum, Float_t & phiBandPtSum, 
                                         Float_t & perpBandPtSum,Double_t  histoWeight = 1) ;
   
+  void       SelectFromEtaPhiGrid(AliCaloTrackEtaPhiGrid * grid, Float_t etaC, Float_t phiC, Bool_t tracks) ;
+  
+  const std::vector<Int_t> & GetEtaPhiGridSelection()    const { return fGridSelection      ; }
+  
   // Cone background studies medthods
 
   void       GetDetectorAngleLimits( AliCaloTrackReader * reader, Int_t calorimeter );
@@ -295,6 +301,8 @@ class AliIsolationCut : public TObject {
   TH2F *   fhConeSumPtTrackSubVsNoSub;                //!<! Tracks, UE band: sum pT in cone after bkg sub vs sum pT in cone before bkg sub
   TH2F *   fhConeSumPtClusterSubVsNoSub;              //!<! Clusters, UE band: sum pT in cone after bkg sub vs sum pT in cone before bkg sub
   
+  std::vector<Int_t> fGridSelection;                  //!<! Indices of the tracks or clusters selected in the eta-phi index for the current candidate.
+  
   /// Copy constructor not implemented.
   AliIsolationCut(              const AliIsolationCut & g) ;
 
@@ -302,7 +310,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,12) ;
+  ClassDef(AliIsolationCut,13) ;
   /// \endcond
 
 } ;
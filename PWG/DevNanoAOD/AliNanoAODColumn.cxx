@@ -0,0 +1,109 @@
+#include "AliNanoAODColumn.h"
+#include "TString.h"
+#include "TObjArray.h"
+#include "TObjString.h"
+#include "TTree.h"
+#include "AliVEvent.h"
+#include "AliLog.h"
+#include <cstring>
+
+ClassImp(AliNanoAODColumn)
+
+AliNanoAODColumn::AliNanoAODColumn() :
+  TNamed(),
+  fType(kFloat),
+  fN(0),
+  fNFloat(0),
+  fNInt(0),
+  fValues(0x0),
+  fValuesInt(0x0),
+  fCapacity(0)
+{
+  // default constructor
+}
+
+AliNanoAODColumn::AliNanoAODColumn(const char* name, EColumnType type) :
+  TNamed(name, name),
+  fType(type),
+  fN(0),
+  fNFloat(0),
+  fNInt(0),
+  fValues(0x0),
+  fValuesInt(0x0),
+  fCapacity(0)
+{
+  // constructor
+}
+
+AliNanoAODColumn::~AliNanoAODColumn()
+{
+  // destructor
+  delete[] fValues;
+  delete[] fValuesInt;
+}
+
+void AliNanoAODColumn::Clear(Option_t* /*opt*/)
+{
+  // reset the column for the next event, the allocated memory is kept
+  fN = 0;
+  fNFloat = 0;
+  fNInt = 0;
+}
+
+void AliNanoAODColumn::Reserve(Int_t n)
+{
+  // make room for at least n entries, keeping the existing ones
+  if (n <= fCapacity)
+    return;
+
+  if (fType == kFloat) {
+    Float_t* tmp = new Float_t[n];
+    if (fN > 0)
+      memcpy(tmp, fValues, fN * sizeof(Float_t));
+    delete[] fValues;
+    fValues = tmp;
+  } else {
+    Int_t* tmp = new Int_t[n];
+    if (fN > 0)
+      memcpy(tmp, fValuesInt, fN * sizeof(Int_t));
+    delete[] fValuesInt;
+    fValuesInt = tmp;
+  }
+  fCapacity = n;
+}
+
+void AliNanoAODColumn::WrongType(const char* method) const
+{
+  // called by the accessors of the other type, whose array is not allocated
+  AliFatal(Form("%s called on %s column %s", method, (fType == kFloat) ? "float" : "int", GetName()));
+}
+
+const AliNanoAODColumn* AliNanoAODColumn::GetColumn(const AliVEvent* event, const char* varName, const char* arrayName)
+{
+  // Returns the column of variable varName from the event, or 0x0 if not present.
+  // Call this once per event (or cache the pointer, it does not change between events) and not per track.
+  if (!event)
+    return 0x0;
+  return dynamic_cast<const AliNanoAODColumn*>(event->FindListObject(GetColumnName(arrayName, varName)));
+}
+
+void AliNanoAODColumn::SetActiveColumns(TTree* tree, const char* varList, const char* arrayName)
+{
+  // Switches off all the track columns in the tree except the ones in the comma separated varList.
+  // The baskets of the disabled branches are then never read nor decompressed.
+  if (!tree) {
+    AliErrorClass("No tree given");
+    return;
+  }
+
+  tree->SetBranchStatus(Form("%s_*", arrayName), 0);
+
+  TObjArray* vars = TString(varList).Tokenize(",");
+  TIter next(vars);
+  TObjString* var = 0;
+  while ((var = (TObjString*) next())) {
+    TString name = GetColumnName(arrayName, var->String().Strip(TString::kBoth).Data());
+    tree->SetBranchStatus(Form("%s*", name.Data()), 1);
+  }
+  delete vars;
+}
@@ -0,0 +1,75 @@
+/// \class AliNanoAODColumn
+/// \brief Per-event column of one NanoAOD track variable
+///
+/// Alternative, columnar, layout of the NanoAOD tracks written by
+/// AliNanoAODReplicator (see AliNanoAODReplicator::SetColumnarTracks).
+/// Each variable of the track mapping is stored as one object in the
+/// event, i.e. as its own branch in the AOD tree, containing the values
+/// of all the tracks of the event in a contiguous array.
+/// Analysis tasks get the column once per event and loop over the plain
+/// array, without any mapping lookup per track:
+///
+///     const AliNanoAODColumn* colPt = AliNanoAODColumn::GetColumn(fInputEvent, "pt");
+///     const Float_t* pt = colPt->GetValues();
+///     for (Int_t i = 0; i < colPt->GetN(); i++) if (pt[i] > 1) ...
+///
+/// Columns which are not needed can be switched off in the input tree
+/// with SetActiveColumns, so that their baskets are never read nor
+/// decompressed.
+
+#ifndef _ALINANOAODCOLUMN_H_
+#define _ALINANOAODCOLUMN_H_
+
+#include "TNamed.h"
+
+class TTree;
+class AliVEvent;
+
+class AliNanoAODColumn : public TNamed
+{
+public:
+  enum EColumnType { kFloat = 0, kInt };
+
+  AliNanoAODColumn();
+  AliNanoAODColumn(const char* name, EColumnType type);
+  virtual ~AliNanoAODColumn();
+
+  virtual void Clear(Option_t* opt = "");
+
+  EColumnType GetType() const { return (EColumnType) fType; }
+  Int_t GetN() const { return fN; }
+
+  // the float accessors are only valid for kFloat columns and the int ones for kInt columns, a wrong type is fatal
+  const Float_t* GetValues() const { CheckType(kFloat, "GetValues"); return fValues; }
+  const Int_t* GetValuesInt() const { CheckType(kInt, "GetValuesInt"); return fValuesInt; }
+  Float_t At(Int_t i) const { CheckType(kFloat, "At"); return fValues[i]; }
+  Int_t AtInt(Int_t i) const { CheckType(kInt, "AtInt"); return fValuesInt[i]; }
+
+  void Add(Float_t value) { CheckType(kFloat, "Add"); if (fN >= fCapacity) Expand(); fValues[fN] = value; fNFloat = ++fN; }
+  void AddInt(Int_t value) { CheckType(kInt, "AddInt"); if (fN >= fCapacity) Expand(); fValuesInt[fN] = value; fNInt = ++fN; }
+  void Reserve(Int_t n);
+
+  static TString GetColumnName(const char* arrayName, const char* varName) { return TString::Format("%s_%s", arrayName, varName); }
+  static const AliNanoAODColumn* GetColumn(const AliVEvent* event, const char* varName, const char* arrayName = "tracks");
+  static void SetActiveColumns(TTree* tree, const char* varList, const char* arrayName = "tracks");
+
+private:
+  AliNanoAODColumn(const AliNanoAODColumn&);
+  AliNanoAODColumn& operator=(const AliNanoAODColumn&);
+
+  void Expand() { Reserve(fCapacity > 0 ? 2 * fCapacity : 64); }
+  void CheckType(EColumnType type, const char* method) const { if (fType != type) WrongType(method); }
+  void WrongType(const char* method) const;
+
+  Char_t   fType;       ///< column type (EColumnType)
+  Int_t    fN;          ///< number of entries (tracks) in this event
+  Int_t    fNFloat;     ///< size of fValues (fN for float columns, 0 otherwise)
+  Int_t    fNInt;       ///< size of fValuesInt (fN for int columns, 0 otherwise)
+  Float_t* fValues;     //[fNFloat] values of a float column
+  Int_t*   fValuesInt;  //[fNInt] values of an int column
+  Int_t    fCapacity;   //! allocated size of the arrays
+
+  ClassDef(AliNanoAODColumn, 1)
+};
+
+#endif /* _ALINANOAODCOLUMN_H_ */
@@ -49,6 +49,7 @@ class AliAODRecoDecay;
 #include "TObjArray.h"
 #include "AliAnalysisFilter.h"
 #include "AliNanoAODTrack.h"
+#include "AliNanoAODColumn.h"
 
 #include <TFile.h>
 #include <TDatabasePDG.h>
@@ -108,6 +109,8 @@ AliAODBranchReplicator(),
   fSaveConversionPhotons(kFALSE),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
+  fColumnarTracks(kFALSE),
+  fTrackColumns(),
   fKeepDaughters(),
   fClonedVertices()
   {
@@ -145,6 +148,8 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title)
   fSaveConversionPhotons(kFALSE),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
+  fColumnarTracks(kFALSE),
+  fTrackColumns(),
   fKeepDaughters(),
   fClonedVertices()
 {
@@ -157,6 +162,8 @@ AliNanoAODReplicator::~AliNanoAODReplicator()
   // dtor
   delete fTrackCuts;
   delete fList;
+  if (fColumnarTracks)
+    delete fTracks; // not in fList in this case
 }
 
 //_____________________________________________________________________________
@@ -444,7 +451,14 @@ TList* AliNanoAODReplicator::GetList() const
 
       fTracks = new TClonesArray("AliNanoAODTrack");
       fTracks->SetName(fOutputArrayName.Data());
-      fList->Add(fTracks);
+      if (fColumnarTracks) {
+        // the tracks are kept internally (custom setters, MC relabeling) and only their columns are written
+        if (fSaveV0s || fSaveCascades)
+          AliFatal("Columnar track output cannot be used together with V0s or cascades, which need references to track objects");
+        CreateTrackColumns(fList);
+      } else {
+        fList->Add(fTracks);
+      }
 
       Int_t numberOfHeaderParam = 0;
       Int_t numberOfHeaderParamInt = 0;
@@ -749,6 +763,73 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   if ( fMCMode > 0 ) {
     FilterMC(source);      
   }
+
+  // Columnar layout: transpose the tracks into the per-variable columns (after the MC relabeling)
+  if (fColumnarTracks)
+    FillTrackColumns();
+}
+
+//_____________________________________________________________________________
+void AliNanoAODReplicator::CreateTrackColumns(TList* list) const
+{
+  // Create one column per track variable (float variables, int variables, label, flags)
+  // and add it to list, so that each variable ends up in its own branch.
+  // FillTrackColumns picks them up from the list of managed objects.
+
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance(fVarList);
+  
+  for (Int_t iVar = 0; iVar < mapping->GetSize(); iVar++)
+    list->Add(new AliNanoAODColumn(AliNanoAODColumn::GetColumnName(fOutputArrayName, mapping->GetVarName(iVar)), AliNanoAODColumn::kFloat));
+  for (Int_t iVar = 0; iVar < mapping->GetSizeInt(); iVar++)
+    list->Add(new AliNanoAODColumn(AliNanoAODColumn::GetColumnName(fOutputArrayName, mapping->GetVarNameInt(iVar)), AliNanoAODColumn::kInt));
+  list->Add(new AliNanoAODColumn(AliNanoAODColumn::GetColumnName(fOutputArrayName, "label"), AliNanoAODColumn::kInt));
+  list->Add(new AliNanoAODColumn(AliNanoAODColumn::GetColumnName(fOutputArrayName, "nanoflags"), AliNanoAODColumn::kInt));
+}
+
+//_____________________________________________________________________________
+void AliNanoAODReplicator::FillTrackColumns()
+{
+  // Copy the variables of the stored tracks into the columns, one variable at a time
+
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance();
+  const Int_t nVars = mapping->GetSize();
+  const Int_t nVarsInt = mapping->GetSizeInt();
+  const Int_t nTracks = fTracks->GetEntriesFast();
+  
+  if (fTrackColumns.empty()) {
+    // same order as in CreateTrackColumns
+    TIter next(fList);
+    TObject* obj = 0;
+    while ((obj = next()))
+      if (obj->InheritsFrom(AliNanoAODColumn::Class()))
+        fTrackColumns.push_back(static_cast<AliNanoAODColumn*>(obj));
+    if ((Int_t) fTrackColumns.size() != nVars + nVarsInt + 2)
+      AliFatal(Form("%d track columns in the output, expected %d", (Int_t) fTrackColumns.size(), nVars + nVarsInt + 2));
+  }
+  
+  for (UInt_t iCol = 0; iCol < fTrackColumns.size(); iCol++) {
+    fTrackColumns[iCol]->Clear();
+    fTrackColumns[iCol]->Reserve(nTracks);
+  }
+  
+  for (Int_t iVar = 0; iVar < nVars; iVar++) {
+    AliNanoAODColumn* column = fTrackColumns[iVar];
+    for (Int_t i = 0; i < nTracks; i++)
+      column->Add(static_cast<AliNanoAODTrack*>(fTracks->UncheckedAt(i))->GetVar(iVar));
+  }
+  for (Int_t iVar = 0; iVar < nVarsInt; iVar++) {
+    AliNanoAODColumn* column = fTrackColumns[nVars + iVar];
+    for (Int_t i = 0; i < nTracks; i++)
+      column->AddInt(static_cast<AliNanoAODTrack*>(fTracks->UncheckedAt(i))->GetVarInt(iVar));
+  }
+  
+  AliNanoAODColumn* labels = fTrackColumns[nVars + nVarsInt];
+  AliNanoAODColumn* flags = fTrackColumns[nVars + nVarsInt + 1];
+  for (Int_t i = 0; i < nTracks; i++) {
+    AliNanoAODTrack* track = static_cast<AliNanoAODTrack*>(fTracks->UncheckedAt(i));
+    labels->AddInt(track->GetLabel());
+    flags->AddInt((Int_t) track->GetNanoFlags());
+  }
 }
 
 void AliNanoAODReplicator::Terminate()
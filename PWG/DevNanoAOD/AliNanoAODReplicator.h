@@ -52,6 +52,7 @@ class AliNanoAODTrack;
 class AliAODTrack;
 class AliNanoAODCustomSetter;
 class AliAODZDC;
+class AliNanoAODColumn;
 
 class AliNanoAODReplicator : public AliAODBranchReplicator
 {
@@ -92,6 +93,8 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void SetOutputArrayName(TString name) {fOutputArrayName=name;}
 
   void SetVarListHeaderTC(TString var) {fVarListHeader_fTC=var;}
+
+  void SetColumnarTracks(Bool_t b) { fColumnarTracks = b; }
     
  private:
 
@@ -101,6 +104,8 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   Int_t GetNewLabel(Int_t i);
   void FilterMC(const AliAODEvent& source);
   AliAODVertex* CloneAndStoreVertex(AliAODVertex* toClone);
+  void CreateTrackColumns(TList* list) const;
+  void FillTrackColumns();
  
   AliAnalysisCuts* fTrackCuts; // decides which tracks to keep
   AliAnalysisCuts* fV0Cuts;    // decides which V0s to keep
@@ -141,6 +146,9 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
 
   TString fInputArrayName; // name of array if tracks are stored in a TObjectArray
   TString fOutputArrayName; // name of the output array, where the NanoAODTracks are stored
+
+  Bool_t fColumnarTracks; // if kTRUE tracks are written as one AliNanoAODColumn per variable instead of a TClonesArray of AliNanoAODTrack
+  std::vector<AliNanoAODColumn*> fTrackColumns; //! float variables, int variables, label, flags (owned by fList)
   
   std::map<AliAODVertex*, std::vector<TObject*> > fKeepDaughters; //! Tracks needed as references to V0s and cascades
   std::map<AliAODVertex*, AliAODVertex*> fClonedVertices; //! avoid that vertices are stored several times
@@ -148,7 +156,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
 
-  ClassDef(AliNanoAODReplicator, 6) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator, 7) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
@@ -19,6 +19,7 @@
 #pragma link C++ class AliNanoAODSimpleSetterCRCZDC+;
 #pragma link C++ class AliNanoAODSimpleSetterJet+;
 #pragma link C++ class AliNanoAODTrackMapping+;
+#pragma link C++ class AliNanoAODColumn+;
 #pragma link C++ class AliAnalysisTaskNanoSimple;
 #pragma link C++ class AliAnalysisTaskNanoValidator;
 
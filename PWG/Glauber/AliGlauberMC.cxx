@@ -32,6 +32,10 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TF1.h>
+#include <TRandom3.h>
+#if __cplusplus >= 201103L
+#include <thread>
+#endif
 
 #include "AliGlauberNucleon.h"
 #include "AliGlauberNucleus.h"
@@ -40,6 +44,11 @@
 using std::flush;
 ClassImp(AliGlauberMC)
 
+namespace {
+  const Int_t kNtupleValues = 48;   // variables of the ntuple filled by Run
+  const Int_t kStreamEvents = 1000; // events generated from one random seed by the parallel Run
+}
+
 //______________________________________________________________________________
 AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   TNamed(),
@@ -172,7 +181,14 @@ AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   fOmega(0),
   fSig0(0),
   fLambda(0),
-  fSigFluc(0)
+  fSigFluc(0),
+  fSigFlucTable(),
+  fNThreads(1),
+  fRandom(0),
+  fCollXA(),
+  fCollYA(),
+  fCollD2A(),
+  fCollNA()
 {
   //ctor
   for (UInt_t i=0; i<(sizeof(fdNdEtaParam)/sizeof(fdNdEtaParam[0])); i++)
@@ -322,7 +338,14 @@ AliGlauberMC::AliGlauberMC(const AliGlauberMC& in):
   fOmega(in.fOmega),
   fSig0(in.fSig0),
   fLambda(in.fLambda),
-  fSigFluc(in.fSigFluc)
+  fSigFluc(in.fSigFluc),
+  fSigFlucTable(in.fSigFlucTable),
+  fNThreads(in.fNThreads),
+  fRandom(in.fRandom),
+  fCollXA(),
+  fCollYA(),
+  fCollD2A(),
+  fCollNA()
 {
   //copy ctor
   memcpy(fdNdEtaParam,in.fdNdEtaParam,sizeof(fdNdEtaParam));
@@ -453,6 +476,7 @@ AliGlauberMC& AliGlauberMC::operator=(const AliGlauberMC& in)
   fSxyCom=in.fSxyCom;
   fX=in.fX;
   fNpp=in.fNpp;
+  fNThreads=in.fNThreads;
   return *this;
 }
 
@@ -461,13 +485,8 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
 {
   // prepare event
 
-  if (fDoFluc) {
-    if (!fSigFluc) {
-      fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
-      fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
-      cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
-    }
-  }
+  if (fDoFluc) InitSigFluc();
+  TRandom *rnd = GetRandom();
 
   fANucleus.ThrowNucleons(-bgen/2.);
   fNucleonsA = fANucleus.GetNucleons();
@@ -480,7 +499,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonA->SetInNucleusA();
     nucleonA->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonA->SetSigNN(fSigFluc->GetRandom());
+      nucleonA->SetSigNN(fSigFlucTable.Sample(rnd->Rndm()));
   }
   fBNucleus.ThrowNucleons(bgen/2.);
   fNucleonsB = fBNucleus.GetNucleons();
@@ -493,50 +512,73 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonB->SetInNucleusB();
     nucleonB->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonB->SetSigNN(fSigFluc->GetRandom());
+      nucleonB->SetSigNN(fSigFlucTable.Sample(rnd->Rndm()));
   }
 
-  if (fDoFluc) {
-    if (!fSigFluc) {
-      fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
-      fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
-      cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
-    }
-    fXSect = fSigFluc->GetRandom();
-  }
+  if (fDoFluc)
+    fXSect = fSigFlucTable.Sample(rnd->Rndm());
   // "ball" diameter = distance at which two balls interact
   Double_t d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
 
+  // Nucleons of A as plain arrays, so that the loop on the pairs below has no object
+  // access nor branch and can be vectorized. With fluctuations, a pair interacts within the
+  // distance of the larger sigNN of the two, i.e. d2 = max(d2 of A, d2 of B).
+  if (fAN==0 || fBN==0) {
+    fNcollw = 0;
+    fBNN    = 0.;
+    return CalcResults(bgen);
+  }
+  fCollXA.resize(fAN);
+  fCollYA.resize(fAN);
+  fCollD2A.resize(fAN);
+  fCollNA.resize(fAN);
+  for (Int_t j = 0; j<fAN; j++)
+  {
+    AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
+    fCollXA[j]  = nucleonA->GetX();
+    fCollYA[j]  = nucleonA->GetY();
+    fCollD2A[j] = fDoFluc ? (Double_t)nucleonA->GetSigNN()/(TMath::Pi()*10) : d2;
+    fCollNA[j]  = 0;
+  }
+  const Double_t *xA  = &fCollXA[0];
+  const Double_t *yA  = &fCollYA[0];
+  const Double_t *d2A = &fCollD2A[0];
+  Int_t *ncollA = &fCollNA[0];
+
   Double_t bNN   = 0;
-  Double_t Nco   = 0;
-  Double_t Ncohc = 0; // hard core
+  Int_t    Nco   = 0;
+  Int_t    Ncohc = 0; // hard core
 
   // for each of the A nucleons in nucleus B
   for (Int_t i = 0; i<fBN; i++)
   {
     AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
+    const Double_t xB  = nucleonB->GetX();
+    const Double_t yB  = nucleonB->GetY();
+    const Double_t d2B = fDoFluc ? (Double_t)nucleonB->GetSigNN()/(TMath::Pi()*10) : d2;
+    Int_t ncollB = 0;
     for (Int_t j = 0 ; j < fAN ; j++)
     {
-      AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
-      Double_t dx = nucleonB->GetX()-nucleonA->GetX();
-      Double_t dy = nucleonB->GetY()-nucleonA->GetY();
-      Double_t dij = dx*dx+dy*dy;
-      if (fDoFluc) {
-	//fXSect = nucleonA->GetSigNN();
-	//fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
-	fXSect = TMath::Max(nucleonA->GetSigNN(),nucleonB->GetSigNN());
-	d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
-      }
-      if (dij < d2)
-      {
-	bNN += dij;
-	++Nco;
-        nucleonB->Collide();
-        nucleonA->Collide();
-	if (dij<d2/4)
-	  ++Ncohc;
-      }
+      const Double_t dx   = xB-xA[j];
+      const Double_t dy   = yB-yA[j];
+      const Double_t dij  = dx*dx+dy*dy;
+      const Double_t d2AB = (d2A[j]>=d2B) ? d2A[j] : d2B;
+      const Int_t    hit  = (dij < d2AB);
+      ncollA[j] += hit;
+      ncollB    += hit;
+      Ncohc     += (dij < d2AB/4);
+      bNN       += hit ? dij : 0.;
     }
+    nucleonB->Collide(ncollB);
+    Nco += ncollB;
+  }
+  for (Int_t j = 0; j<fAN; j++)
+    ((AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j)))->Collide(ncollA[j]);
+
+  if (fDoFluc) {
+    // as the pair loop used to leave it: the sigNN of the last pair
+    fXSect = TMath::Max(((AliGlauberNucleon*)(fNucleonsA->UncheckedAt(fAN-1)))->GetSigNN(),
+                        ((AliGlauberNucleon*)(fNucleonsB->UncheckedAt(fBN-1)))->GetSigNN());
   }
 
   if (Nco>0) {
@@ -546,14 +588,27 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     fNcollw = 0;
     fBNN    = 0.;
   }
-
-  if (Nco>0)
-    fBNN = bNN/Nco;
-  else
-    fBNN = 0.;
   return CalcResults(bgen);
 }
 
+//______________________________________________________________________________
+void AliGlauberMC::InitSigFluc()
+{
+  // tabulates the sigNN distribution, once per SetDoFluc
+  if (fSigFlucTable.IsValid()) return;
+  if (!fSigFluc)
+    fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
+  fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
+  cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
+  fSigFlucTable.Tabulate(fSigFluc);
+}
+
+//______________________________________________________________________________
+TRandom* AliGlauberMC::GetRandom() const
+{
+  return fRandom ? fRandom : gRandom;
+}
+
 //______________________________________________________________________________
 Bool_t AliGlauberMC::CalcResults(Double_t bgen)
 {
@@ -1267,7 +1322,7 @@ Int_t AliGlauberMC::NegativeBinomialRandom(Int_t k, Double_t nmean) const
   {
     array[i] = NegativeBinomialDistribution(i,k,nmean) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandom()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 
 }
@@ -1278,7 +1333,7 @@ Int_t AliGlauberMC::NegativeBinomialRandomSV(Double_t k, Double_t nbar) const
   // negative binomial distribution generator, S. Voloshin, 09-May-2007
   Double_t sum=0.;
   Int_t i=0;
-  Double_t ran=gRandom->Rndm();
+  Double_t ran=GetRandom()->Rndm();
   Double_t trm=1./pow(1.+nbar/k,k);
   if (trm==0.)
   {
@@ -1308,7 +1363,7 @@ Int_t AliGlauberMC::DoubleNegativeBinomialRandom( Int_t k,
   {
     array[i] = alpha*NegativeBinomialDistribution(i,k,nmean)+(1-alpha)*NegativeBinomialDistribution(i,k2,nmean2) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandom()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 }
 
@@ -1506,7 +1561,7 @@ Bool_t AliGlauberMC::NextEvent(Double_t bgen)
   {
     if(bgen<0||!succes) //get impactparameter
     {
-      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*gRandom->Rndm()+fBMin*fBMin);
+      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*GetRandom()->Rndm()+fBMin*fBMin);
     }
     if ( (succes=CalcEvent(bgen)) ) break; //ends if we have particparts
   }
@@ -1694,6 +1749,19 @@ void AliGlauberMC::Run(Int_t nevents)
                       "Npart:Ncoll:B:MeanX:MeanY:MeanX2:MeanY2:MeanXY:VarX:VarY:VarXY:MeanXSystem:MeanYSystem:MeanXA:MeanYA:MeanXB:MeanYB:VarE:Stoa:VarEColl:VarECom:VarEPart:VarEPartColl:VarEPartCom:dNdEta:dNdEtaGBW:dNdEtaTwoNBD:xsect:tAA:Epsl2:Epsl3:Epsl4:Epsl5:E2Coll:E3Coll:E4Coll:E5Coll:E2Com:E3Com:E4Com:E5Com:Psi2:Psi3:Psi4:Psi5:BNN:signn:Ncollw");
     fnt->SetDirectory(0);
   }
+  if (fNThreads!=1)
+  {
+    Int_t nThreads = fNThreads;
+#if __cplusplus >= 201103L
+    if (nThreads<=0) nThreads = std::thread::hardware_concurrency();
+#else
+    nThreads = 1;
+#endif
+    if (nThreads<1) nThreads = 1;
+    RunParallel(nevents,nThreads);
+    return;
+  }
+
   Int_t q = 0;
   Int_t u = 0;
   for (Int_t i = 0; i<nevents; i++)
@@ -1706,68 +1774,8 @@ void AliGlauberMC::Run(Int_t nevents)
     }
 
     q++;
-    Float_t v[48];
-    v[0]  = GetNpart();
-    v[1]  = GetNcoll();
-    v[2]  = fBMC;
-    v[3]  = fMeanXParts;
-    v[4]  = fMeanYParts;
-    v[5]  = fMeanX2Parts;
-    v[6]  = fMeanY2Parts;
-    v[7]  = fMeanXYParts;
-    v[8]  = fSx2Parts;
-    v[9]  = fSy2Parts;
-    v[10] = fSxyParts;
-    v[11] = fMeanXSystem;
-    v[12] = fMeanYSystem;
-    v[13] = fMeanXA;
-    v[14] = fMeanYA;
-    v[15] = fMeanXB;
-    v[16] = fMeanYB;
-    v[17] = GetEccentricity();
-    v[18] = GetStoa();
-    v[19] = GetEccentricityColl();
-    v[20] = GetEccentricityCom();
-    v[21] = GetEccentricityPart();
-    v[22] = GetEccentricityPartColl();
-    v[23] = GetEccentricityPartCom();
-    if (fDoPartProd)
-    {
-      v[24] = GetdNdEta();
-      v[25] = GetdNdEta();
-      v[26] = v[24]+v[25];
-    }
-    else
-    {
-      v[24] = 0;
-      v[25] = 0;
-      v[26] = 0;
-    }
-    v[27]=fXSect;
-
-    Float_t mytAA=-999;
-    if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
-    v[28]=mytAA;
-    //_____________epsilon2,3,4,4_______
-    v[29] = GetEpsilon2Part();
-    v[30] = GetEpsilon3Part();
-    v[31] = GetEpsilon4Part();
-    v[32] = GetEpsilon5Part();
-    v[33] = GetEpsilon2Coll();
-    v[34] = GetEpsilon3Coll();
-    v[35] = GetEpsilon4Coll();
-    v[36] = GetEpsilon5Coll();
-    v[37] = GetEpsilon2Com();
-    v[38] = GetEpsilon3Com();
-    v[39] = GetEpsilon4Com();
-    v[40] = GetEpsilon5Com();
-    v[41] = GetPsi2();
-    v[42] = GetPsi3();
-    v[43] = GetPsi4();
-    v[44] = GetPsi5();
-    v[45] = fBNN;
-    v[46] = fXSect;
-    v[47] = fNcollw;
+    Float_t v[kNtupleValues];
+    GetNtupleValues(v);
 
     //always at the end
     fnt->Fill(v);
@@ -1777,6 +1785,190 @@ void AliGlauberMC::Run(Int_t nevents)
   std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
 }
 
+//______________________________________________________________________________
+void AliGlauberMC::GetNtupleValues(Float_t *v) const
+{
+  //values of the ntuple for the current event
+  v[0]  = GetNpart();
+  v[1]  = GetNcoll();
+  v[2]  = fBMC;
+  v[3]  = fMeanXParts;
+  v[4]  = fMeanYParts;
+  v[5]  = fMeanX2Parts;
+  v[6]  = fMeanY2Parts;
+  v[7]  = fMeanXYParts;
+  v[8]  = fSx2Parts;
+  v[9]  = fSy2Parts;
+  v[10] = fSxyParts;
+  v[11] = fMeanXSystem;
+  v[12] = fMeanYSystem;
+  v[13] = fMeanXA;
+  v[14] = fMeanYA;
+  v[15] = fMeanXB;
+  v[16] = fMeanYB;
+  v[17] = GetEccentricity();
+  v[18] = GetStoa();
+  v[19] = GetEccentricityColl();
+  v[20] = GetEccentricityCom();
+  v[21] = GetEccentricityPart();
+  v[22] = GetEccentricityPartColl();
+  v[23] = GetEccentricityPartCom();
+  if (fDoPartProd)
+  {
+    v[24] = GetdNdEta();
+    v[25] = GetdNdEta();
+    v[26] = v[24]+v[25];
+  }
+  else
+  {
+    v[24] = 0;
+    v[25] = 0;
+    v[26] = 0;
+  }
+  v[27]=fXSect;
+
+  Float_t mytAA=-999;
+  if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
+  v[28]=mytAA;
+  //_____________epsilon2,3,4,4_______
+  v[29] = GetEpsilon2Part();
+  v[30] = GetEpsilon3Part();
+  v[31] = GetEpsilon4Part();
+  v[32] = GetEpsilon5Part();
+  v[33] = GetEpsilon2Coll();
+  v[34] = GetEpsilon3Coll();
+  v[35] = GetEpsilon4Coll();
+  v[36] = GetEpsilon5Coll();
+  v[37] = GetEpsilon2Com();
+  v[38] = GetEpsilon3Com();
+  v[39] = GetEpsilon4Com();
+  v[40] = GetEpsilon5Com();
+  v[41] = GetPsi2();
+  v[42] = GetPsi3();
+  v[43] = GetPsi4();
+  v[44] = GetPsi5();
+  v[45] = fBNN;
+  v[46] = fXSect;
+  v[47] = fNcollw;
+}
+
+//______________________________________________________________________________
+AliGlauberMC* AliGlauberMC::CreateWorker() const
+{
+  //generator with the same settings and its own nuclei, for one thread of RunParallel
+  AliGlauberMC *worker = new AliGlauberMC(fANucleus.GetName(),fBNucleus.GetName(),fXSect);
+  worker->fANucleus = fANucleus;
+  worker->fBNucleus = fBNucleus;
+  worker->fBMin = fBMin;
+  worker->fBMax = fBMax;
+  worker->fMultType = fMultType;
+  memcpy(worker->fdNdEtaParam,fdNdEtaParam,sizeof(fdNdEtaParam));
+  worker->fX = fX;
+  worker->fNpp = fNpp;
+  worker->fDoPartProd = fDoPartProd;
+  worker->fDoFluc = fDoFluc;
+  worker->fOmega = fOmega;
+  worker->fSig0 = fSig0;
+  worker->fLambda = fLambda;
+  worker->fSigFlucTable = fSigFlucTable;
+  return worker;
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::GenerateEvents(Int_t nevents, UInt_t seed, std::vector<Float_t> *values, Int_t *nFailed)
+{
+  //one stream of RunParallel: nevents events from fRandom started with seed,
+  //the ntuple values of the successful events are stored in values
+  fRandom->SetSeed(seed);
+  values->clear();
+  *nFailed = 0;
+  Float_t v[kNtupleValues];
+  for (Int_t i = 0; i<nevents; i++)
+  {
+    if (!NextEvent())
+    {
+      (*nFailed)++;
+      continue;
+    }
+    GetNtupleValues(v);
+    values->insert(values->end(),v,v+kNtupleValues);
+  }
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::RunParallel(Int_t nevents, Int_t nThreads)
+{
+  //Run on nThreads threads: the events are generated in streams of kStreamEvents events,
+  //each one started with its own seed drawn from gRandom, and nThreads streams are run
+  //at a time, each by a copy of this generator with its own TRandom3. The ntuple is
+  //filled in the order of the streams, so that for a given gRandom seed the output does
+  //not depend on the number of threads.
+
+  const Int_t nStreams = (nevents+kStreamEvents-1)/kStreamEvents;
+  // seed 0 would mean a time-dependent seed in TRandom3
+  std::vector<UInt_t> seeds(nStreams);
+  for (Int_t iStream = 0; iStream<nStreams; iStream++)
+    seeds[iStream] = 1+gRandom->Integer(kMaxUInt-1);
+  if (nThreads>nStreams) nThreads = TMath::Max(nStreams,1);
+
+  // the tables and the generators are made here, the threads do not create any ROOT object
+  fANucleus.Init();
+  fBNucleus.Init();
+  if (fDoFluc) InitSigFluc();
+  std::vector<AliGlauberMC*> workers(nThreads);
+  std::vector<TRandom3*> random(nThreads);
+  for (Int_t iThread = 0; iThread<nThreads; iThread++)
+  {
+    workers[iThread] = CreateWorker();
+    workers[iThread]->fANucleus.Init();
+    workers[iThread]->fBNucleus.Init();
+    random[iThread] = new TRandom3(1);
+    workers[iThread]->SetRandom(random[iThread]);
+  }
+  std::vector<std::vector<Float_t> > values(nThreads);
+  std::vector<Int_t> nFailed(nThreads);
+
+  Int_t q = 0;
+  Int_t u = 0;
+  for (Int_t first = 0; first<nStreams; first += nThreads)
+  {
+    const Int_t nRound = TMath::Min(nThreads,nStreams-first);
+#if __cplusplus >= 201103L
+    std::vector<std::thread> threads;
+    for (Int_t iThread = 1; iThread<nRound; iThread++)
+    {
+      const Int_t iStream = first+iThread;
+      threads.push_back(std::thread(&AliGlauberMC::GenerateEvents,workers[iThread],
+                                    TMath::Min(kStreamEvents,nevents-iStream*kStreamEvents),seeds[iStream],
+                                    &values[iThread],&nFailed[iThread]));
+    }
+#endif
+    workers[0]->GenerateEvents(TMath::Min(kStreamEvents,nevents-first*kStreamEvents),seeds[first],&values[0],&nFailed[0]);
+#if __cplusplus >= 201103L
+    for (UInt_t iThread = 0; iThread<threads.size(); iThread++) threads[iThread].join();
+#endif
+    for (Int_t iThread = 0; iThread<nRound; iThread++)
+    {
+      for (UInt_t iValue = 0; iValue<values[iThread].size(); iValue += kNtupleValues)
+        fnt->Fill(&values[iThread][iValue]);
+      q += values[iThread].size()/kNtupleValues;
+      u += nFailed[iThread];
+    }
+    std::cout << "Generating Event # " << TMath::Min(nevents,(first+nRound)*kStreamEvents) << "... \r" << flush;
+  }
+
+  for (Int_t iThread = 0; iThread<nThreads; iThread++)
+  {
+    fEvents += workers[iThread]->fEvents;
+    fTotalEvents += workers[iThread]->fTotalEvents;
+    fMaxNpartFound = TMath::Max(fMaxNpartFound,workers[iThread]->fMaxNpartFound);
+    delete workers[iThread];
+    delete random[iThread];
+  }
+  std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u
+            << "  (" << nThreads << " threads, " << nStreams << " streams)." << endl;
+}
+
 //---------------------------------------------------------------------------------
 void AliGlauberMC::RunAndSaveNtuple( Int_t n,
                                      const Option_t *sysA,
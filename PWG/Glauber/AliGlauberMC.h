@@ -14,11 +14,14 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "AliGlauberNucleus.h"
+#include "AliGlauberSampler.h"
 #include <Riostream.h>
 #include <TNamed.h>
+#include <vector>
 
 class TObjArray;
 class TNtuple;
+class TRandom;
 
 using std::cout;
 using std::endl;
@@ -39,6 +42,8 @@ public:
    void         Draw(Option_t* option);
 
    void         Run(Int_t nevents);
+   void         SetNThreads(Int_t n=0) {fNThreads=n;} // threads used by Run, 0 = all available cores
+   void         SetRandom(TRandom *r)  {fRandom=r; fANucleus.SetRandom(r); fBNucleus.SetRandom(r);}
    Bool_t       NextEvent(Double_t bgen=-1);
    Bool_t       CalcEvent(Double_t bgen);
 
@@ -99,7 +104,7 @@ public:
    void   Setr(Double_t r)  {fANucleus.SetR(r); fBNucleus.SetR(r);}
    void   Seta(Double_t a)  {fANucleus.SetA(a); fBNucleus.SetA(a);}
    void   SetDoFluc(Double_t omega, Double_t sig0, Double_t lam, Bool_t on=kTRUE) 
-            {fDoFluc=on;fOmega=omega;fSig0=sig0;fLambda=lam;}
+            {fDoFluc=on;fOmega=omega;fSig0=sig0;fLambda=lam;fSigFlucTable.Reset();}
    static void       PrintVersion()         {cout << "AliGlauberMC " << Version() << endl;}
    static const char *Version()             {return "v1.2";}
    static void       RunAndSaveNtuple( Int_t n,
@@ -251,9 +256,22 @@ private:
    Double_t     fSig0;           //regularization parameter 
    Double_t     fLambda;         //lambda parameter
    TF1         *fSigFluc;        //!parameterization for fluctuating sigNN
+   AliGlauberSampler fSigFlucTable; //!table of fSigFluc used to draw sigNN
+   Int_t        fNThreads;       //number of threads used by Run (1 = serial with gRandom, 0 = all cores)
+   TRandom     *fRandom;         //!random generator (gRandom if not set), not owned
+   std::vector<Double_t> fCollXA;   //!x of the nucleons of A, for the collision check
+   std::vector<Double_t> fCollYA;   //!y of the nucleons of A
+   std::vector<Double_t> fCollD2A;  //!squared interaction distance of the nucleons of A
+   std::vector<Int_t>    fCollNA;   //!number of collisions of the nucleons of A
    Bool_t       CalcResults(Double_t bgen);
+   void         InitSigFluc();
+   TRandom     *GetRandom() const;
+   void         GetNtupleValues(Float_t *v) const;
+   AliGlauberMC *CreateWorker() const;
+   void         GenerateEvents(Int_t nevents, UInt_t seed, std::vector<Float_t> *values, Int_t *nFailed);
+   void         RunParallel(Int_t nevents, Int_t nThreads);
 
-   ClassDef(AliGlauberMC,4)
+   ClassDef(AliGlauberMC,5)
 };
 
 #endif
@@ -31,6 +31,7 @@ public:
    virtual   ~AliGlauberNucleon() {}
 
    void       Collide()            {fNColl++;}
+   void       Collide(Int_t n)     {fNColl+=n;}
    Int_t      GetNColl()     const {return fNColl;}
    Double_t   GetSigNN()     const {return fSigNN;}
    Double_t   GetX()         const {return fX;}
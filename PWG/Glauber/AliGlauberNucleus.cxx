@@ -49,7 +49,9 @@ AliGlauberNucleus::AliGlauberNucleus(Option_t* iname, Int_t iN, Double_t iR, Dou
   fF(0),
   fTrials(0),
   fFunction(ifunc),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fSampler(),
+  fRandom(0)
 {
    if (fN==0) {
       cout << "Setting up nucleus " << iname << endl;
@@ -76,12 +78,16 @@ AliGlauberNucleus::AliGlauberNucleus(const AliGlauberNucleus& in):
   fMinDist(in.fMinDist),
   fF(in.fF),
   fTrials(in.fTrials),
-  fFunction(in.fFunction),
-  fNucleons(NULL)
+  fFunction(in.fFunction ? static_cast<TF1*>(in.fFunction->Clone()) : NULL),
+  fNucleons(NULL),
+  fSampler(in.fSampler),
+  fRandom(in.fRandom)
 {
-  //copy ctor
-  if (in.fNucleons)
+  //copy ctor, the copy owns its own rho(r)
+  if (in.fNucleons) {
     fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
+    fNucleons->SetOwner();
+  }
 }
 
 //______________________________________________________________________________
@@ -89,6 +95,7 @@ AliGlauberNucleus& AliGlauberNucleus::operator=(const AliGlauberNucleus& in)
 {
   //assignment
   if (&in==this) return *this;
+  TNamed::operator=(in);
   fN=in.fN;
   fR=in.fR;
   fA=in.fA;
@@ -96,10 +103,16 @@ AliGlauberNucleus& AliGlauberNucleus::operator=(const AliGlauberNucleus& in)
   fMinDist=in.fMinDist;
   fF=in.fF;
   fTrials=in.fTrials;
-  fFunction=in.fFunction;
+  delete fFunction;
+  fFunction=in.fFunction ? static_cast<TF1*>(in.fFunction->Clone()) : NULL;
   delete fNucleons;
-  fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
-  fNucleons->SetOwner();
+  fNucleons=NULL;
+  if (in.fNucleons) {
+    fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
+    fNucleons->SetOwner();
+  }
+  fSampler=in.fSampler;
+  fRandom=in.fRandom;
   return *this;
 }
 
@@ -177,6 +190,7 @@ void AliGlauberNucleus::Lookup(Option_t* name)
 void AliGlauberNucleus::SetR(Double_t ir)
 {
    fR = ir;
+   fSampler.Reset();
    switch (fF)
    {
       case 0: // Proton
@@ -195,6 +209,7 @@ void AliGlauberNucleus::SetR(Double_t ir)
 void AliGlauberNucleus::SetA(Double_t ia)
 {
    fA = ia;
+   fSampler.Reset();
    switch (fF)
    {
       case 0: // Proton
@@ -212,6 +227,7 @@ void AliGlauberNucleus::SetA(Double_t ia)
 void AliGlauberNucleus::SetW(Double_t iw)
 {
    fW = iw;
+   fSampler.Reset();
    switch (fF)
    {
       case 0: // Proton
@@ -226,8 +242,17 @@ void AliGlauberNucleus::SetW(Double_t iw)
 }
 
 //______________________________________________________________________________
-void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
+TRandom* AliGlauberNucleus::GetRandom() const
+{
+   return fRandom ? fRandom : gRandom;
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::Init()
 {
+   // Creates the nucleons and tabulates rho(r); done by ThrowNucleons when needed,
+   // to be called before copies of the nucleus are used in other threads.
+
    if (fNucleons==0) {
       fNucleons=new TObjArray(fN);
       fNucleons->SetOwner();
@@ -236,8 +261,18 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
 	 fNucleons->Add(nucleon); 
       }
    } 
+   if (!fSampler.IsValid())
+      fSampler.Tabulate(fFunction);
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
+{
+   if (fNucleons==0 || !fSampler.IsValid())
+      Init();
    
    fTrials = 0;
+   TRandom *rnd = GetRandom();
 
    Double_t sumx=0;       
    Double_t sumy=0;       
@@ -246,9 +281,9 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
    Bool_t hulthen = (TString(GetName())=="dh");
    if (fN==2 && hulthen) { //special treatmeant for Hulten
 
-      Double_t r = fFunction->GetRandom()/2;
-      Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-      Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+      Double_t r = fSampler.Sample(rnd->Rndm())/2;
+      Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+      Double_t ctheta = 2*rnd->Rndm() - 1 ;
       Double_t stheta = sqrt(1-ctheta*ctheta);
      
       AliGlauberNucleon *nucleon1=(AliGlauberNucleon*)(fNucleons->UncheckedAt(0));
@@ -270,9 +305,9 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
       nucleon->Reset();
       while(1) {
          fTrials++;
-         Double_t r = fFunction->GetRandom();
-         Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-         Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+         Double_t r = fSampler.Sample(rnd->Rndm());
+         Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+         Double_t ctheta = 2*rnd->Rndm() - 1 ;
          Double_t stheta = TMath::Sqrt(1-ctheta*ctheta);
          Double_t x = r * stheta * cos(phi) + xshift;
          Double_t y = r * stheta * sin(phi);      
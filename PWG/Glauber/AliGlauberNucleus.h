@@ -16,8 +16,10 @@
 
 //class TNamed;
 #include <TNamed.h>
+#include "AliGlauberSampler.h"
 class TObjArray;
 class TF1;
+class TRandom;
 
 class AliGlauberNucleus : public TNamed {
 private:
@@ -30,8 +32,11 @@ private:
    Int_t      fTrials;     //Store trials needed to complete nucleus
    TF1*       fFunction;   //Probability density function rho(r)
    TObjArray* fNucleons;   //Array of nucleons
+   AliGlauberSampler fSampler; //!Table of rho(r) used to throw the nucleons
+   TRandom*   fRandom;     //!Random generator (gRandom if not set), not owned
 
    void       Lookup(Option_t* name);
+   TRandom*   GetRandom() const;
 
 public:
    AliGlauberNucleus(Option_t* iname="Au", Int_t iN=0, Double_t iR=0, Double_t ia=0, Double_t iw=0, TF1* ifunc=0);
@@ -52,9 +57,11 @@ public:
    void       SetA(Double_t ia);
    void       SetW(Double_t iw);
    void       SetMinDist(Double_t min) {fMinDist=min;}
+   void       SetRandom(TRandom *r)    {fRandom=r;}
+   void       Init();
    void       ThrowNucleons(Double_t xshift=0.);
 
-   ClassDef(AliGlauberNucleus,1)
+   ClassDef(AliGlauberNucleus,2)
 };
 
 #endif
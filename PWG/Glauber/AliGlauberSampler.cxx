@@ -0,0 +1,86 @@
+/**************************************************************************
+* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  AliGlauberSampler implementation
+//  support class for Glauber MC
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <TMath.h>
+#include <TF1.h>
+#include "AliGlauberSampler.h"
+
+ClassImp(AliGlauberSampler)
+
+//______________________________________________________________________________
+AliGlauberSampler::AliGlauberSampler():
+  fXmin(0),
+  fXmax(0),
+  fCdf()
+{
+  //def ctor
+}
+
+//______________________________________________________________________________
+Bool_t AliGlauberSampler::Tabulate(TF1 *f, Int_t npx)
+{
+  // Tabulates the cumulative distribution of f over its range in npx bins,
+  // integrating f in each bin with the Simpson rule (negative values count as 0).
+  // Returns kFALSE, and leaves the table empty, if f has no positive integral.
+
+  Reset();
+  if (!f || npx<1) return kFALSE;
+  f->GetRange(fXmin,fXmax);
+  const Double_t dx = (fXmax-fXmin)/npx;
+
+  fCdf.resize(npx+1);
+  fCdf[0] = 0;
+  Double_t fLow = TMath::Max(f->Eval(fXmin),0.);
+  for (Int_t i=0; i<npx; i++) {
+    Double_t x    = fXmin+i*dx;
+    Double_t fMid = TMath::Max(f->Eval(x+dx/2),0.);
+    Double_t fUp  = TMath::Max(f->Eval(x+dx),0.);
+    fCdf[i+1] = fCdf[i]+(fLow+4*fMid+fUp)*dx/6;
+    fLow = fUp;
+  }
+  const Double_t total = fCdf[npx];
+  if (!(total>0)) {
+    Reset();
+    return kFALSE;
+  }
+  for (Int_t i=1; i<=npx; i++)
+    fCdf[i] /= total;
+  return kTRUE;
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberSampler::Sample(Double_t u) const
+{
+  // Inverse of the tabulated cumulative distribution at u in [0,1]:
+  // the density is taken as constant within each bin.
+
+  if (!IsValid()) return fXmin;
+  const Int_t npx = fCdf.size()-1;
+  Int_t i = TMath::BinarySearch(npx+1,&fCdf[0],u);
+  if (i<0) i = 0;
+  if (i>=npx) i = npx-1;
+  const Double_t width = fCdf[i+1]-fCdf[i];
+  Double_t frac = (width>0) ? (u-fCdf[i])/width : 0;
+  if (frac<0) frac = 0;
+  if (frac>1) frac = 1;
+  return fXmin+(i+frac)*(fXmax-fXmin)/npx;
+}
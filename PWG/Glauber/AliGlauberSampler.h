@@ -0,0 +1,43 @@
+#ifndef ALIGLAUBERSAMPLER_H
+#define ALIGLAUBERSAMPLER_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  AliGlauberSampler
+//  support class for Glauber MC
+//
+//  Random numbers following a TF1, from a table of its cumulative
+//  distribution filled once: replaces TF1::GetRandom in the event loop,
+//  one uniform number and a binary search per call. The table is plain
+//  data, so that copies can be used from several threads.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <Rtypes.h>
+#include <vector>
+
+class TF1;
+
+class AliGlauberSampler {
+
+private:
+   Double_t              fXmin;  //Lower edge of the table
+   Double_t              fXmax;  //Upper edge of the table
+   std::vector<Double_t> fCdf;   //Cumulative distribution at the bin edges
+
+public:
+   AliGlauberSampler();
+   virtual   ~AliGlauberSampler() {}
+
+   Bool_t     IsValid()      const {return fCdf.size()>1;}
+   void       Reset()              {fCdf.clear();}
+   Bool_t     Tabulate(TF1 *f, Int_t npx=10000);
+   Double_t   Sample(Double_t u) const;
+
+   ClassDef(AliGlauberSampler,1)
+};
+
+#endif
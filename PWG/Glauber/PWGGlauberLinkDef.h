@@ -7,5 +7,6 @@
 #pragma link C++ class AliGlauberMC+;
 #pragma link C++ class AliGlauberNucleus+;
 #pragma link C++ class AliGlauberNucleon+;
+#pragma link C++ class AliGlauberSampler+;
 
 #endif
@@ -360,6 +360,42 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::AddBinContent(const Int_t* binIdx, Int_t istep, Double_t sumw, Double_t sumw2, Bool_t unitWeights)
+{
+  // adds several entries to one bin at once: sumw (sumw2) is the sum of their (squared) weights
+  // binIdx contains TAxis bin indexes
+  // unitWeights: all entries have weight 1 (otherwise the sumw2 container is created as in Fill)
+
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    // under/overflow not supported
+    if (binIdx[i] < 1 || binIdx[i] > GetAxis(i, 0)->GetNbins())
+      return;
+  }
+  
+  Long64_t bin = GetGlobalBinIndex(binIdx);
+
+  if (!fValues[istep])
+  {
+    fValues[istep] = new TemplateArray(fNBins);
+    AliInfo(Form("Created values container for step %d", istep));
+  }
+
+  if (!unitWeights)
+  {
+    if (!fSumw2[istep])
+    {
+      fSumw2[istep] = new TemplateArray(*fValues[istep]);
+      AliInfo(Form("Created sumw2 container for step %d", istep));
+    }
+  }
+
+  fValues[istep]->GetArray()[bin] += sumw;
+  if (fSumw2[istep])
+    fSumw2[istep]->GetArray()[bin] += sumw2;
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
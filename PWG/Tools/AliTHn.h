@@ -48,6 +48,7 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  void AddBinContent(const Int_t* binIdx, Int_t istep, Double_t sumw, Double_t sumw2, Bool_t unitWeights);
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
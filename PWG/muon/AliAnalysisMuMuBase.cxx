@@ -69,11 +69,43 @@ fCutRegistry(0x0),
 fEvent(0x0),
 fMCEvent(0x0),
 fHistogramToDisable(0x0),
-fHasMC(kFALSE)
+fHasMC(kFALSE),
+fPairHistoNames(),
+fPairHistoIsTH1(),
+fPairHistoDisabled(),
+fPairCutNames(),
+fPairCutNameAddresses(),
+fPairCutNameIndices(),
+fPairHistoCombinations(),
+fPairHistoHandles(),
+fCurrentPairHistoCombination(-1)
 {
  /// default ctor
 }
 
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::AddPairHistoHandle(const char* hname, Bool_t isTH1, const char* guard)
+{
+  /** Register a pair histogram (one copy per pair cut combination, see CreatePairHistos
+   * and CreatePairTHnSparse) to be looked up once per eventSelection/triggerClassName/centrality
+   * path by ResolvePairHistoHandles, instead of once per pair.
+   * The histogram is retrieved with Histo if isTH1, with GetObject otherwise (THnSparse, TProfile).
+   * The handle is null if guard (hname by default) is disabled (see IsHistogramDisabled).
+   * Returns the id to be used with PairHistoHandle.
+   */
+
+  fPairHistoNames.push_back(hname);
+  fPairHistoIsTH1.push_back(isTH1);
+  fPairHistoDisabled.push_back(IsHistogramDisabled(guard ? guard : hname));
+
+  // paths already resolved miss the new handle
+  fPairHistoCombinations.clear();
+  fPairHistoHandles.clear();
+  fCurrentPairHistoCombination = -1;
+
+  return fPairHistoNames.size()-1;
+}
+
 //_____________________________________________________________________________
 TString AliAnalysisMuMuBase::BuildPath(const char* eventSelection, const char* triggerClassName,
                                        const char* centrality, const char* cut) const
@@ -104,6 +136,18 @@ TString AliAnalysisMuMuBase::BuildMCPath(const char* eventSelection, const char*
 }
 
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuBase::ClearPairHistoHandles()
+{
+  /// Remove all the pair histogram handles, e.g. when the histograms to fill change
+  fPairHistoNames.clear();
+  fPairHistoIsTH1.clear();
+  fPairHistoDisabled.clear();
+  fPairHistoCombinations.clear();
+  fPairHistoHandles.clear();
+  fCurrentPairHistoCombination = -1;
+}
+
 //_____________________________________________________________________________
 void
 AliAnalysisMuMuBase::CreateEventHistos(UInt_t dataType,
@@ -465,6 +509,73 @@ TH1* AliAnalysisMuMuBase::Histo(const char* eventSelection,
   return fHistogramCollection ? fHistogramCollection->Histo(Form("/%s/%s/%s/%s",eventSelection,triggerClassName,cent,what),histoname) : 0x0;
 }
 
+//_____________________________________________________________________________
+const char* AliAnalysisMuMuBase::GetPairHistoHandleName(Int_t id) const
+{
+  /// Name of the histogram of handle id
+  return ( id >= 0 && id < GetNofPairHistoHandles() ) ? fPairHistoNames[id].c_str() : "";
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuBase::IsPairHistoHandleDisabled(Int_t id) const
+{
+  /// Whether the histogram of handle id is disabled
+  return ( id < 0 || id >= GetNofPairHistoHandles() || fPairHistoDisabled[id] );
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::PairCutIndex(const char* pairCutName)
+{
+  /// Index of a pair cut combination from its name. The names given by the steering
+  /// are those of the cut registry, so they are matched by address, and compared
+  /// only the first time an address is seen
+
+  for ( std::vector<const char*>::size_type i = 0; i < fPairCutNameAddresses.size(); ++i )
+  {
+    if ( fPairCutNameAddresses[i] == pairCutName ) return fPairCutNameIndices[i];
+  }
+
+  Int_t index(-1);
+  for ( std::vector<std::string>::size_type i = 0; i < fPairCutNames.size(); ++i )
+  {
+    if ( fPairCutNames[i] == pairCutName )
+    {
+      index = i;
+      break;
+    }
+  }
+
+  // in case the names are not stable, do not let the cache grow
+  if ( fPairCutNameAddresses.size() > 100 )
+  {
+    fPairCutNameAddresses.clear();
+    fPairCutNameIndices.clear();
+  }
+
+  fPairCutNameAddresses.push_back(pairCutName);
+  fPairCutNameIndices.push_back(index);
+
+  return index;
+}
+
+//_____________________________________________________________________________
+TObject* AliAnalysisMuMuBase::PairHistoHandle(const char* pairCutName, Int_t id, Bool_t mc)
+{
+  /// Pair histogram of handle id for a pair cut combination in the current
+  /// path (see ResolvePairHistoHandles), for the MC input if mc.
+  /// No string operation, to be used when filling pairs
+
+  if ( fCurrentPairHistoCombination < 0 || id < 0 || id >= GetNofPairHistoHandles() ) return 0x0;
+
+  Int_t cut = PairCutIndex(pairCutName);
+
+  if ( cut < 0 ) return 0x0;
+
+  Int_t nCuts = fPairCutNames.size();
+
+  return fPairHistoHandles[((fCurrentPairHistoCombination*nCuts + cut)*GetNofPairHistoHandles() + id)*2 + (mc ? 1 : 0)];
+}
+
 //_____________________________________________________________________________
 TProfile* AliAnalysisMuMuBase::Prof(const char* eventSelection,
                                     const char* histoname)
@@ -638,6 +749,77 @@ TProfile* AliAnalysisMuMuBase::MCProf(const char* eventSelection,
 	return fHistogramCollection ? static_cast<TProfile*>(fHistogramCollection->GetObject(Form("/%s/%s/%s/%s/%s",MCInputPrefix(),eventSelection,triggerClassName,cent,what),histoname)) : 0x0;
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuBase::ResolvePairHistoHandles(const char* eventSelection,
+                                                  const char* triggerClassName,
+                                                  const char* centrality)
+{
+  /** Make eventSelection/triggerClassName/centrality the current path of the pair histogram handles.
+   * The first time a path is seen, the registered histograms (see AddPairHistoHandle) are looked
+   * up in the histogram collection for all the pair cut combinations, so this has to be called
+   * once they are created, e.g. at the end of DefineHistogramCollection
+   */
+
+  fCurrentPairHistoCombination = -1;
+
+  if ( !fHistogramCollection || !fCutRegistry || fPairHistoNames.empty() ) return;
+
+  if ( fPairCutNames.empty() )
+  {
+    TIter nextCutCombination(CutRegistry()->GetCutCombinations(AliAnalysisMuMuCutElement::kTrackPair));
+    AliAnalysisMuMuCutCombination* cutCombination;
+
+    while ( ( cutCombination = static_cast<AliAnalysisMuMuCutCombination*>(nextCutCombination())) )
+    {
+      fPairCutNames.push_back(cutCombination->GetName());
+    }
+  }
+
+  std::string key(Form("/%s/%s/%s",eventSelection,triggerClassName,centrality));
+
+  std::map<std::string,Int_t>::const_iterator it = fPairHistoCombinations.find(key);
+
+  if ( it != fPairHistoCombinations.end() )
+  {
+    fCurrentPairHistoCombination = it->second;
+    return;
+  }
+
+  Int_t nCuts = fPairCutNames.size();
+  Int_t nHistos = GetNofPairHistoHandles();
+  Int_t combination = fPairHistoCombinations.size();
+
+  fPairHistoHandles.resize((combination+1)*nCuts*nHistos*2,0x0);
+
+  for ( Int_t icut = 0; icut < nCuts; ++icut )
+  {
+    TString path[2];
+
+    path[0].Form("/%s/%s/%s/%s",eventSelection,triggerClassName,centrality,fPairCutNames[icut].c_str());
+    path[1].Form("/%s/%s/%s/%s/%s",MCInputPrefix(),eventSelection,triggerClassName,centrality,fPairCutNames[icut].c_str());
+
+    for ( Int_t id = 0; id < nHistos; ++id )
+    {
+      if ( fPairHistoDisabled[id] ) continue;
+
+      for ( Int_t imc = 0; imc < 2; ++imc )
+      {
+        if ( imc == 1 && !HasMC() ) continue;
+
+        TObject* o(0x0);
+
+        if ( fPairHistoIsTH1[id] ) o = fHistogramCollection->Histo(path[imc].Data(),fPairHistoNames[id].c_str());
+        else o = fHistogramCollection->GetObject(path[imc].Data(),fPairHistoNames[id].c_str());
+
+        fPairHistoHandles[((combination*nCuts + icut)*nHistos + id)*2 + imc] = o;
+      }
+    }
+  }
+
+  fPairHistoCombinations[key] = combination;
+  fCurrentPairHistoCombination = combination;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisMuMuBase::SetEvent(AliVEvent* event, AliMCEvent* mcEvent)
 {
@@ -13,6 +13,9 @@
 #include "TObject.h"
 #include "TString.h"
 #include "TProfile.h"
+#include <map>
+#include <string>
+#include <vector>
 
 class AliCounterCollection;
 class AliAnalysisMuMuBinning;
@@ -194,6 +197,14 @@ protected:
 
   Int_t GetNbins(Double_t xmin, Double_t xmax, Double_t xstep);
 
+  Int_t AddPairHistoHandle(const char* hname, Bool_t isTH1=kTRUE, const char* guard=0x0);
+  void ClearPairHistoHandles();
+  Int_t GetNofPairHistoHandles() const { return fPairHistoNames.size(); }
+  const char* GetPairHistoHandleName(Int_t id) const;
+  Bool_t IsPairHistoHandleDisabled(Int_t id) const;
+  void ResolvePairHistoHandles(const char* eventSelection, const char* triggerClassName, const char* centrality);
+  TObject* PairHistoHandle(const char* pairCutName, Int_t id, Bool_t mc=kFALSE);
+
   AliCounterCollection* CounterCollection() const { return fEventCounters; }
   AliMergeableCollection* HistogramCollection() const { return fHistogramCollection; }
   const AliAnalysisMuMuBinning* Binning() const { return fBinning; }
@@ -201,6 +212,8 @@ protected:
 
 private:
 
+  Int_t PairCutIndex(const char* pairCutName);
+
   /// not implemented on purpose
   AliAnalysisMuMuBase& operator=(const AliAnalysisMuMuBase& rhs);
   /// not implemented on purpose
@@ -215,7 +228,17 @@ private:
   TList* fHistogramToDisable; // list of regexp of histo name to disable
   Bool_t fHasMC; // whether or not we're dealing with MC data
 
-  ClassDef(AliAnalysisMuMuBase,1) // base class for a companion class to AliAnalysisMuMu
+  std::vector<std::string> fPairHistoNames; //! names of the pair histograms with a handle
+  std::vector<Bool_t> fPairHistoIsTH1; //! whether the handle is retrieved with Histo (or GetObject)
+  std::vector<Bool_t> fPairHistoDisabled; //! whether the handle is disabled (see IsHistogramDisabled)
+  std::vector<std::string> fPairCutNames; //! names of the pair cut combinations, in registry order
+  std::vector<const char*> fPairCutNameAddresses; //! addresses of the pair cut names already seen
+  std::vector<Int_t> fPairCutNameIndices; //! index in fPairCutNames of each address
+  std::map<std::string,Int_t> fPairHistoCombinations; //! index of each resolved eventSelection/trigger/centrality path
+  std::vector<TObject*> fPairHistoHandles; //! handles, indexed by (path,pair cut,histogram,mc)
+  Int_t fCurrentPairHistoCombination; //! index of the current path, -1 if none
+
+  ClassDef(AliAnalysisMuMuBase,2) // base class for a companion class to AliAnalysisMuMu
 };
 
 #endif
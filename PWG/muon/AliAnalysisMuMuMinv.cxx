@@ -49,8 +49,14 @@ fMinvBinSize(0.025),
 fMinvMin(0.0),
 fMinvMax(16.0),
 fmcptcutmin(0.0),
-fmcptcutmax(12.0)
+fmcptcutmax(12.0),
+fBinTypes()
 {
+  for ( Int_t i = 0; i < kNofNchParameters; ++i ){
+    fHasNchParameter[i] = kFALSE;
+    fNchParameter[i]    = 0.0;
+  }
+
   // FIXME ? find the AccxEff histogram from HistogramCollection()->Histo("/EXCHANGE/JpsiAccEff")
 
   if ( accEffHisto )
@@ -75,16 +81,23 @@ AliAnalysisMuMuMinv::DefineHistogramCollection(const char* eventSelection,
                                                const char* centrality,
                                                Bool_t mix)
 {
-  /// Define the histograms this analysis will use
+  /// Define the histograms this analysis will use, and make their handles
+  /// the current ones for the pair filling
+
+  // no bins defined by the external steering macro, use our own defaults
+  if (!fBinsToFill) SetBinsToFill("psi","integrated,ptvsy,yvspt,pt,y,phi,ntrcorr,ntr,nch,v0a,v0acorr,v0ccorr,v0mcorr");
+
+  if ( GetNofPairHistoHandles() == 0 ) DefinePairHistoHandles();
 
   // Check if histo is not already here
-  if ( ExistSemaphoreHistogram(eventSelection,triggerClassName,centrality) ) return;
+  if ( ExistSemaphoreHistogram(eventSelection,triggerClassName,centrality) )
+  {
+    ResolvePairHistoHandles(eventSelection,triggerClassName,centrality);
+    return;
+  }
 
   CreateSemaphoreHistogram(eventSelection,triggerClassName,centrality);
 
-  // no bins defined by the external steering macro, use our own defaults
-  if (!fBinsToFill) SetBinsToFill("psi","integrated,ptvsy,yvspt,pt,y,phi,ntrcorr,ntr,nch,v0a,v0acorr,v0ccorr,v0mcorr");
-
   // mass range
   Double_t minvMin = fMinvMin;
   Double_t minvMax = fMinvMax;
@@ -300,6 +313,58 @@ AliAnalysisMuMuMinv::DefineHistogramCollection(const char* eventSelection,
       }
     }
   }
+
+  ResolvePairHistoHandles(eventSelection,triggerClassName,centrality);
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::DefinePairHistoHandles()
+{
+  /// Register the handles of the pair histograms filled in FillHistosForPair
+  /// (see AliAnalysisMuMuBase::AddPairHistoHandle), in the order of
+  /// EPairHistoHandle, DistributionHandle and MinvHandle, and the type of the bins to fill
+
+  const char* quantities[3] = {"Pt","Y","Eta"};
+  const char* mixes[2]      = {"","Mix"};
+  const char* charges[3]    = {"","PP","MM"};
+  const Double_t pairCharges[3] = {0,2,-2};
+
+  for ( Int_t iq = 0; iq < 3; ++iq ){
+    for ( Int_t imix = 0; imix < 2; ++imix ){
+      for ( Int_t icharge = 0; icharge < 3; ++icharge ){
+        AddPairHistoHandle(Form("%s%s%s",quantities[iq],mixes[imix],charges[icharge]),kFALSE,quantities[iq]);
+      }
+    }
+  }
+
+  AddPairHistoHandle("PtPaireVsPtTrack");
+  AddPairHistoHandle("PtRecVsSim");
+  AddPairHistoHandle("NchForJpsi");
+  AddPairHistoHandle("NchForPsiP");
+  AddPairHistoHandle("Pt");
+  AddPairHistoHandle("Y");
+  AddPairHistoHandle("Eta");
+
+  fBinTypes.clear();
+
+  TIter next(fBinsToFill);
+  AliAnalysisMuMuBinning::Range* r;
+
+  while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(next()) ) ){
+
+    fBinTypes.push_back(GetBinType(*r));
+
+    for ( Int_t iacc = 0; iacc < 2; ++iacc ){
+      for ( Int_t imix = 0; imix < 2; ++imix ){
+        for ( Int_t icharge = 0; icharge < 3; ++icharge ){
+          TString minvName(GetMinvHistoName(*r,iacc==1,pairCharges[icharge],imix==1));
+          AddPairHistoHandle(minvName.Data());
+          AddPairHistoHandle(Form("MeanPtVs%s",minvName.Data()),kFALSE,minvName.Data());
+          AddPairHistoHandle(Form("MeanPtSquareVs%s",minvName.Data()),kFALSE,minvName.Data());
+        }
+      }
+    }
+  }
 }
 
 //_____________________________________________________________________________
@@ -313,9 +378,27 @@ void AliAnalysisMuMuMinv::DefineMinvRange(Double_t minvMin, Double_t minvMax, Do
 }
 
 //_____________________________________________________________________________
-void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
-                                            const char* triggerClassName,
-                                            const char* centrality,
+void AliAnalysisMuMuMinv::FillHistosForEvent(const char* /*eventSelection*/,
+                                             const char* /*triggerClassName*/,
+                                             const char* /*centrality*/)
+{
+  /// Get the multiplicities of the event used for the bins of the pair histograms
+  /// once per event, instead of once per pair and bin
+
+  const char* names[kNofNchParameters] = {"NtrCorr","dNchdEta","V0ACorr","V0CCorr","V0MCorr"};
+
+  TList* list = Event() ? static_cast<TList*>(Event()->FindListObject("NCH")) : 0x0;
+
+  for ( Int_t i = 0; i < kNofNchParameters; ++i ){
+    fNchParameter[i] = 0.0;
+    fHasNchParameter[i] = FindNchParameter(list,names[i],fNchParameter[i]);
+  }
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::FillHistosForPair(const char* /*eventSelection*/,
+                                            const char* /*triggerClassName*/,
+                                            const char* /*centrality*/,
                                             const char* pairCutName,
                                             const AliVParticle& tracki,
                                             const AliVParticle& trackj,
@@ -324,15 +407,17 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   /// Fill histograms for unlike-sign reconstructed  muon pairs.
   /// For the MC case, we check that only tracks with an associated MC label are selected (usefull when running on embedding).
   /// A weight is also applied for MC case at the pair or the muon track level according to SetMuonWeight() and systLevel.
+  /// The histograms are taken from the handles of the current path (set in DefineHistogramCollection),
+  /// so that there is no string operation per pair.
 
   // Usual cuts
   if (!AliAnalysisMuonUtility::IsMuonTrack(&tracki) || !AliAnalysisMuonUtility::IsMuonTrack(&trackj) ) return;
 
-  // Get total charge in order to get the correct histo name
+  // Get total charge in order to get the correct histo
   Double_t PairCharge = tracki.Charge() + trackj.Charge();
-  TString scharge  = "";
-  if( PairCharge == +2 )      scharge = "PP";
-  else if( PairCharge == -2 ) scharge = "MM";
+  Int_t icharge = 0;
+  if( PairCharge == +2 )      icharge = 1;
+  else if( PairCharge == -2 ) icharge = 2;
 
   // Pointers in case running on MC
   Int_t labeli               = 0;
@@ -342,12 +427,7 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   TLorentzVector             * pair4MomentumMC(0x0);
   Double_t inputWeightMC(1.);
 
-  // Usefull string :)
-  TString smix = IsMixedHisto ? "Mix" : "";
-
-  // Create proxy in AliMergeableCollection
-  AliMergeableCollectionProxy* proxy = HistogramCollection()->CreateProxy(BuildPath(eventSelection,triggerClassName,centrality,pairCutName));
-  AliMergeableCollectionProxy* mcProxy(0x0); // to be set later maybe
+  Int_t imix = IsMixedHisto ? 1 : 0;
 
   // Construct dimuons vector
   TLorentzVector pi(tracki.Px(),tracki.Py(),tracki.Pz(),
@@ -373,47 +453,23 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     // Check if first track is a muon
     mcTracki = MCEvent()->GetTrack(labeli);
     if(!mcTracki) return;
-    if ( TMath::Abs(mcTracki->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if ( TMath::Abs(mcTracki->PdgCode()) != 13 ) return;
 
     // Check if second track is a muon
     mcTrackj = MCEvent()->GetTrack(labelj);
     if(!mcTrackj) return;
-    if ( TMath::Abs(mcTrackj->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if ( TMath::Abs(mcTrackj->PdgCode()) != 13 ) return;
 
     // Check if tracks has the same mother
     Int_t currMotheri = mcTracki->GetMother();
     Int_t currMotherj = mcTrackj->GetMother();
-    if( currMotheri!=currMotherj ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
-    if( currMotheri<0 ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if( currMotheri!=currMotherj ) return;
+    if( currMotheri<0 ) return;
 
     // Check if mother is J/psi
     AliMCParticle* mother = static_cast<AliMCParticle*>(MCEvent()->GetTrack(currMotheri));
-    if(!mother){
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
-    if(mother->PdgCode() !=443) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if(!mother) return;
+    if(mother->PdgCode() !=443) return;
 
     // Weight tracks if specified
     if(!fWeightMuon)      inputWeightMC = WeightPairDistribution(mother->Pt(),mother->Y());
@@ -423,16 +479,8 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
     if(!mcTracki || !mcTrackj){
       AliError("Miss one or several MC track");
-      delete proxy;
-      delete mcProxy;
       return;
     }
-
-    // Create proxy for MC
-    mcProxy = HistogramCollection()->CreateProxy(BuildMCPath(eventSelection,triggerClassName,centrality,pairCutName));
-    TLorentzVector mcpi(mcTracki->Px(),mcTracki->Py(),mcTracki->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTracki->P()*mcTracki->P()));
-    TLorentzVector mcpj(mcTrackj->Px(),mcTrackj->Py(),mcTrackj->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTrackj->P()*mcTrackj->P()));
-    mcpj+=mcpi;
   }
 
   // Weight tracks if specified
@@ -441,25 +489,29 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   else if(fWeightMuon)  inputWeight = WeightMuonDistribution(tracki.Pt()) * WeightMuonDistribution(trackj.Pt());
 
   // Fill some distribution histos
-  if ( !IsHistogramDisabled("Pt")  ) {
+  THnSparse* hs(0x0);
+  hs = static_cast<THnSparse*>(PairHistoHandle(pairCutName,DistributionHandle(0,imix,icharge)));
+  if ( hs ) {
     Double_t x[2] = {pair4Momentum.Pt(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    hs->Fill(x,inputWeight);
   }
-  if ( !IsHistogramDisabled("Y")   ){
+  hs = static_cast<THnSparse*>(PairHistoHandle(pairCutName,DistributionHandle(1,imix,icharge)));
+  if ( hs ) {
     Double_t x[2] = {pair4Momentum.Rapidity(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    hs->Fill(x,inputWeight);
   }
-  if ( !IsHistogramDisabled("Eta") ){
+  hs = static_cast<THnSparse*>(PairHistoHandle(pairCutName,DistributionHandle(2,imix,icharge)));
+  if ( hs ) {
     Double_t x[2] = {pair4Momentum.Eta(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+    hs->Fill(x,inputWeight);
   }
 
-  if ( !IsHistogramDisabled("PtPaireVsPtTrack") && !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
+  if ( !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
+    TH2* h2 = static_cast<TH2*>(PairHistoHandle(pairCutName,kPtPaireVsPtTrack));
+    if ( h2 ) {
+      h2->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
+      h2->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
+    }
   }
 
   // Fill histos with MC stack info (only opposite charge muons)
@@ -470,12 +522,12 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     TLorentzVector mcpj(mcTrackj->Px(),mcTrackj->Py(),mcTrackj->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTrackj->P()*mcTrackj->P()));
     mcpj+=mcpi;
 
-
     // Fill histo
-    if ( proxy->Histo("PtRecVsSim") )  proxy->Histo("PtRecVsSim")->Fill(mcpj.Pt(),pair4Momentum.Pt());
-    if ( mcProxy->Histo("Pt"))  mcProxy->Histo("Pt")->Fill(mcpj.Pt(),inputWeightMC);
-    if ( mcProxy->Histo("Y"))   mcProxy->Histo("Y")->Fill(mcpj.Rapidity(),inputWeightMC);
-    if ( mcProxy->Histo("Eta")) mcProxy->Histo("Eta")->Fill(mcpj.Eta());
+    TH1* h(0x0);
+    if ( ( h = static_cast<TH1*>(PairHistoHandle(pairCutName,kPtRecVsSim)) ) ) h->Fill(mcpj.Pt(),pair4Momentum.Pt());
+    if ( ( h = static_cast<TH1*>(PairHistoHandle(pairCutName,kMCPt,kTRUE)) ) )  h->Fill(mcpj.Pt(),inputWeightMC);
+    if ( ( h = static_cast<TH1*>(PairHistoHandle(pairCutName,kMCY,kTRUE)) ) )   h->Fill(mcpj.Rapidity(),inputWeightMC);
+    if ( ( h = static_cast<TH1*>(PairHistoHandle(pairCutName,kMCEta,kTRUE)) ) ) h->Fill(mcpj.Eta());
 
     // set pair4MomentumMC for the rest of the function
     pair4MomentumMC = &mcpj;
@@ -484,6 +536,7 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   TIter nextBin(fBinsToFill);
   nextBin.Reset();
   AliAnalysisMuMuBinning::Range* r;
+  Int_t ibin(0);
 
   // Loop over all bin ranges
   while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(nextBin()) ) ){
@@ -494,19 +547,13 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     Bool_t ok(kFALSE);
     Bool_t okMC(kFALSE);
 
-    ok = CheckBinRangeCut(r,&pair4Momentum,proxy);
-    if( pair4MomentumMC ) okMC = CheckBinRangeCut(r,pair4MomentumMC,proxy);
+    ok = CheckBinRangeCut(r,fBinTypes[ibin],&pair4Momentum,pairCutName);
+    if( pair4MomentumMC ) okMC = CheckBinRangeCut(r,fBinTypes[ibin],pair4MomentumMC,pairCutName);
 
     // Check if pair pass all conditions, either MC or not, and fill Minv Histogrames
     if ( ok )
     {
-      // Get Minv histo name associated to the bin
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight);
+      FillMinvHisto(MinvHandle(ibin,kFALSE,imix,icharge),pairCutName,kFALSE,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() )
@@ -519,23 +566,13 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4Momentum.Pt(),pair4Momentum.Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight/AccxEff);
+        if( okAccEff ) FillMinvHisto(MinvHandle(ibin,kTRUE,imix,icharge),pairCutName,kFALSE,&pair4Momentum,inputWeight/AccxEff);
       }
     }
 
     if ( okMC ) {
 
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight);
+      FillMinvHisto(MinvHandle(ibin,kFALSE,imix,icharge),pairCutName,kTRUE,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() ){
@@ -548,18 +585,12 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4MomentumMC->Pt(),pair4MomentumMC->Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight/AccxEff);
+        if( okAccEff ) FillMinvHisto(MinvHandle(ibin,kTRUE,imix,icharge),pairCutName,kTRUE,&pair4Momentum,inputWeight/AccxEff);
 
       }
     }
+    ++ibin;
   }
-  delete proxy;
-  delete mcProxy;
 }
 
 
@@ -687,21 +718,24 @@ void AliAnalysisMuMuMinv::FillHistosForMCEvent(const char* eventSelection,const
 }
 
 //_____________________________________________________________________________
-void AliAnalysisMuMuMinv::FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight)
+void AliAnalysisMuMuMinv::FillMinvHisto(Int_t id, const char* pairCutName, Bool_t mc, const TLorentzVector* pair4Momentum, Double_t inputWeight)
 {
-  /// Create, fill and store Minv histo
-  if (!IsHistogramDisabled(minvName->Data())){
+  /// Fill Minv histo of handle id (see MinvHandle) and its mean pT profiles (handles id+1 and id+2),
+  /// in the MC input path if mc
+  if (!IsPairHistoHandleDisabled(id)){
 
     TH1* h(0x0);
 
-    h = proxy->Histo(minvName->Data());
+    h = static_cast<TH1*>(PairHistoHandle(pairCutName,id,mc));
     if (h) h->Fill(pair4Momentum->M(),inputWeight);
 
     // Fill Mean pT
     if ( fComputeMeanPt ){
-      if ( !hprof ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      TProfile* hprof  = static_cast<TProfile*>(PairHistoHandle(pairCutName,id+1,mc));
+      TProfile* hprof2 = static_cast<TProfile*>(PairHistoHandle(pairCutName,id+2,mc));
+      if ( !hprof ) AliError(Form("Could not get hprofile for %s",GetPairHistoHandleName(id)));
       else hprof->Fill(pair4Momentum->M(),pair4Momentum->Pt(),inputWeight);
-      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",GetPairHistoHandleName(id)));
       else hprof2->Fill(pair4Momentum->M(),pair4Momentum->Pt()*pair4Momentum->Pt(),inputWeight);
     }
   }
@@ -818,232 +852,133 @@ Bool_t AliAnalysisMuMuMinv::IsPtInRange(const AliVParticle& t1, const AliVPartic
 }
 
 //_____________________________________________________________________________
-Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, AliMergeableCollectionProxy* proxy)
+Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(const AliAnalysisMuMuBinning::Range* r, Int_t binType,
+                                             const TLorentzVector* pair4Momentum, const char* pairCutName)
 {
-  /// Check if our pairs match conditions from the binning range
-
-  // --- fully integrated case ---
+  /// Check if our pairs match conditions from the binning range.
+  /// binType is the type of the range (see GetBinType) and the multiplicities
+  /// are those of the event (see FillHistosForEvent)
 
   Bool_t ok(kFALSE);
 
-  if ( r->IsIntegrated() ){
-
-    ok = kTRUE;
-
-    TH1* h(0x0);
-
-    // Fill NchForJpsi histo according to pair4Momentum.M()
-    if ( pair4Momentum->M() >= 2.9 && pair4Momentum->M() <= 3.3 ){
-
-      h = proxy->Histo("NchForJpsi");
-
-      Double_t ntrcorr = (-1.);
-      TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
+  switch ( binType )
+  {
+    // --- fully integrated case ---
+    case kBinIntegrated:
+    {
+      ok = kTRUE;
 
-      if (list){
-        Int_t i(-1);
-        Bool_t parFound(kFALSE);
-        while ( i < list->GetEntries() - 1 && !parFound ){
+      TH1* h(0x0);
 
-          i++;
-          while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 ) i++;// In case there is a diferent object, just to skip it
-          TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
+      // Fill NchForJpsi or NchForPsiP histo according to pair4Momentum->M()
+      if ( pair4Momentum->M() >= 2.9 && pair4Momentum->M() <= 3.3 )     h = static_cast<TH1*>(PairHistoHandle(pairCutName,kNchForJpsi));
+      else if ( pair4Momentum->M() >= 3.6 && pair4Momentum->M() <= 3.9) h = static_cast<TH1*>(PairHistoHandle(pairCutName,kNchForPsiP));
 
-          if ( TString(p->GetName()).Contains("NtrCorr") ){
-            parFound = kTRUE;
-            ntrcorr = p->GetVal();
-          }
-        }
-      }
-      h->Fill(ntrcorr);
+      if ( h ) h->Fill(fHasNchParameter[kNtrCorr] ? fNchParameter[kNtrCorr] : -1.);
+      break;
     }
-    else if ( pair4Momentum->M() >= 3.6 && pair4Momentum->M() <= 3.9){
-
-      h = proxy->Histo("NchForPsiP");
-      Double_t ntrcorr = (-1.);
 
-      TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
-      if (list){
-
-        Int_t i(-1);
-        Bool_t parFound(kFALSE);
-        while ( i < list->GetEntries() - 1 && !parFound ){
-          i++;
-          while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 ) i++; // In case there is a different object, just to skip it
-
-          TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
+    // --- 2D Binning ---
+    case kBinPtVsY:
+      ok = r->IsInRange(pair4Momentum->Rapidity(),pair4Momentum->Pt());
+      break;
+    case kBinYVsPt:
+      ok = r->IsInRange(pair4Momentum->Pt(),pair4Momentum->Rapidity());
+      break;
+    case kBinNtrCorrPt:
+      if ( fHasNchParameter[kNtrCorr] ) ok = r->IsInRange(fNchParameter[kNtrCorr],pair4Momentum->Pt());
+      break;
+    case kBinNtrCorrY:
+      if ( fHasNchParameter[kNtrCorr] ) ok = r->IsInRange(fNchParameter[kNtrCorr],pair4Momentum->Rapidity());
+      break;
+    case kBin2DUnknown:
+      AliError(Form("Don't know how to deal with 2D bin %s",r->AsString().Data()));
+      break;
 
-          if ( TString(p->GetName()).Contains("NtrCorr") ){
-            parFound = kTRUE;
-            ntrcorr = p->GetVal();
-          }
-        }
-      }
-      h->Fill(ntrcorr);
-    }
+    // --- all the rest ---
+    case kBinPt:
+      ok = r->IsInRange(pair4Momentum->Pt());
+      break;
+    case kBinY:
+      ok = r->IsInRange(pair4Momentum->Rapidity());
+      break;
+    case kBinPhi:
+      ok = r->IsInRange(pair4Momentum->Phi());
+      break;
+    case kBinDNchDEta:
+      if ( fHasNchParameter[kDNchDEta] ) ok = r->IsInRange(fNchParameter[kDNchDEta]);
+      break;
+    case kBinNtrCorr:
+      if ( fHasNchParameter[kNtrCorr] ) ok = r->IsInRange(fNchParameter[kNtrCorr]);
+      break;
+    case kBinRelNtrCorr:
+      if ( fHasNchParameter[kNtrCorr] ) ok = r->IsInRange(fNchParameter[kNtrCorr]/5.97);
+      break;
+    case kBinV0ACorr:
+      if ( fHasNchParameter[kV0ACorr] ) ok = r->IsInRange(fNchParameter[kV0ACorr]);
+      break;
+    case kBinV0CCorr:
+      if ( fHasNchParameter[kV0CCorr] ) ok = r->IsInRange(fNchParameter[kV0CCorr]);
+      break;
+    case kBinV0MCorr:
+      if ( fHasNchParameter[kV0MCorr] ) ok = r->IsInRange(fNchParameter[kV0MCorr]);
+      break;
+    default:
+      break;
   }
+  return ok;
+}
 
-  // --- 2D Binning ---
-  else if ( r->Is2D() ){
-
-    if ( r->AsString().BeginsWith("PTVSY") )      ok = r->IsInRange(pair4Momentum->Rapidity(),pair4Momentum->Pt());
-    else if ( r->AsString().BeginsWith("YVSPT") ) ok = r->IsInRange(pair4Momentum->Pt(),pair4Momentum->Rapidity());
-    else if ( r->Quantity() == "NTRCORRPT" ){
-
-      TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
-      if (list){
-        Int_t i(-1);
-        Bool_t parFound(kFALSE);
-
-        while ( i < list->GetEntries() - 1 && !parFound ){
-          i++;
-          while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 ) i++;// In case there is a diferent object, just to skip it
-
-          TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuMinv::FindNchParameter(const TList* list, const char* name, Double_t& value) const
+{
+  /// Find in the list of multiplicities of the event (NCH, see AliAnalysisMuMuNch)
+  /// the first parameter whose name contains name
 
-          if ( TString(p->GetName()).Contains("NtrCorr") ){
-            parFound = kTRUE;
-            ok = r->IsInRange(p->GetVal(),pair4Momentum->Pt());
-          }
-        }
-      }
-    }
-    else if ( r->Quantity() == "NTRCORRY" ){
+  if (!list) return kFALSE;
 
-      TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
-      if (list){
-        Int_t i(-1);
-        Bool_t parFound(kFALSE);
-        while ( i < list->GetEntries() - 1 && !parFound ){
+  Int_t i(-1);
+  while ( i < list->GetEntries() - 1 ){
 
-          i++;
-          while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 ) i++;// In case there is a diferent object, just to skip it
+    i++;
+    while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 ) i++;// In case there is a diferent object, just to skip it
 
-          TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
+    TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
 
-          if ( TString(p->GetName()).Contains("NtrCorr") ){
-            parFound = kTRUE;
-            ok = r->IsInRange(p->GetVal(),pair4Momentum->Rapidity());
-          }
-        }
-      }
+    if ( TString(p->GetName()).Contains(name) ){
+      value = p->GetVal();
+      return kTRUE;
     }
-    else AliError(Form("Don't know how to deal with 2D bin %s",r->AsString().Data()));
   }
+  return kFALSE;
+}
 
-  // --- all the rest ---
-  else {
-
-    if ( r->Quantity() == "PT" )       ok = r->IsInRange(pair4Momentum->Pt());
-    else if ( r->Quantity() == "Y" )   ok = r->IsInRange(pair4Momentum->Rapidity());
-    else if ( r->Quantity() == "PHI" ) ok = r->IsInRange(pair4Momentum->Phi());
-    else if ( r->Quantity() == "DNCHDETA" ){
-
-      TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
-      if (list){
-        Int_t i(-1);
-        Bool_t parFound(kFALSE);
-        while ( i < list->GetEntries() - 1 && !parFound ){
-
-          i++;
-          while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 ) i++;// In case there is a diferent object, just to skip it
-
-          TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
-
-          if ( TString(p->GetName()).Contains("dNchdEta") ){
-            parFound = kTRUE;
-            ok = r->IsInRange(p->GetVal());
-          }
-        }
-      }
-    }
-    else if ( r->Quantity() == "NTRCORR" || r->Quantity() == "RELNTRCORR" ){
-
-      TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
-      if (list){
-
-        Int_t i(-1);
-        Bool_t parFound(kFALSE);
-        while ( i < list->GetEntries() - 1 && !parFound ){
-
-          i++;
-          while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 ) i++;// In case there is a diferent object, just to skip it
-
-          TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
-
-          if ( TString(p->GetName()).Contains("NtrCorr") ){
-            parFound = kTRUE;
-            if ( r->Quantity() == "NTRCORR" ) ok = r->IsInRange(p->GetVal());
-            else ok = r->IsInRange(p->GetVal()/5.97);
-          }
-        }
-      }
-    }
-    else if ( r->Quantity() == "V0ACORR" ){
-
-      TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
-      if (list){
-
-        Int_t i(-1);
-        Bool_t parFound(kFALSE);
-        while ( i < list->GetEntries() - 1 && !parFound ){
-
-          i++;
-          while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 ) i++;// In case there is a diferent object, just to skip it
-
-          TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
-
-          if ( TString(p->GetName()).Contains("V0ACorr") ){
-            parFound = kTRUE;
-            ok = r->IsInRange(p->GetVal());
-          }
-        }
-      }
-    }
-    else if ( r->Quantity() == "V0CCORR" ){
-
-      TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
-      if (list){
-
-        Int_t i(-1);
-        Bool_t parFound(kFALSE);
-        while ( i < list->GetEntries() - 1 && !parFound ){
-
-          i++;
-          while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 )  i++;// In case there is a diferent object, just to skip it
-
-          TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
-
-          if ( TString(p->GetName()).Contains("V0CCorr") ){
-            parFound = kTRUE;
-            ok = r->IsInRange(p->GetVal());
-          }
-        }
-      }
-    }
-    else if ( r->Quantity() == "V0MCORR" ){
-
-      TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
-      if (list){
-
-        Int_t i(-1);
-        Bool_t parFound(kFALSE);
-        while ( i < list->GetEntries() - 1 && !parFound ){
-
-          i++;
-          while ( list->At(i)->IsA() != TParameter<Double_t>::Class() && i < list->GetEntries() - 1 ) i++;// In case there is a diferent object, just to skip it
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuMinv::GetBinType(const AliAnalysisMuMuBinning::Range& r) const
+{
+  /// Type of a bin range (EBinType), to select the pairs without string comparison
 
-          TParameter<Double_t>* p = static_cast<TParameter<Double_t>*>(list->At(i));
+  if ( r.IsIntegrated() ) return kBinIntegrated;
 
-          if ( TString(p->GetName()).Contains("V0MCorr") ){
-            parFound = kTRUE;
-            ok = r->IsInRange(p->GetVal());
-          }
-        }
-      }
-    }
+  if ( r.Is2D() ){
+    if ( r.AsString().BeginsWith("PTVSY") )      return kBinPtVsY;
+    else if ( r.AsString().BeginsWith("YVSPT") ) return kBinYVsPt;
+    else if ( r.Quantity() == "NTRCORRPT" )      return kBinNtrCorrPt;
+    else if ( r.Quantity() == "NTRCORRY" )       return kBinNtrCorrY;
+    return kBin2DUnknown;
   }
-  return ok;
+
+  if ( r.Quantity() == "PT" )         return kBinPt;
+  if ( r.Quantity() == "Y" )          return kBinY;
+  if ( r.Quantity() == "PHI" )        return kBinPhi;
+  if ( r.Quantity() == "DNCHDETA" )   return kBinDNchDEta;
+  if ( r.Quantity() == "NTRCORR" )    return kBinNtrCorr;
+  if ( r.Quantity() == "RELNTRCORR" ) return kBinRelNtrCorr;
+  if ( r.Quantity() == "V0ACORR" )    return kBinV0ACorr;
+  if ( r.Quantity() == "V0CCORR" )    return kBinV0CCorr;
+  if ( r.Quantity() == "V0MCORR" )    return kBinV0MCorr;
+
+  return kBinOther;
 }
 
 //_____________________________________________________________________________
@@ -1110,6 +1045,9 @@ void AliAnalysisMuMuMinv::SetBinsToFill(const char* particle, const char* bins)
 {
   delete fBinsToFill;
   fBinsToFill = Binning()->CreateBinObjArray(particle,bins,"");
+
+  // the Minv histogram handles depend on the bins
+  ClearPairHistoHandles();
 }
 
 //________________________________________________________________________
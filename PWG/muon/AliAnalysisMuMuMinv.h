@@ -14,10 +14,12 @@
 #include "TString.h"
 #include "TLorentzVector.h"
 #include "TH2.h"
+#include <vector>
 
 class TH2F;
 class AliVParticle;
 class TLorentzVector;
+class TList;
 class AliMergeableCollectionProxy;
 
 class AliAnalysisMuMuMinv : public AliAnalysisMuMuBase
@@ -72,10 +74,70 @@ protected:
 
   void FillHistosForMCEvent(const char* eventSelection,const char* triggerClassName,const char* centrality);
 
-  void FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight);
+  virtual void FillHistosForEvent(const char* eventSelection,const char* triggerClassName,const char* centrality);
+
+  void FillMinvHisto(Int_t id, const char* pairCutName, Bool_t mc, const TLorentzVector* pair4Momentum, Double_t inputWeight);
 
 private:
 
+  /// Handles of the pair histograms (see DefinePairHistoHandles)
+  enum EPairHistoHandle
+  {
+    kPtPaireVsPtTrack=18, ///< after the 18 Pt, Y and Eta distributions (see DistributionHandle)
+    kPtRecVsSim,
+    kNchForJpsi,
+    kNchForPsiP,
+    kMCPt,
+    kMCY,
+    kMCEta,
+    kNofFixedHandles ///< first Minv handle (see MinvHandle)
+  };
+
+  /// Types of bin ranges (see GetBinType)
+  enum EBinType
+  {
+    kBinIntegrated,
+    kBinPtVsY,
+    kBinYVsPt,
+    kBinNtrCorrPt,
+    kBinNtrCorrY,
+    kBin2DUnknown,
+    kBinPt,
+    kBinY,
+    kBinPhi,
+    kBinDNchDEta,
+    kBinNtrCorr,
+    kBinRelNtrCorr,
+    kBinV0ACorr,
+    kBinV0CCorr,
+    kBinV0MCorr,
+    kBinOther
+  };
+
+  /// Multiplicities of the event (see FillHistosForEvent)
+  enum ENchParameter
+  {
+    kNtrCorr,
+    kDNchDEta,
+    kV0ACorr,
+    kV0CCorr,
+    kV0MCorr,
+    kNofNchParameters
+  };
+
+  /// Handle of the Pt (quantity 0), Y (1) or Eta (2) distribution, mix and charge (0, 1=PP, 2=MM)
+  Int_t DistributionHandle(Int_t quantity, Int_t mix, Int_t charge) const { return (quantity*2 + mix)*3 + charge; }
+
+  /// Handle of the Minv histo of a bin, followed by the handles of its mean pT and mean pT square profiles
+  Int_t MinvHandle(Int_t bin, Bool_t accEffCorrected, Int_t mix, Int_t charge) const
+  { return kNofFixedHandles + (((bin*2 + (accEffCorrected ? 1 : 0))*2 + mix)*3 + charge)*3; }
+
+  void DefinePairHistoHandles();
+
+  Int_t GetBinType(const AliAnalysisMuMuBinning::Range& r) const;
+
+  Bool_t FindNchParameter(const TList* list, const char* name, Double_t& value) const;
+
   void CreateMinvHistograms(const char* eventSelection, const char* triggerClassName, const char* centrality);
 
   // normalize the function to its integral in the given range
@@ -91,7 +153,7 @@ private:
 
   Double_t TriggerLptApt(Double_t *x, Double_t *par);
 
-  Bool_t  CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, AliMergeableCollectionProxy* proxy);
+  Bool_t  CheckBinRangeCut(const AliAnalysisMuMuBinning::Range* r, Int_t binType, const TLorentzVector* pair4Momentum, const char* pairCutName);
 
   Bool_t CheckMCTracksMatchingStackAndMother(Int_t labeli, Int_t labelj, AliVParticle* mcTracki, AliVParticle* mcTrackj, Double_t inputWeightMC);
 
@@ -111,8 +173,11 @@ private:
   Double_t fMinvMax;
   Double_t fmcptcutmin;
   Double_t fmcptcutmax;
+  std::vector<Int_t> fBinTypes; //! type of each bin of fBinsToFill (EBinType)
+  Bool_t fHasNchParameter[kNofNchParameters]; //! whether the multiplicity is in the NCH list of the event
+  Double_t fNchParameter[kNofNchParameters]; //! multiplicities of the NCH list of the event
 
-  ClassDef(AliAnalysisMuMuMinv,8) // implementation of AliAnalysisMuMuBase for muon pairs
+  ClassDef(AliAnalysisMuMuMinv,9) // implementation of AliAnalysisMuMuBase for muon pairs
 };
 
 #endif
@@ -91,7 +91,9 @@ fCorrectionPerRun(0x0),
 fAssociatedSimulation(0x0),
 fAssociatedSimulation2(0x0),
 fParticleName(""),
-fConfig(new AliAnalysisMuMuConfig(config))
+fConfig(new AliAnalysisMuMuConfig(config)),
+fNofFitWorkers(1),
+fMCTails()
 {
   GetFileNameAndDirectory(filename);
 
@@ -113,7 +115,9 @@ fCorrectionPerRun(0x0),
 fAssociatedSimulation(0x0),
 fAssociatedSimulation2(0x0),
 fParticleName(""),
-fConfig(0x0)
+fConfig(0x0),
+fNofFitWorkers(1),
+fMCTails()
 {
   /// ctor
 
@@ -1554,6 +1558,9 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
   // To avoid bins with error=0 due to low statstics
   TProfile::Approximate();
 
+  // MC tails are kept only during one call (the simulations may be refitted in between)
+  fMCTails.clear();
+
   static int n(0);
 
   Bool_t mix = kFALSE;
@@ -1639,6 +1646,8 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
   while ( ( bin = static_cast<AliAnalysisMuMuBinning::Range*>(next())) )
   {
     Int_t added(0);
+    TObjArray fitGrid; // fit types of this bin, fitted together (AddFits)
+    fitGrid.SetOwner(kTRUE);
     AliAnalysisMuMuJpsiResult* r    = 0x0;
     Bool_t adoptOk           = kFALSE;
     Bool_t adoptMix          = kFALSE;
@@ -1706,7 +1715,7 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
       AliDebug(1,Form("<<<<<< fitType=%s bin=%s",fitType->String().Data(),bin->Flavour().Data()));
 
       std::cout << "" << std::endl;
-      std::cout << "---------------" << "Fit " << added + 1 << "------------------" << std::endl;
+      std::cout << "---------------" << "Fit " << fitGrid.GetEntriesFast() + 1 << "------------------" << std::endl;
       if(!mix) std::cout << "Fitting " << hname.Data() << " with " << fitType->String().Data() << std::endl;
       else     std::cout << "Fitting " << hname.Data() << " with " << fitType->String().Data() << " and after remmoving backround from mixing " << std::endl;
       std::cout << "" << std::endl;
@@ -1784,7 +1793,7 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
 
         if(!okMCtails) continue;
 
-        added += ( r->AddFit(fitType->String().Data()) == kTRUE );
+        fitGrid.Add(new TObjString(fitType->String().Data()));
       }
 
       // Config. for mpt (see function type)
@@ -1828,7 +1837,7 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
 
           GetParametersFromResult(sMinvfitType,fitMinv);//FIXME: Think about if this is necessary
 
-          added += ( r->AddFit(sMinvfitType.Data()) == kTRUE );
+          fitGrid.Add(new TObjString(sMinvfitType.Data()));
 
           nSubFit++;
         }
@@ -1875,7 +1884,7 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
 
           GetParametersFromResult(sMinvfitType,fitMinv);//FIXME: Think about if this is necessary
 
-          added += ( r->AddFit(sMinvfitType.Data()) == kTRUE );
+          fitGrid.Add(new TObjString(sMinvfitType.Data()));
 
           nSubFit++;
         }
@@ -1931,7 +1940,7 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
             continue; //return 0x0;
           }
 
-          added += ( r->AddFit(sMinvFitType.Data()) == kTRUE );
+          fitGrid.Add(new TObjString(sMinvFitType.Data()));
 
           nSubFit++;
         }
@@ -1957,12 +1966,17 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
           continue;
         }
         // Here we call  FINALLY the fit functions
-        added += ( r->AddFit(fitType->String().Data()) == kTRUE );
+        fitGrid.Add(new TObjString(fitType->String().Data()));
       }
 
       std::cout << "-------------------------------------" << std::endl;
       std::cout << "" << std::endl;
     }
+
+    // Here the fits of the bin are done
+    r->SetNofFitWorkers(fNofFitWorkers);
+    added = r->AddFits(fitGrid);
+
     if ( !added )
     {
       delete fitTypeArray;
@@ -2085,6 +2099,20 @@ Bool_t AliAnalysisMuMu::GetParametersFromMC(TString& fitType, const char* pathCe
         sspectraName.ReplaceAll("-AccEffCorr","");
         sspectraName.Remove(sspectraName.Length());
       }
+
+      // the tails of a given MC spectra and bin are the same for all the fits using them
+      std::string tailsKey(Form("%p:%s:/FitResults%s/%s:%s",static_cast<void*>(currentSIM),subResultName.Data(),spath.Data(),sspectraName.Data(),bin->AsString().Data()));
+      std::map<std::string,std::string>::const_iterator tails = fMCTails.find(tailsKey);
+      if ( tails != fMCTails.end() )
+      {
+        fitType += tails->second.c_str();
+        std::cout << " Using MC " << currentSIM->GetParticleName() << ( subResultName.Contains("PSICB2") ? " CB2" : " NA60New" ) << " tails... " << std::endl;
+        std::cout << std::endl;
+        okMCtails =kTRUE;
+        continue;
+      }
+      Int_t fitTypeLength = fitType.Length();
+
       AliAnalysisMuMuSpectra* minvMCSpectra = 0x0;
       minvMCSpectra = currentSIM->SPECTRA(Form("/FitResults%s/%s",spath.Data(),sspectraName.Data()));
       if (!minvMCSpectra){
@@ -2118,6 +2146,7 @@ Bool_t AliAnalysisMuMu::GetParametersFromMC(TString& fitType, const char* pathCe
         std::cout << " Using MC " << currentSIM->GetParticleName() << " CB2 tails... " << std::endl;
         std::cout << std::endl;
         okMCtails =kTRUE;
+        fMCTails[tailsKey] = TString(fitType(fitTypeLength,fitType.Length()-fitTypeLength)).Data();
       }
       else if ( r && subResultName.Contains("PSINA60NEW") )
       {
@@ -2134,6 +2163,7 @@ Bool_t AliAnalysisMuMu::GetParametersFromMC(TString& fitType, const char* pathCe
         std::cout << " Using MC " << currentSIM->GetParticleName() << " NA60New tails... " << std::endl;
         std::cout << std::endl;
         okMCtails =kTRUE;
+        fMCTails[tailsKey] = TString(fitType(fitTypeLength,fitType.Length()-fitTypeLength)).Data();
       }
       else
       {
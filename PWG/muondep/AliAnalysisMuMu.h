@@ -314,6 +314,8 @@ public:
     Bool_t Upgrade(const char* filename);
 
     void SetParticleName(const char* particleName) { fParticleName = particleName; }
+    /// number of worker processes used to run the fits of a bin (see AliAnalysisMuMuJpsiResult::AddFits)
+    void SetNofFitWorkers(Int_t n) { fNofFitWorkers = n; }
     void SetConfig(const AliAnalysisMuMuConfig& config);
 
     static TFile* FileOpen(const char* file);
@@ -380,7 +382,11 @@ private:
 
     AliAnalysisMuMuConfig* fConfig; // configuration
 
-    ClassDef(AliAnalysisMuMu,12) // class to analysis results from AliAnalysisTaskMuMuXXX tasks
+    Int_t fNofFitWorkers; // number of worker processes for the fits of a bin
+
+    mutable std::map<std::string,std::string> fMCTails; //! tails from the associated simulations, per fit function/spectra/bin (reset in FitParticle)
+
+    ClassDef(AliAnalysisMuMu,13) // class to analysis results from AliAnalysisTaskMuMuXXX tasks
 };
 
 #endif
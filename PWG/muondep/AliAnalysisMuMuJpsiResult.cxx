@@ -29,7 +29,10 @@ ClassImp(AliAnalysisMuMuJpsiResult)
 #include "TMath.h"
 #include "TMethodCall.h"
 #include "TObjArray.h"
+#include "TObjString.h"
 #include "TParameter.h"
+#include "TStopwatch.h"
+#include "RVersion.h"
 #include "AliAnalysisMuMuBinning.h"
 #include "AliLog.h"
 #include <map>
@@ -43,6 +46,10 @@ ClassImp(AliAnalysisMuMuJpsiResult)
 #include "TMinuit.h"
 #include "TCanvas.h"
 #include "TStyle.h"
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
 
 namespace {
 
@@ -104,9 +111,11 @@ fFitFunction(),
 fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
+fNofFitWorkers(1),
 fParticle(""),
 fMinvRS("")
 {
+  fTailLow[0] = fTailHigh[0] = -1.; // no cached tail
 }
 
 //_____________________________________________________________________________
@@ -127,9 +136,12 @@ fFitFunction(),
 fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
+fNofFitWorkers(1),
 fParticle(particle),
 fMinvRS("")
 {
+  fTailLow[0] = fTailHigh[0] = -1.; // no cached tail
+
   SetHisto(h);
 
   DecodeFitType(fitType);
@@ -206,9 +218,12 @@ fFitFunction(),
 fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
+fNofFitWorkers(1),
 fParticle(particle),
 fMinvRS("")
 {
+  fTailLow[0] = fTailHigh[0] = -1.; // no cached tail
+
   SetHisto(h);
 }
 
@@ -228,6 +243,7 @@ fFitFunction(rhs.fFitFunction),
 fFitRejectRangeLow(rhs.fFitRejectRangeLow),
 fFitRejectRangeHigh(rhs.fFitRejectRangeHigh),
 fRejectFitPoints(rhs.fRejectFitPoints),
+fNofFitWorkers(rhs.fNofFitWorkers),
 fParticle(rhs.fParticle),
 fMinvRS(rhs.fMinvRS)
 {
@@ -235,6 +251,8 @@ fMinvRS(rhs.fMinvRS)
   /// Note that the mother is lost
   /// fKeys remains 0x0 so it will be recomputed if need be
 
+  fTailLow[0] = fTailHigh[0] = -1.; // no cached tail
+
   if ( rhs.fHisto )
   {
     fHisto = static_cast<TH1*>(rhs.fHisto->Clone());
@@ -269,6 +287,7 @@ AliAnalysisMuMuJpsiResult& AliAnalysisMuMuJpsiResult::operator=(const AliAnalysi
     fRejectFitPoints     = rhs.fRejectFitPoints;
     fParticle            = rhs.fParticle;
     fMinvRS              = rhs.fMinvRS;
+    fNofFitWorkers       = rhs.fNofFitWorkers;
 
   }
 
@@ -666,18 +685,34 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionSignalCrystalBallExtended(Double_
     return par[0]*(exp(-0.5*t*t));
   }
 
+  // the tail constants only depend on (alpha,n) : they are kept for the next calls,
+  // where the tails are usually the same (fixed tails, psi' and J/psi sharing the tails)
+
   if (t < -absAlpha) //left tail
   {
-    Double_t a =  TMath::Power(par[4]/absAlpha,par[4])*exp(-0.5*absAlpha*absAlpha);
-    Double_t b = par[4]/absAlpha - absAlpha;
+    if ( fTailLow[0] != absAlpha || fTailLow[1] != par[4] )
+    {
+      fTailLow[0] = absAlpha;
+      fTailLow[1] = par[4];
+      fTailLow[2] = TMath::Power(par[4]/absAlpha,par[4])*exp(-0.5*absAlpha*absAlpha);
+      fTailLow[3] = par[4]/absAlpha - absAlpha;
+    }
+    Double_t a = fTailLow[2];
+    Double_t b = fTailLow[3];
     return par[0]*(a/TMath::Power(b - t, par[4]));
   }
 
   if (t >= absAlpha2) //right tail
   {
-
-    Double_t c =  TMath::Power(par[6]/absAlpha2,par[6])*exp(-0.5*absAlpha2*absAlpha2);
-    Double_t d = par[6]/absAlpha2 - absAlpha2;
+    if ( fTailHigh[0] != absAlpha2 || fTailHigh[1] != par[6] )
+    {
+      fTailHigh[0] = absAlpha2;
+      fTailHigh[1] = par[6];
+      fTailHigh[2] = TMath::Power(par[6]/absAlpha2,par[6])*exp(-0.5*absAlpha2*absAlpha2);
+      fTailHigh[3] = par[6]/absAlpha2 - absAlpha2;
+    }
+    Double_t c = fTailHigh[2];
+    Double_t d = fTailHigh[3];
     return par[0]*(c/TMath::Power(d + t, par[6]));
   }
 
@@ -12509,20 +12544,135 @@ Bool_t AliAnalysisMuMuJpsiResult::AddFit(const char* fitType)
 {
   // Add a fit to this result
 
-  if ( !fHisto ) return kFALSE;
+  TMethodCall callEnv;
+
+  AliAnalysisMuMuJpsiResult* r = CreateFit(fitType,callEnv);
+
+  if ( !r ) return kFALSE;
+
+  callEnv.Execute(r);// here fit Method ("fit<SOMETHING>") is called and the fit is proceed.
+
+  return AdoptFit(r);
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuJpsiResult::AddFits(const TObjArray& fitTypes)
+{
+  /// Add a grid of fits (fitTypes is an array of TObjString) to this result.
+  /// Same as calling AddFit for each fit type, in the same order, and returns
+  /// the number of fits added.
+  ///
+  /// The fits of the grid are independent : each one has its own histogram and
+  /// its fit functions are bound to its own subresult. With NofFitWorkers() > 1
+  /// they are scheduled on that many worker processes (ROOT >= 6.10) : TMinuit
+  /// (read back by CheckFitStatus) and TF1::RejectPoint are process-wide, so
+  /// each fit gets its own copy of that state and gives the same result as in
+  /// the serial case. The fitted subresults (with their functions saved as points)
+  /// are sent back and adopted here.
+  ///
+  /// A table with the status, chi2/ndf and time of each fit is printed at the end.
+
+  Int_t nfits = fitTypes.GetEntriesFast();
+
+  TObjArray fits(nfits); // subresults to fit (0x0 if not valid)
+  TObjArray calls(nfits); // their fit methods
+  calls.SetOwner(kTRUE);
+  std::vector<Double_t> times(nfits,0.0);
+
+  for ( Int_t i = 0; i < nfits; ++i )
+  {
+    TObjString* fitType = static_cast<TObjString*>(fitTypes.At(i));
+    if ( !fitType ) continue;
+
+    TMethodCall* callEnv = new TMethodCall;
+    calls.AddAt(callEnv,i);
+    fits.AddAt(CreateFit(fitType->String().Data(),*callEnv),i);
+  }
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+  Int_t nWorkers = TMath::Min(fNofFitWorkers,nfits);
+
+  if ( nWorkers > 1 )
+  {
+    // each fit is done in a worker and sent back with its index and time
+    ROOT::TProcessExecutor workers(nWorkers);
+
+    std::vector<TObjArray*> fitted = workers.Map([&](Int_t i) -> TObjArray*
+    {
+      TObjArray* a = new TObjArray(3);
+      a->SetOwner(kTRUE);
+      AliAnalysisMuMuJpsiResult* r = static_cast<AliAnalysisMuMuJpsiResult*>(fits.At(i));
+      if ( r )
+      {
+        TStopwatch timer;
+        static_cast<TMethodCall*>(calls.At(i))->Execute(r);
+        timer.Stop();
+        a->AddAt(new TParameter<Double_t>("time",timer.RealTime()),1);
+        a->AddAt(r,2);
+        fits.AddAt(0x0,i); // sent back with the array
+      }
+      a->AddAt(new TParameter<Int_t>("index",i),0);
+      return a;
+    },ROOT::TSeqI(nfits));
+
+    // replace the local (not fitted) subresults by the fitted ones
+    fits.Delete();
+    for ( std::vector<TObjArray*>::size_type j = 0; j < fitted.size(); ++j )
+    {
+      TObjArray* a = fitted[j];
+      if ( !a ) continue;
+      Int_t i = static_cast<TParameter<Int_t>*>(a->At(0))->GetVal();
+      if ( a->At(1) ) times[i] = static_cast<TParameter<Double_t>*>(a->At(1))->GetVal();
+      AliAnalysisMuMuJpsiResult* r = static_cast<AliAnalysisMuMuJpsiResult*>(a->RemoveAt(2));
+      if ( r ) r->Histo()->SetDirectory(0); // as in SetHisto
+      fits.AddAt(r,i);
+      a->SetOwner(kTRUE);
+      delete a;
+    }
+  }
+  else
+#endif
+  {
+    for ( Int_t i = 0; i < nfits; ++i )
+    {
+      AliAnalysisMuMuJpsiResult* r = static_cast<AliAnalysisMuMuJpsiResult*>(fits.At(i));
+      if ( !r ) continue;
+      TStopwatch timer;
+      static_cast<TMethodCall*>(calls.At(i))->Execute(r);
+      timer.Stop();
+      times[i] = timer.RealTime();
+    }
+  }
+
+  PrintFitTable(fits,times);
+
+  Int_t nadded(0);
+
+  for ( Int_t i = 0; i < nfits; ++i )
+  {
+    AliAnalysisMuMuJpsiResult* r = static_cast<AliAnalysisMuMuJpsiResult*>(fits.At(i));
+    if ( r && AdoptFit(r) ) ++nadded;
+  }
+
+  return nadded;
+}
 
-  TH1* histo = static_cast<TH1*>(fHisto->Clone(fitType));
+//_____________________________________________________________________________
+AliAnalysisMuMuJpsiResult* AliAnalysisMuMuJpsiResult::CreateFit(const char* fitType, TMethodCall& callEnv)
+{
+  /// Create the subresult for the fit fitType and get its fit method.
+  /// Returns 0x0 if the fit cannot be done.
 
-  AliAnalysisMuMuJpsiResult* r = new AliAnalysisMuMuJpsiResult(GetParticle(),*histo,fitType);
+  if ( !fHisto ) return 0x0;
+
+  AliAnalysisMuMuJpsiResult* r = new AliAnalysisMuMuJpsiResult(GetParticle(),*fHisto,fitType);
 
   if ( !r->IsValid() )
   {
     delete r;
-    return kFALSE;
+    return 0x0;
   }
 
-  TMethodCall callEnv;
-
   TString fittingMethod(r->GetFitFunctionMethodName().Data());
 
   std::cout << "+Using fitting method " << fittingMethod.Data() << "..." << std::endl;
@@ -12530,17 +12680,21 @@ Bool_t AliAnalysisMuMuJpsiResult::AddFit(const char* fitType)
 
   callEnv.InitWithPrototype(IsA(),fittingMethod.Data(),"");
 
-  if (callEnv.IsValid())
-  {
-    callEnv.Execute(r);// here fit Method ("fit<SOMETHING>") is called and the fit is proceed.
-  }
-  else
+  if (!callEnv.IsValid())
   {
     AliError(Form("Could not get the method %s",fittingMethod.Data()));
     delete r;
-    return kFALSE;
+    return 0x0;
   }
 
+  return r;
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuJpsiResult::AdoptFit(AliAnalysisMuMuJpsiResult* r)
+{
+  /// Adopt the fitted subresult r if it is valid (deleted otherwise)
+
   if ( r->IsValid() )
   {
     StdoutToAliDebug(1,r->Print(););
@@ -12566,6 +12720,42 @@ Bool_t AliAnalysisMuMuJpsiResult::AddFit(const char* fitType)
   return (r!=0x0);
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuJpsiResult::PrintFitTable(const TObjArray& fits, const std::vector<Double_t>& times) const
+{
+  /// Print the status (fit result, covariance matrix status), chi2/ndf,
+  /// number of J/psi and time of the fits of a grid
+
+  std::cout << Form("Fits of %s",GetName()) << std::endl;
+  std::cout << Form("  %-40s %9s %6s %10s %22s %9s","fit","FitResult","CovMat","Chi2/NDF","NofJPsi","time (s)") << std::endl;
+
+  Int_t nconverged(0);
+  Int_t nfitted(0);
+  Double_t totalTime(0.0);
+
+  for ( Int_t i = 0; i <= fits.GetLast(); ++i )
+  {
+    const AliAnalysisMuMuJpsiResult* r = static_cast<const AliAnalysisMuMuJpsiResult*>(fits.At(i));
+    if ( !r ) continue;
+
+    ++nfitted;
+    totalTime += times[i];
+
+    TString status("-"), cov("-"), chi2("-"), njpsi("-");
+    if ( r->HasValue("FitResult") ) status.Form("%d",TMath::Nint(r->GetValue("FitResult")));
+    if ( r->HasValue("CovMatrixStatus") ) cov.Form("%d",TMath::Nint(r->GetValue("CovMatrixStatus")));
+    if ( r->HasValue("FitChi2PerNDF") ) chi2.Form("%.3f",r->GetValue("FitChi2PerNDF"));
+    if ( r->HasValue("NofJPsi") ) njpsi.Form("%.1f +- %.1f",r->GetValue("NofJPsi"),r->GetErrorStat("NofJPsi"));
+
+    // same criteria as the retries of the fit methods
+    if ( r->IsValid() && ( status == "0" || status == "4000" ) && cov == "3" ) ++nconverged;
+
+    std::cout << Form("  %-40s %9s %6s %10s %22s %9.2f%s",r->GetName(),status.Data(),cov.Data(),chi2.Data(),njpsi.Data(),times[i],r->IsValid() ? "" : " (invalid)") << std::endl;
+  }
+
+  std::cout << Form("  %d fits, %d converged, %.2f s",nfitted,nconverged,totalTime) << std::endl;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisMuMuJpsiResult::DecodeFitType(const char* fitType)
 {
@@ -31,6 +31,7 @@ FitType: func=PSIPSIPRIMECB2VWG:rebin=1:histoType=minv:alJPsi=0.974323:nlJPsi=7.
 
 #include "TNamed.h"
 #include <TString.h>
+#include <vector>
 #include "AliAnalysisMuMuResult.h"
 #include "AliAnalysisMuMuBinning.h"
 
@@ -39,6 +40,8 @@ class THashList;
 class TF1;
 class TMap;
 class TFitResultPtr;
+class TMethodCall;
+class TObjArray;
 
 class AliAnalysisMuMuJpsiResult : public AliAnalysisMuMuResult
 {
@@ -80,6 +83,12 @@ public:
 
   Bool_t AddFit(const char* fitType);
 
+  Int_t AddFits(const TObjArray& fitTypes);
+
+  /// number of worker processes used by AddFits to run the fits of the grid
+  void SetNofFitWorkers(Int_t n) { fNofFitWorkers = n; }
+  Int_t NofFitWorkers() const { return fNofFitWorkers; }
+
   /** All the fit functions should have a prototype starting like :
 
    AliAnalysisMuMuJpsiResult* FitXXX();
@@ -205,6 +214,12 @@ private:
     kErrorStat=1
   };
 
+  AliAnalysisMuMuJpsiResult* CreateFit(const char* fitType, TMethodCall& callEnv);
+
+  Bool_t AdoptFit(AliAnalysisMuMuJpsiResult* r);
+
+  void PrintFitTable(const TObjArray& fits, const std::vector<Double_t>& times) const;
+
   void DecodeFitType(const char* fitType);
 
   void PrintParticle(const char* particle, const char* opt) const;
@@ -392,11 +407,14 @@ private:
   Double_t fFitRejectRangeLow; // fit range to reject
   Double_t fFitRejectRangeHigh; // fit range to reject
   Bool_t fRejectFitPoints; // whether or not some fit points should be rejected
+  Int_t fNofFitWorkers; //! number of worker processes for AddFits
+  Double_t fTailLow[4]; //! cached left tail of FitFunctionSignalCrystalBallExtended : |alpha|, n, a, b
+  Double_t fTailHigh[4]; //! cached right tail of FitFunctionSignalCrystalBallExtended : |alpha'|, n', c, d
 
   TString fParticle;
   TString fMinvRS; // minv spectra range and sigmaPsiP factor for the mpt fits
 
-  ClassDef(AliAnalysisMuMuJpsiResult,8) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
+  ClassDef(AliAnalysisMuMuJpsiResult,9) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
 };
 
 #endif
@@ -22,6 +22,8 @@
 
 //ROOT
 #include <Riostream.h>
+#include <algorithm>
+#include <utility>
 #include <TCanvas.h>
 #include <TMath.h>
 #include <TAxis.h>
@@ -48,6 +50,40 @@ using std::cerr;
 
 ClassImp(AliBalancePsi)
 
+namespace {
+  //____________________________________________________________________//
+  // Bin search on a TAxis with the result of TAxis::FindBin (0 and
+  // nbins+1 for under- and overflow), used for the Delta eta and Delta phi
+  // of every pair in FillPairsFromMaps: the bin is guessed from the mean
+  // bin width and corrected with the bin edges
+  class PairAxis {
+  public:
+    PairAxis(const TAxis *axis) :
+      fNbins(axis->GetNbins()), fXmin(axis->GetXmin()), fXmax(axis->GetXmax()),
+      fScale(axis->GetNbins()/(axis->GetXmax() - axis->GetXmin())),
+      fVariable(axis->GetXbins()->GetSize() > 0), fEdges(axis->GetNbins() + 1) {
+      for (Int_t k = 1; k <= fNbins; k++) fEdges[k-1] = axis->GetBinLowEdge(k);
+      fEdges[fNbins] = axis->GetBinUpEdge(fNbins);
+    }
+    Int_t FindBin(Double_t x) const {
+      if (x < fXmin) return 0;
+      if (!(x < fXmax)) return fNbins + 1;
+      if (!fVariable) return 1 + Int_t(fNbins*(x - fXmin)/(fXmax - fXmin));
+      Int_t k = Int_t((x - fXmin)*fScale);
+      if (k > fNbins - 1) k = fNbins - 1;
+      while (k > 0 && x < fEdges[k]) k--;
+      while (k < fNbins - 1 && x >= fEdges[k+1]) k++;
+      return k + 1;
+    }
+    Int_t GetNbins() const { return fNbins; }
+  private:
+    Int_t fNbins;
+    Double_t fXmin, fXmax, fScale;
+    Bool_t fVariable;
+    vector<Double_t> fEdges;
+  };
+}
+
 //____________________________________________________________________//
 AliBalancePsi::AliBalancePsi() :
   TObject(), 
@@ -93,6 +129,7 @@ AliBalancePsi::AliBalancePsi() :
   fInvMassCutConversion(0.04),
   fQCut(kFALSE),
   fDeltaPtMin(0.0),
+  fPairMaps(kFALSE),
   fVertexBinning(kFALSE),
   fCustomBinning(""),
   fBinningString(""),
@@ -143,6 +180,7 @@ AliBalancePsi::AliBalancePsi(const AliBalancePsi& balance):
   fResonancesLabelCut(balance.fResonancesLabelCut),
   fQCut(balance.fQCut),
   fDeltaPtMin(balance.fDeltaPtMin),
+  fPairMaps(balance.fPairMaps),
   fVertexBinning(balance.fVertexBinning),
   fCustomBinning(balance.fCustomBinning),
   fBinningString(balance.fBinningString),
@@ -494,6 +532,12 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
   Double_t gWidthForPhi = 0.004266;
   Double_t nSigmaRejection = 3.0;
 
+  // without pair cuts the pair histograms are filled from the particle maps
+  // of the event after the 1st particle loop (see FillPairsFromMaps)
+  Bool_t bPairMaps = fPairMaps && !fResonancesCut && !fResonancePhiCut && !fHBTCut && !fConversionCut && !fQCut &&
+    (particlesMixed || (!fResonancesLabelCut && !fSameLabelMCCut));
+  TArrayD triggerClass(bPairMaps ? iMax : 0);
+
   // 1st particle loop
   for (Int_t i = 0; i < iMax; i++) {
     //AliVParticle* firstParticle = (AliVParticle*) particles->At(i);    
@@ -543,6 +587,11 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     //fill single particle histograms
     if(charge1 > 0)      fHistP->Fill(trackVariablesSingle,0,firstCorrection); //==========================correction
     else if(charge1 < 0) fHistN->Fill(trackVariablesSingle,0,firstCorrection);  //==========================correction
+
+    if(bPairMaps) {
+      triggerClass[i] = trackVariablesSingle[0];
+      continue;
+    }
     
     // 2nd particle loop
     for(Int_t j = 0; j < jMax; j++) {   
@@ -774,8 +823,152 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
       }
     }//end of 2nd particle loop
   }//end of 1st particle loop
+
+  if(bPairMaps)
+    FillPairsFromMaps(particles,particlesMixed != 0,triggerClass,secondEta,secondPhi,secondPt,secondCharge,secondCorrection,vertexZ);
 }  
 
+//____________________________________________________________________//
+void AliBalancePsi::FillPairsFromMaps(TObjArray *particles, Bool_t mixing,
+				      const TArrayD &triggerClass,
+				      const TArrayF &secondEta, const TArrayF &secondPhi,
+				      const TArrayF &secondPt, const TArrayS &secondCharge,
+				      const TArrayD &secondCorrection,
+				      Double_t vertexZ) {
+  // Fills fHistPN, fHistNP, fHistPP and fHistNN without pair cuts.
+  // The particles of the event are mapped by charge and pT bin (and by
+  // event class for the triggers). Each trigger map is correlated with the
+  // associated maps into a dense (charge, pT, Delta eta, Delta phi) map,
+  // which is added to the AliTHn once per filled bin instead of one
+  // AliTHn::Fill per pair. Delta eta and Delta phi are computed and binned
+  // for every pair exactly as in the pair loop (the pair bins are not a
+  // function of the single particle bins), so the binned output is the
+  // same. With momentum ordering, associated maps in pT bins above the
+  // trigger pT are skipped as a whole.
+  AliTHn *hist[2][2] = {{fHistNN, fHistNP}, {fHistPN, fHistPP}}; // [trigger positive][associated positive]
+  TAxis *axisClass   = fHistPN->GetAxis(0,0);
+  TAxis *axisPtTrig  = fHistPN->GetAxis(3,0);
+  TAxis *axisPtAssoc = fHistPN->GetAxis(4,0);
+  PairAxis axisDeltaEta(fHistPN->GetAxis(1,0));
+  PairAxis axisDeltaPhi(fHistPN->GetAxis(2,0));
+  const Int_t nPtAssoc  = axisPtAssoc->GetNbins();
+  const Int_t nDeltaEta = axisDeltaEta.GetNbins();
+  const Int_t nDeltaPhi = axisDeltaPhi.GetNbins();
+
+  Int_t binVertex = fHistPN->GetAxis(5,0)->FindBin(vertexZ);
+  if(binVertex < 1 || binVertex > fHistPN->GetAxis(5,0)->GetNbins()) return;
+
+  // associated particle maps: index = 2*(pT bin - 1) + positive
+  const Int_t nAssocMaps = 2*nPtAssoc;
+  vector<Int_t> assocStart(nAssocMaps + 1, 0);
+  vector<Int_t> assocMap(secondEta.GetSize(), -1);
+  for(Int_t j = 0; j < secondEta.GetSize(); j++) {
+    if(secondCharge[j] == 0) continue;
+    Int_t binPt = axisPtAssoc->FindBin(secondPt[j]);
+    if(binPt < 1 || binPt > nPtAssoc) continue;
+    assocMap[j] = 2*(binPt-1) + (secondCharge[j] > 0);
+    assocStart[assocMap[j]+1]++;
+  }
+  for(Int_t m = 0; m < nAssocMaps; m++) assocStart[m+1] += assocStart[m];
+  vector<Int_t> assoc(assocStart[nAssocMaps]);
+  vector<Int_t> assocFill(assocStart.begin(), assocStart.end() - 1);
+  vector<Float_t> assocPtMin(nAssocMaps, 0.), assocPtMax(nAssocMaps, 0.);
+  for(Int_t j = 0; j < secondEta.GetSize(); j++) {
+    Int_t m = assocMap[j];
+    if(m < 0) continue;
+    if(assocFill[m] == assocStart[m] || secondPt[j] < assocPtMin[m]) assocPtMin[m] = secondPt[j];
+    if(assocFill[m] == assocStart[m] || secondPt[j] > assocPtMax[m]) assocPtMax[m] = secondPt[j];
+    assoc[assocFill[m]++] = j;
+  }
+
+  // trigger maps: key = ((class bin * nPtTrig) + pT bin) * 2 + positive
+  vector<std::pair<Int_t,Int_t> > triggers; // (key, index)
+  for(Int_t i = 0; i < triggerClass.GetSize(); i++) {
+    AliVParticle* firstParticle = (AliVParticle*) particles->At(i);
+    Short_t charge1 = (Short_t) firstParticle->Charge();
+    if(charge1 == 0) continue;
+    Float_t firstPt = firstParticle->Pt();
+    Int_t binClass = axisClass->FindBin(triggerClass[i]);
+    Int_t binPt    = axisPtTrig->FindBin(firstPt);
+    if(binClass < 1 || binClass > axisClass->GetNbins() || binPt < 1 || binPt > axisPtTrig->GetNbins()) continue;
+    triggers.push_back(std::make_pair((binClass*(axisPtTrig->GetNbins()+1) + binPt)*2 + (charge1 > 0), i));
+  }
+  std::sort(triggers.begin(), triggers.end());
+
+  // (associated map, Delta eta, Delta phi) map of one trigger map
+  const Int_t nBins = nAssocMaps*nDeltaEta*nDeltaPhi;
+  vector<Double_t> sumw(nBins, 0.), sumw2(nBins, 0.);
+  vector<Char_t> filled(nBins, 0), weighted(nBins, 0);
+  vector<Int_t> filledBins;
+
+  Int_t binIdx[kTrackVariablesPair];
+  binIdx[5] = binVertex;
+  for(UInt_t t = 0; t < triggers.size(); t++) {
+    Int_t i = triggers[t].second;
+    AliBFBasicParticle* firstParticle = (AliBFBasicParticle*) particles->At(i);
+    Float_t firstEta = firstParticle->Eta();
+    Float_t firstPhi = firstParticle->Phi();
+    Float_t firstPt  = firstParticle->Pt();
+    Float_t firstCorrection = firstParticle->Correction();
+
+    for(Int_t m = 0; m < nAssocMaps; m++) {
+      if(assocStart[m] == assocStart[m+1]) continue;
+      // pT,Assoc < pT,Trig (if momentum ordering is switched ON)
+      Bool_t checkOrdering = kFALSE;
+      if(fMomentumOrdering) {
+	if(firstPt < assocPtMin[m]) continue;
+	checkOrdering = (firstPt < assocPtMax[m]);
+      }
+      for(Int_t a = assocStart[m]; a < assocStart[m+1]; a++) {
+	Int_t j = assoc[a];
+	if(!mixing && j == i) continue; // no auto correlations (only for non mixing)
+	if(checkOrdering && firstPt < secondPt[j]) continue;
+
+	Double_t deltaEta = firstEta - secondEta[j];
+	Double_t deltaPhi = firstPhi - secondPhi[j];
+	if (deltaPhi > TMath::Pi()) // delta phi between -pi and pi 
+	  deltaPhi -= 2.*TMath::Pi();
+	if (deltaPhi <  - TMath::Pi()) 
+	  deltaPhi += 2.*TMath::Pi();
+	if (deltaPhi <  - TMath::Pi()/2.) 
+	  deltaPhi += 2.*TMath::Pi();
+
+	Int_t binEta = axisDeltaEta.FindBin(deltaEta);
+	Int_t binPhi = axisDeltaPhi.FindBin(deltaPhi);
+	if(binEta < 1 || binEta > nDeltaEta || binPhi < 1 || binPhi > nDeltaPhi) continue;
+
+	Double_t weight = firstCorrection*secondCorrection[j];
+	Int_t bin = (m*nDeltaEta + binEta - 1)*nDeltaPhi + binPhi - 1;
+	if(!filled[bin]) {
+	  filled[bin] = 1;
+	  filledBins.push_back(bin);
+	}
+	sumw[bin]  += weight;
+	sumw2[bin] += weight*weight;
+	if(weight != 1) weighted[bin] = 1;
+      }
+    }
+
+    // add the map to the histograms at the end of each trigger map
+    Int_t key = triggers[t].first;
+    if(t + 1 < triggers.size() && triggers[t+1].first == key) continue;
+    Int_t positive = key%2;
+    binIdx[0] = key/2/(axisPtTrig->GetNbins()+1);
+    binIdx[3] = key/2%(axisPtTrig->GetNbins()+1);
+    for(UInt_t f = 0; f < filledBins.size(); f++) {
+      Int_t bin = filledBins[f];
+      Int_t m   = bin/(nDeltaEta*nDeltaPhi);
+      binIdx[1] = (bin/nDeltaPhi)%nDeltaEta + 1;
+      binIdx[2] = bin%nDeltaPhi + 1;
+      binIdx[4] = m/2 + 1;
+      hist[positive][m%2]->AddBinContent(binIdx,0,sumw[bin],sumw2[bin],!weighted[bin]);
+      sumw[bin] = sumw2[bin] = 0.;
+      filled[bin] = weighted[bin] = 0;
+    }
+    filledBins.clear();
+  }
+}
+
 //____________________________________________________________________//
 TH1D *AliBalancePsi::GetBalanceFunctionHistogram(Int_t iVariableSingle,
 						 Int_t iVariablePair,
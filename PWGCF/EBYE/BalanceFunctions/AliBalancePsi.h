@@ -238,6 +238,7 @@ class AliBalancePsi : public TObject {
     fConversionCut = kTRUE; fInvMassCutConversion = setInvMassCutConversion; }
   void UseMomentumDifferenceCut(Double_t gDeltaPtCutMin) {
     fQCut = kTRUE; fDeltaPtMin = gDeltaPtCutMin;}
+  void UsePairMaps(Bool_t pairMaps = kTRUE) {fPairMaps = pairMaps;}
 
   // related to customized binning of output AliTHn
   Bool_t    IsUseVertexBinning() { return fVertexBinning; }
@@ -246,6 +247,12 @@ class AliBalancePsi : public TObject {
 
  private:
   Float_t   GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign); 
+  void      FillPairsFromMaps(TObjArray *particles, Bool_t mixing,
+			      const TArrayD &triggerClass,
+			      const TArrayF &secondEta, const TArrayF &secondPhi,
+			      const TArrayF &secondPt, const TArrayS &secondCharge,
+			      const TArrayD &secondCorrection,
+			      Double_t vertexZ);
 
   Bool_t fShuffle; //shuffled balance function object
   TString fAnalysisLevel; //ESD, AOD or MC
@@ -296,6 +303,7 @@ class AliBalancePsi : public TObject {
   Double_t fInvMassCutConversion;//invariant mass for conversion cut
   Bool_t fQCut;//cut on momentum difference to suppress femtoscopic effect correlations
   Double_t fDeltaPtMin;//delta pt cut: minimum value
+  Bool_t fPairMaps;//fill the pair histograms from per-event particle maps (used only without pair cuts)
   Bool_t fVertexBinning;//use vertex z binning in AliTHn
   TString fCustomBinning;//for setting customized binning
   TString fBinningString;//final binning string
@@ -304,7 +312,7 @@ class AliBalancePsi : public TObject {
 
   AliBalancePsi & operator=(const AliBalancePsi & ) {return *this;}
 
-  ClassDef(AliBalancePsi, 5)
+  ClassDef(AliBalancePsi, 6)
 };
 
 #endif
@@ -47,6 +47,7 @@ The names are available via the function PairClassName(Int_t i)
 #include <TMath.h>
 #include <TObject.h>
 #include <TGrid.h>
+#include <TDatabasePDG.h>
 
 #include <AliKFParticle.h>
 
@@ -160,6 +161,11 @@ AliDielectron::AliDielectron() :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fPairPreSelection(kFALSE),
+  fPairPreSelMinMass(0.),
+  fPairPreSelMaxMass(1.e10),
+  fPairPreSelMinPt(0.),
+  fPairPool(),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -171,6 +177,7 @@ AliDielectron::AliDielectron() :
   //
   // Default constructor
   //
+  fPairPool.SetOwner();
 
 }
 
@@ -237,6 +244,11 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fPairPreSelection(kFALSE),
+  fPairPreSelMinMass(0.),
+  fPairPreSelMaxMass(1.e10),
+  fPairPreSelMinPt(0.),
+  fPairPool(),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -247,6 +259,7 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   //
   // Named constructor
   //
+  fPairPool.SetOwner();
 
 }
 
@@ -1403,20 +1416,61 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
   // select pairs and fill pair candidate arrays
   //
 
-  TObjArray arrTracks1=fTracks[arr1];
-  TObjArray arrTracks2=fTracks[arr2];
+  // the track arrays are only copied if the pre filter removes tracks from them
+  TObjArray *arrTracks1=&fTracks[arr1];
+  TObjArray *arrTracks2=&fTracks[arr2];
+  TObjArray arrTracksPF1, arrTracksPF2;
+
+  Bool_t preFilter1=(!fPreFilterAllSigns1) && (!fPreFilterUnlikeOnly1) && (!fPreFilterLikeOnly1) && ( fPairPreFilter1.GetCuts()->GetEntries()>0 );
+  Bool_t preFilter2=(!fPreFilterAllSigns2) && (!fPreFilterUnlikeOnly2) && (!fPreFilterLikeOnly2) && ( fPairPreFilter2.GetCuts()->GetEntries()>0 );
+  if (preFilter1 || preFilter2) {
+    arrTracksPF1=fTracks[arr1];
+    arrTracksPF2=fTracks[arr2];
+    arrTracks1=&arrTracksPF1;
+    arrTracks2=&arrTracksPF2;
+  }
 
   //process pre filter if set
-  if ((!fPreFilterAllSigns1) && (!fPreFilterUnlikeOnly1) && (!fPreFilterLikeOnly1) && ( fPairPreFilter1.GetCuts()->GetEntries()>0 ))  PairPreFilter(arr1, arr2, arrTracks1, arrTracks2, ev, 1);
+  if (preFilter1)  PairPreFilter(arr1, arr2, *arrTracks1, *arrTracks2, ev, 1);
 
-  if ((!fPreFilterAllSigns2) && (!fPreFilterUnlikeOnly2) && (!fPreFilterLikeOnly2) && ( fPairPreFilter2.GetCuts()->GetEntries()>0 ))  PairPreFilter(arr1, arr2, arrTracks1, arrTracks2, ev, 2);
+  if (preFilter2)  PairPreFilter(arr1, arr2, *arrTracks1, *arrTracks2, ev, 2);
 
   Int_t pairIndex=GetPairIndex(arr1,arr2);
 
-  Int_t ntrack1=arrTracks1.GetEntriesFast();
-  Int_t ntrack2=arrTracks2.GetEntriesFast();
+  Int_t ntrack1=arrTracks1->GetEntriesFast();
+  Int_t ntrack2=arrTracks2->GetEntriesFast();
+
+  // kinematic pre-selection on the leg momenta, only if the rejected pairs are not monitored
+  Bool_t preSelect=fPairPreSelection && !fCfManagerPair && !(pairIndex==kEv1PM && fCutQA);
+  Double_t *kine1=0x0;
+  Double_t *kine2=0x0;
+  Double_t minMass2=fPairPreSelMinMass>0. ? fPairPreSelMinMass*fPairPreSelMinMass : 0.;
+  Double_t maxMass2=fPairPreSelMaxMass*fPairPreSelMaxMass;
+  Double_t minPt2=fPairPreSelMinPt*fPairPreSelMinPt;
+  if (preSelect) {
+    // packed (px,py,pz,E) of the legs, computed once per track instead of once per pair
+    Double_t mass1=TDatabasePDG::Instance()->GetParticle(fPdgLeg1)->Mass();
+    Double_t mass2=TDatabasePDG::Instance()->GetParticle(fPdgLeg2)->Mass();
+    kine1=new Double_t[4*ntrack1];
+    kine2=new Double_t[4*ntrack2];
+    for (Int_t itrack=0; itrack<ntrack1; ++itrack){
+      AliVTrack *trk=static_cast<AliVTrack*>(arrTracks1->UncheckedAt(itrack));
+      Double_t *k=&kine1[4*itrack];
+      k[0]=trk->Px(); k[1]=trk->Py(); k[2]=trk->Pz();
+      k[3]=TMath::Sqrt(k[0]*k[0]+k[1]*k[1]+k[2]*k[2]+mass1*mass1);
+    }
+    for (Int_t itrack=0; itrack<ntrack2; ++itrack){
+      AliVTrack *trk=static_cast<AliVTrack*>(arrTracks2->UncheckedAt(itrack));
+      Double_t *k=&kine2[4*itrack];
+      k[0]=trk->Px(); k[1]=trk->Py(); k[2]=trk->Pz();
+      k[3]=TMath::Sqrt(k[0]*k[0]+k[1]*k[1]+k[2]*k[2]+mass2*mass2);
+    }
+  }
 
-  AliDielectronPair *candidate=new AliDielectronPair;
+  // MC truth lookups only if there is an MC event
+  Bool_t hasMC=AliDielectronMC::Instance()->HasMC();
+
+  AliDielectronPair *candidate=GetPairFromPool();
   candidate->SetKFUsage(fUseKF);
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
@@ -1425,22 +1479,34 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
     Int_t end=ntrack2;
     if (arr1==arr2) end=itrack1;
     for (Int_t itrack2=0; itrack2<end; ++itrack2){
+      if (preSelect) {
+        const Double_t *k1=&kine1[4*itrack1];
+        const Double_t *k2=&kine2[4*itrack2];
+        Double_t px=k1[0]+k2[0], py=k1[1]+k2[1], pz=k1[2]+k2[2], e=k1[3]+k2[3];
+        Double_t pt2=px*px+py*py;
+        Double_t m2=e*e-pt2-pz*pz;
+        if (m2<minMass2 || m2>maxMass2 || pt2<minPt2) continue;
+      }
+
       //create the pair (direct pointer to the memory by this daughter reference are kept also for ME)
-      candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
-                           &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
+      candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1->UncheckedAt(itrack1))), fPdgLeg1,
+                           &(*static_cast<AliVTrack*>(arrTracks2->UncheckedAt(itrack2))), fPdgLeg2);
       candidate->SetType(pairIndex);
 
-      Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother);
-      candidate->SetLabel(label);
-      if (label>-1) candidate->SetPdgCode(fPdgMother);
-      else candidate->SetPdgCode(0);
-
-      // check for gamma kf particle
-      label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,22);
-      if (label>-1 && fUseGammaTracks) {
-        candidate->SetGammaTracks(static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1)), fPdgLeg1,
-                                  static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2)), fPdgLeg2);
-      // should we set the pdgmothercode and the label
+      candidate->SetLabel(-1);
+      candidate->SetPdgCode(0);
+      if (hasMC) {
+        Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother);
+        candidate->SetLabel(label);
+        if (label>-1) candidate->SetPdgCode(fPdgMother);
+
+        // check for gamma kf particle
+        label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,22);
+        if (label>-1 && fUseGammaTracks) {
+          candidate->SetGammaTracks(static_cast<AliVTrack*>(arrTracks1->UncheckedAt(itrack1)), fPdgLeg1,
+                                    static_cast<AliVTrack*>(arrTracks2->UncheckedAt(itrack2)), fPdgLeg2);
+        // should we set the pdgmothercode and the label
+        }
       }
 
       //pair cuts
@@ -1464,12 +1530,27 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
       //add the candidate to the candidate array
       PairArray(pairIndex)->Add(candidate);
       //get a new candidate
-      candidate=new AliDielectronPair;
+      candidate=GetPairFromPool();
       candidate->SetKFUsage(fUseKF);
     }
   }
-  //delete the surplus candidate
-  delete candidate;
+  //keep the surplus candidate for the next combinations
+  fPairPool.AddLast(candidate);
+
+  delete [] kine1;
+  delete [] kine2;
+}
+
+//________________________________________________________________
+AliDielectronPair* AliDielectron::GetPairFromPool()
+{
+  //
+  // return a pair candidate from the pool of the previous events,
+  // a new one is created if the pool is empty
+  //
+  Int_t last=fPairPool.GetEntriesFast()-1;
+  if (last<0) return new AliDielectronPair;
+  return static_cast<AliDielectronPair*>(fPairPool.RemoveAt(last));
 }
 
 //________________________________________________________________
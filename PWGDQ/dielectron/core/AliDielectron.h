@@ -188,6 +188,10 @@ public:
   void SetEventProcess(Bool_t setValue=kTRUE) { fEventProcess=setValue; }
   Bool_t GammaTracksUsed() const { return fUseGammaTracks; }
   void SetUseGammaTracks(Bool_t setValue=kTRUE) { fUseGammaTracks=setValue; }
+  // loose invariant mass / pt window applied to the leg momenta before the pair is built,
+  // has to be wider than the pair cuts. Not applied if the pair CF manager or the cut QA are filled
+  void SetPairPreSelection(Double_t minMass, Double_t maxMass, Double_t minPt=0.)
+    { fPairPreSelection=kTRUE; fPairPreSelMinMass=minMass; fPairPreSelMaxMass=maxMass; fPairPreSelMinPt=minPt; }
   void  FillHistogramsFromPairArray(Bool_t pairInfoOnly=kFALSE);
 
   void FinishEvtVsTrkHistoClass();
@@ -273,6 +277,12 @@ private:
   Bool_t fDontClearArrays;      //Don't clear the arrays at the end of the Process function, needed for external use of pair and tracks
   Bool_t fEventProcess;         //Process event (or pair array)
   Bool_t fUseGammaTracks;       // use function SetGammaTracks for MCtruth photons
+  Bool_t fPairPreSelection;     // apply the kinematic pre-selection on the leg momenta before building the pairs
+  Double_t fPairPreSelMinMass;  // min. invariant mass of the pair pre-selection
+  Double_t fPairPreSelMaxMass;  // max. invariant mass of the pair pre-selection
+  Double_t fPairPreSelMinPt;    // min. pair pt of the pair pre-selection
+
+  TObjArray fPairPool;          //! pool of pair candidates recycled from the previous events
 
   void FillTrackArrays(AliVEvent * const ev, Int_t eventNr=0);
   void EventPlanePreFilter(Int_t arr1, Int_t arr2, TObjArray arrTracks1, TObjArray arrTracks2, const AliVEvent *ev);
@@ -286,6 +296,7 @@ private:
   void ClearArrays();
 
   TObjArray* PairArray(Int_t i);
+  AliDielectronPair* GetPairFromPool();
   TObject* InitEffMap(TString filename, TString generatedname, TString foundname);
 
   static const char* fgkTrackClassNames[4];   //Names for track arrays
@@ -312,7 +323,7 @@ private:
   AliDielectron(const AliDielectron &c);
   AliDielectron &operator=(const AliDielectron &c);
 
-  ClassDef(AliDielectron,17);
+  ClassDef(AliDielectron,18);
 };
 
 inline void AliDielectron::InitPairCandidateArrays()
@@ -345,7 +356,17 @@ inline void AliDielectron::ClearArrays()
     fTracks[i].Clear();
   }
   for (Int_t i=0;i<11;++i){
-    if (PairArray(i)) PairArray(i)->Delete();
+    TObjArray *arr=PairArray(i);
+    if (!arr) continue;
+    // keep the pair objects for the next event instead of deleting them
+    for (Int_t ipair=0; ipair<arr->GetEntriesFast(); ++ipair){
+      TObject *pair=arr->UncheckedAt(ipair);
+      if (pair) fPairPool.AddLast(pair);
+    }
+    // the pairs now belong to the pool: empty the owning array without deleting them
+    arr->SetOwner(kFALSE);
+    arr->Clear();
+    arr->SetOwner(kTRUE);
   }
 }
 
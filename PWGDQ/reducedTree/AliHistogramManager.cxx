@@ -49,7 +49,13 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fFillTablesValid(kFALSE),
+  fFillClassLists(),
+  fFillClassHistStart(),
+  fFillClassCodeStart(),
+  fFillHists(),
+  fFillCodes()
 {
   //
   // Constructor
@@ -71,7 +77,13 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fFillTablesValid(kFALSE),
+  fFillClassLists(),
+  fFillClassHistStart(),
+  fFillClassCodeStart(),
+  fFillHists(),
+  fFillCodes()
 {
   //
   // Constructor
@@ -131,6 +143,7 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
   fMainList.Add(hList);
+  fFillTablesValid = kFALSE;
 }
 
 //_________________________________________________________________
@@ -154,6 +167,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillTablesValid = kFALSE;
   TString hname = name;
   
   Int_t dimension = 1;
@@ -296,6 +310,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillTablesValid = kFALSE;
   TString hname = name;
   
   Int_t dimension = 1;
@@ -441,6 +456,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillTablesValid = kFALSE;
   TString hname = name;
   
   TString titleStr(title);
@@ -494,6 +510,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillTablesValid = kFALSE;
   TString hname = name;
   
   TString titleStr(title);
@@ -620,150 +637,184 @@ THnF* AliHistogramManager::CreateHistogram( const Char_t* name, const Char_t* ti
 
 
 //__________________________________________________________________
-void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
-  //
-  //  fill a class of histograms
-  //
-  THashList* hList = (THashList*)fMainList.FindObject(className);
-  if(!hList) {
-    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
-    cout << "         Histogram list not filled" << endl; */
-    return;
-  }
-  if(!hList) {
-    return;
-  }
-    
-  TIter next(hList);
-  TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
-  Bool_t isSparse=kFALSE;
-  Double_t fillValues[20]={0.0};
-  Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
-  Int_t dimension=0;
-  while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
-    if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    if(isTHn && ((TString)h->ClassName()).Contains("Sparse")) isSparse = kTRUE;
-    dimension = 0;
-    if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
-    uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
-    if(uid>0) {
-      varW = uid%(fNVars+1)-1;
-      if(varW==0) varW=AliReducedVarManager::kNothing;
-      uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
-      if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
-    }
-        
-    if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
-        switch(dimension) {
+void AliHistogramManager::CompileFillTables() {
+  //
+  //  Decode once the histogram type and the variables encoded in the unique IDs of the histograms
+  //  and of their axes, and store them in a flat fill table per histogram class.
+  //  Histograms using variables which are not flagged as used are left out, as in the filling.
+  //
+  fFillClassLists.clear();
+  fFillClassHistStart.clear();
+  fFillClassCodeStart.clear();
+  fFillHists.clear();
+  fFillCodes.clear();
+
+  TIter nextClass(&fMainList);
+  TObject* hList=0x0;
+  while((hList=nextClass())) {
+    if(!hList->InheritsFrom(THashList::Class())) continue;
+    fFillClassLists.push_back(hList);
+    hList->SetUniqueID(fFillClassLists.size());        // handle of the class + 1
+    fFillClassHistStart.push_back(fFillHists.size());
+    fFillClassCodeStart.push_back(fFillCodes.size());
+
+    TIter next((THashList*)hList);
+    TObject* h=0x0;
+    while((h=next())) {
+      Int_t uid = h->GetUniqueID();
+      Bool_t isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+      Bool_t isTHn = ((uid%100)>10 ? kTRUE : kFALSE);
+      Int_t thnDim = (isTHn ? (uid%100)-10 : 0);        // the excess over 10 from the last 2 digits give the dimension of the THn
+
+      uid = (uid-(uid%100))/100;
+      Int_t varT = -1, varW = -1;
+      if(uid>0) {
+        varW = uid%(fNVars+1)-1;
+        if(varW==0) varW=AliReducedVarManager::kNothing;
+        uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
+        if(uid>0) varT = uid - 1;
+      }
+      if(varW>AliReducedVarManager::kNothing && !fUsedVars[varW]) continue;
+
+      Int_t kind = kTHn;
+      Int_t vars[20];
+      Int_t nVars = 0;
+      if(!isTHn) {
+        TH1* h1 = (TH1*)h;
+        vars[nVars++] = h1->GetXaxis()->GetUniqueID();
+        switch(h1->GetDimension()) {
           case 1:
+            kind = kTH1;
             if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
+              kind = kTProfile;
+              vars[nVars++] = h1->GetYaxis()->GetUniqueID();
             }
           break;
           case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
+            kind = kTH2;
+            vars[nVars++] = h1->GetYaxis()->GetUniqueID();
             if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
+              kind = kTProfile2D;
+              vars[nVars++] = h1->GetZaxis()->GetUniqueID();
             }
           break;
           case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
+            kind = kTH3;
+            vars[nVars++] = h1->GetYaxis()->GetUniqueID();
+            vars[nVars++] = h1->GetZaxis()->GetUniqueID();
             if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
+              kind = kTProfile3D;
+              vars[nVars++] = varT;
             }
           break;
           default:
-          break;
-        }  // end switch
-      }
-    }  // end if(!isTHn)
-    else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        if (isSparse) {
-          allVarsGood &= fUsedVars[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-        } else {
-          allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
+            continue;
         }
       }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW]) {
-            if (isSparse) ((THnSparseF*)h)->Fill(fillValues,values[varW]);
-            else          ((THnF*)h)->Fill(fillValues,values[varW]);
-          }
-        }
-        else {
-          if (isSparse) ((THnSparseF*)h)->Fill(fillValues);
-          else          ((THnF*)h)->Fill(fillValues);
-        }
+      else {
+        if(thnDim>20) continue;
+        for(Int_t idim=0;idim<thnDim;++idim)
+          vars[nVars++] = ((THnBase*)h)->GetAxis(idim)->GetUniqueID();
       }
+
+      Bool_t allVarsGood = kTRUE;
+      for(Int_t iv=0;iv<nVars;++iv)
+        if(vars[iv]<0 || !fUsedVars[vars[iv]]) allVarsGood = kFALSE;
+      if(!allVarsGood) continue;
+
+      fFillHists.push_back(h);
+      fFillCodes.push_back(kind);
+      fFillCodes.push_back(varW>AliReducedVarManager::kNothing ? varW : -1);
+      fFillCodes.push_back(nVars);
+      for(Int_t iv=0;iv<nVars;++iv) fFillCodes.push_back(vars[iv]);
+    }
+  }
+  fFillClassHistStart.push_back(fFillHists.size());
+  fFillClassCodeStart.push_back(fFillCodes.size());
+  fFillTablesValid = kTRUE;
+}
+
+//__________________________________________________________________
+Int_t AliHistogramManager::GetHistClassHandle(const Char_t* className) {
+  //
+  //  Return the handle of a histogram class to be used with FillHistClass(Int_t, Float_t*),
+  //  or -1 if the class does not exist. Get it once, after all the histograms were added,
+  //  to avoid the lookup by name for every filled object.
+  //
+  if(!fFillTablesValid) CompileFillTables();
+  TObject* hList = fMainList.FindObject(className);
+  if(!hList) return -1;
+  for(UInt_t i=0;i<fFillClassLists.size();++i)
+    if(fFillClassLists[i]==hList) return i;
+  return -1;
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+  //
+  //  fill a class of histograms
+  //
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) {
+    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
+    cout << "         Histogram list not filled" << endl; */
+    return;
+  }
+  if(!fFillTablesValid) CompileFillTables();
+  FillHistClass(Int_t(hList->GetUniqueID())-1, values);
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classHandle, Float_t* values) {
+  //
+  //  fill a class of histograms using its precompiled fill table
+  //
+  if(!fFillTablesValid) CompileFillTables();
+  if(classHandle<0 || classHandle>=Int_t(fFillClassLists.size())) return;
+  if(fFillClassHistStart[classHandle]==fFillClassHistStart[classHandle+1]) return;
+
+  Double_t fillValues[20]={0.0};
+  const Int_t* code = &fFillCodes[fFillClassCodeStart[classHandle]];
+  for(Int_t ih=fFillClassHistStart[classHandle]; ih<fFillClassHistStart[classHandle+1]; ++ih) {
+    TObject* h = fFillHists[ih];
+    Int_t kind = code[0];
+    Int_t varW = code[1];
+    Int_t nVars = code[2];
+    const Int_t* v = code+3;
+    code += 3+nVars;
+
+    switch(kind) {
+      case kTH1:
+        if(varW>=0) ((TH1F*)h)->Fill(values[v[0]],values[varW]);
+        else        ((TH1F*)h)->Fill(values[v[0]]);
+      break;
+      case kTProfile:
+        if(varW>=0) ((TProfile*)h)->Fill(values[v[0]],values[v[1]],values[varW]);
+        else        ((TProfile*)h)->Fill(values[v[0]],values[v[1]]);
+      break;
+      case kTH2:
+        if(varW>=0) ((TH2F*)h)->Fill(values[v[0]],values[v[1]],values[varW]);
+        else        ((TH2F*)h)->Fill(values[v[0]],values[v[1]]);
+      break;
+      case kTProfile2D:
+        if(varW>=0) ((TProfile2D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[varW]);
+        else        ((TProfile2D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]]);
+      break;
+      case kTH3:
+        if(varW>=0) ((TH3F*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[varW]);
+        else        ((TH3F*)h)->Fill(values[v[0]],values[v[1]],values[v[2]]);
+      break;
+      case kTProfile3D:
+        if(varW>=0) ((TProfile3D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[v[3]],values[varW]);
+        else        ((TProfile3D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[v[3]]);
+      break;
+      case kTHn:
+        for(Int_t idim=0;idim<nVars;++idim) fillValues[idim] = values[v[idim]];
+        if(varW>=0) ((THnBase*)h)->Fill(fillValues,values[varW]);
+        else        ((THnBase*)h)->Fill(fillValues);
+      break;
+      default:
+      break;
     }
   }
 }
@@ -14,6 +14,8 @@
 #include <TList.h>
 #include <THashList.h>
 
+#include <vector>
+
 #include "AliReducedVarManager.h"
 
 class TAxis;
@@ -69,6 +71,8 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  Int_t GetHistClassHandle(const Char_t* className);    // handle to be used in the fast FillHistClass(Int_t,...)
+  void FillHistClass(Int_t classHandle, Float_t* values);
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -105,10 +109,21 @@ class AliHistogramManager : public TObject {
   TString fVariableNames[AliReducedVarManager::kNVars];               //! variable names
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
-  
+
+  // Fill tables compiled from the histogram lists, one entry per histogram class.
+  // For each histogram the code stream holds: kind, weight variable, number of variables, variables
+  enum EFillKind {kTH1=0, kTProfile, kTH2, kTProfile2D, kTH3, kTProfile3D, kTHn};
+  Bool_t fFillTablesValid;                   //! fill tables are up to date with the histogram lists
+  std::vector<TObject*> fFillClassLists;     //! histogram list of each class
+  std::vector<Int_t> fFillClassHistStart;    //! index of the first histogram of each class in fFillHists (+1 end marker)
+  std::vector<Int_t> fFillClassCodeStart;    //! index of the first code of each class in fFillCodes (+1 end marker)
+  std::vector<TObject*> fFillHists;          //! histograms
+  std::vector<Int_t> fFillCodes;             //! fill instructions
+
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
+  void CompileFillTables();
   
-  ClassDef(AliHistogramManager, 4)
+  ClassDef(AliHistogramManager, 5)
 };
 
 #endif
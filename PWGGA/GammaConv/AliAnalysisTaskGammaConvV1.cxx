@@ -54,8 +54,10 @@
 #include "AliAODMCHeader.h"
 #include "AliEventplane.h"
 #include "AliAODEvent.h"
+#include "TBufferFile.h"
 #include <vector>
 #include <map>
+#include <string>
 
 
 ClassImp(AliAnalysisTaskGammaConvV1)
@@ -341,7 +343,14 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
   tBrokenFiles(NULL),
-  fFileNameBroken(NULL)
+  fFileNameBroken(NULL),
+  fDoSharedCutEvaluation(kFALSE),
+  fPhotonCutGroup(),
+  fPhotonSelEvaluated(),
+  fPhotonSelAccepted(),
+  fReaderIndex(),
+  fPairCache(),
+  fNReaderGammas(0)
 {
 
 }
@@ -628,7 +637,14 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
   tBrokenFiles(NULL),
-  fFileNameBroken(NULL)
+  fFileNameBroken(NULL),
+  fDoSharedCutEvaluation(kFALSE),
+  fPhotonCutGroup(),
+  fPhotonSelEvaluated(),
+  fPhotonSelAccepted(),
+  fReaderIndex(),
+  fPairCache(),
+  fNReaderGammas(0)
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -661,7 +677,7 @@ AliAnalysisTaskGammaConvV1::~AliAnalysisTaskGammaConvV1()
     delete[] fWeightCentrality;
     fWeightCentrality = 0x0;
   }
-
+  ClearPairCache();
 }
 //___________________________________________________________
 void AliAnalysisTaskGammaConvV1::InitBack(){
@@ -2165,6 +2181,7 @@ void AliAnalysisTaskGammaConvV1::UserCreateOutputObjects(){
     tBrokenFiles->Branch("fileName",&fFileNameBroken);
     fOutputContainer->Add(tBrokenFiles);
   }
+  InitSharedCutEvaluation();
   OpenFile(1);
   PostData(1, fOutputContainer);
   Int_t nContainerOutput = 2;
@@ -2254,6 +2271,12 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
   }
 
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  if(fDoSharedCutEvaluation){
+    ClearPairCache();
+    fNReaderGammas = fReaderGammas->GetEntriesFast();
+    fPairCache.resize(fNReaderGammas*fNReaderGammas,0x0);
+    for(Int_t i = 0; i < fNReaderGammas; i++) fReaderIndex[fReaderGammas->At(i)] = i;
+  }
 
   // ------------------- BeginEvent ----------------------------
 
@@ -2505,8 +2528,12 @@ void AliAnalysisTaskGammaConvV1::ProcessPhotonCandidates()
     }
 
 
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
+    if(fDoSharedCutEvaluation){
+      if(!IsPhotonSelectedShared(PhotonCandidate,i)) continue;
+    } else {
+      if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
+      if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
+    }
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseElecSharingCut() &&
       !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseToCloseV0sCut()){
       fGammaCandidates->Add(PhotonCandidate); // if no second loop is required add to events good gammas
@@ -3925,6 +3952,12 @@ void AliAnalysisTaskGammaConvV1::ProcessMCParticles()
 void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
   // Conversion Gammas
   if(fGammaCandidates->GetEntries()>1){
+    // smeared photons differ from cut to cut, their pairs can not be shared
+    Bool_t useCache = fDoSharedCutEvaluation && !(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseMCPSmearing() && fIsMC > 0);
+    std::vector<Int_t> readerIndex(fGammaCandidates->GetEntries(),-1);
+    if(useCache){
+      for(Int_t i=0;i<fGammaCandidates->GetEntries();i++) readerIndex[i] = GetReaderIndex(fGammaCandidates->At(i));
+    }
     for(Int_t firstGammaIndex=0;firstGammaIndex<fGammaCandidates->GetEntries()-1;firstGammaIndex++){
       AliAODConversionPhoton *gamma0=dynamic_cast<AliAODConversionPhoton*>(fGammaCandidates->At(firstGammaIndex));
       if (gamma0==NULL) continue;
@@ -3937,9 +3970,13 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
         gamma0->GetTrackLabelNegative() == gamma1->GetTrackLabelPositive() ||
         gamma0->GetTrackLabelPositive() == gamma1->GetTrackLabelNegative() ) continue;
 
-        AliAODConversionMother *pi0cand = new AliAODConversionMother(gamma0,gamma1);
+        AliAODConversionMother *pi0cand = useCache ? GetPairCandidate(gamma0,gamma1,readerIndex[firstGammaIndex],readerIndex[secondGammaIndex]) : 0x0;
+        Bool_t ownCandidate = (pi0cand==0x0);
+        if(ownCandidate){
+          pi0cand = new AliAODConversionMother(gamma0,gamma1);
+          pi0cand->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        }
         pi0cand->SetLabels(firstGammaIndex,secondGammaIndex);
-        pi0cand->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
 
         if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->MesonIsSelected(pi0cand,kTRUE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
           if(fDoCentralityFlat > 0){
@@ -4133,7 +4170,7 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
             }
           }
         }
-        delete pi0cand;
+        if(ownCandidate) delete pi0cand;
         pi0cand=0x0;
       }
     }
@@ -4873,6 +4910,101 @@ void AliAnalysisTaskGammaConvV1::ProcessTrueMesonCandidatesAOD(AliAODConversionM
   }
   return;
 }
+//________________________________________________________________________
+AliAODConversionMother* AliAnalysisTaskGammaConvV1::GetPairCandidate(AliAODConversionPhoton *gamma0, AliAODConversionPhoton *gamma1, Int_t readerIndex0, Int_t readerIndex1){
+  // returns the meson candidate of the two reader photons, built only by the first cut
+  // asking for it in this event; returns 0x0 if the photons are not found in the reader
+  if(readerIndex0<0 || readerIndex1<0 || readerIndex0>=fNReaderGammas || readerIndex1>=fNReaderGammas) return 0x0;
+  // the candidate depends on the order of the photons, which is the same for all the cuts
+  AliAODConversionMother *&cached = fPairCache[readerIndex0*fNReaderGammas+readerIndex1];
+  if(!cached){
+    cached = new AliAODConversionMother(gamma0,gamma1);
+    cached->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+  }
+  return cached;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::ClearPairCache(){
+  for(UInt_t i=0;i<fPairCache.size();i++) delete fPairCache[i];
+  fPairCache.clear();
+  fReaderIndex.clear();
+  fPhotonSelEvaluated.ResetAllBits();
+  fPhotonSelAccepted.ResetAllBits();
+  fNReaderGammas = 0;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::InitSharedCutEvaluation(){
+  // groups the cuts with the same event and photon cut configuration, the first cut of a group
+  // runs the photon selection for all of them.
+  // The configuration is compared on the streamed cut objects, not only on the cut strings, so that
+  // cuts differing in a setting outside the cut string (calibration, weights, MVA, ...) are never grouped.
+  // Photon cut variations differ in the photon selection itself and are not grouped, they only share
+  // the meson candidates of the photon pairs (GetPairCandidate)
+  fPhotonCutGroup.clear();
+  if(!fDoSharedCutEvaluation) return;
+  // the rotation background rotates the reader photons in place and runs the photon
+  // selection on them, the later cuts of the event would not see the same photons
+  if(fDoMesonAnalysis){
+    for(Int_t iCut = 0; iCut<fnCuts; iCut++){
+      if(((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->DoBGCalculation() &&
+         ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseRotationMethod()){
+        AliWarning(Form("cut %d uses the rotation background, shared cut evaluation disabled",iCut));
+        fDoSharedCutEvaluation = kFALSE;
+        return;
+      }
+    }
+  }
+  std::vector<std::string> configuration(fnCuts);
+  for(Int_t iCut = 0; iCut<fnCuts; iCut++){
+    configuration[iCut] = GetStreamedCut(fEventCutArray->At(iCut)) + GetStreamedCut(fCutArray->At(iCut));
+  }
+  fPhotonCutGroup.resize(fnCuts);
+  for(Int_t iCut = 0; iCut<fnCuts; iCut++){
+    fPhotonCutGroup[iCut] = iCut;
+    for(Int_t jCut = 0; jCut<iCut; jCut++){
+      if(fPhotonCutGroup[jCut] != jCut) continue;
+      if(configuration[iCut] != configuration[jCut]) continue;
+      fPhotonCutGroup[iCut] = jCut;
+      break;
+    }
+  }
+}
+
+//________________________________________________________________________
+std::string AliAnalysisTaskGammaConvV1::GetStreamedCut(TObject *cut) const{
+  // streamed data members of a cut object: two cuts with the same bytes have the same configuration
+  if(!cut) return std::string();
+  TBufferFile buffer(TBuffer::kWrite);
+  buffer.WriteObject(cut);
+  return std::string(buffer.Buffer(),buffer.Length());
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskGammaConvV1::IsPhotonSelectedShared(AliAODConversionPhoton *photon, Int_t readerIndex){
+  // photon and in-plane/out-of-plane selection of the current cut, taken from the first cut of
+  // its group if that one already selected the photon in this event
+  Int_t group = fPhotonCutGroup[fiCut];
+  UInt_t bit  = group*fNReaderGammas+readerIndex;
+  if(group != fiCut && fPhotonSelEvaluated.TestBitNumber(bit)) return fPhotonSelAccepted.TestBitNumber(bit);
+
+  Bool_t selected = ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(photon,fInputEvent) &&
+                    ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(photon->GetPhotonPhi(),fEventPlaneAngle);
+  if(group == fiCut){
+    fPhotonSelEvaluated.SetBitNumber(bit);
+    fPhotonSelAccepted.SetBitNumber(bit,selected);
+  }
+  return selected;
+}
+
+//________________________________________________________________________
+Int_t AliAnalysisTaskGammaConvV1::GetReaderIndex(const TObject *photon) const{
+  // index of the photon in the reader, -1 if it is not a reader photon of this event
+  map<const TObject*,Int_t>::const_iterator it = fReaderIndex.find(photon);
+  return it == fReaderIndex.end() ? -1 : it->second;
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvV1::CalculateBackground(){
   Int_t zbin = fBGHandler[fiCut]->GetZBinIndex(fInputEvent->GetPrimaryVertex()->GetZ());
@@ -4893,33 +5025,28 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
         AliAODConversionPhoton currentEventGoodV02 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent2));
 
         if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoBGProbability()){
-          AliAODConversionMother *backgroundCandidateProb = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
-          Double_t massBGprob = backgroundCandidateProb->M();
+          AliAODConversionMother backgroundCandidateProb(&currentEventGoodV0,&currentEventGoodV02);
+          Double_t massBGprob = backgroundCandidateProb.M();
           if(massBGprob>0.1 && massBGprob<0.14){
             if(fRandom.Rndm()>fBGHandler[fiCut]->GetBGProb(zbin,mbin)){
-              delete backgroundCandidateProb;
               continue;
             }
           }
-          delete backgroundCandidateProb;
-          backgroundCandidateProb = 0x0;
         }
 
         RotateParticle(&currentEventGoodV02);
-        AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
-        backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        AliAODConversionMother backgroundCandidate(&currentEventGoodV0,&currentEventGoodV02);
+        backgroundCandidate.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
         if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-          ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-          if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-          else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
+          ->MesonIsSelected(&backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
+          if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
+          else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(),fWeightJetJetMC);
           if(fDoTHnSparse){
-            Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
+            Double_t sparesFill[4] = {backgroundCandidate.M(),backgroundCandidate.Pt(),(Double_t)zbin,(Double_t)mbin};
             if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
             else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
           }
         }
-        delete backgroundCandidate;
-        backgroundCandidate = 0x0;
         }
       }
     }
@@ -4944,20 +5071,18 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
             RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
           }
 
-          AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-          backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+          AliAODConversionMother backgroundCandidate(&currentEventGoodV0,&previousGoodV0);
+          backgroundCandidate.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
           if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-            ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-            if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-            else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
+            ->MesonIsSelected(&backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
+            if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
+            else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(),fWeightJetJetMC);
             if(fDoTHnSparse){
-              Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
+              Double_t sparesFill[4] = {backgroundCandidate.M(),backgroundCandidate.Pt(),(Double_t)zbin,(Double_t)mbin};
               if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
               else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
             }
           }
-          delete backgroundCandidate;
-          backgroundCandidate = 0x0;
         }
         }
       }
@@ -4982,28 +5107,26 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
             }
 
 
-            AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-            backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+            AliAODConversionMother backgroundCandidate(&currentEventGoodV0,&previousGoodV0);
+            backgroundCandidate.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
             if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-              ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-              if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
+              ->MesonIsSelected(&backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
+              if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
               else{
-                  if(!fDoJetAnalysis || (fDoJetAnalysis && !fDoLightOutput)) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
+                  if(!fDoJetAnalysis || (fDoJetAnalysis && !fDoLightOutput)) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(), fWeightJetJetMC);
                   if(fDoJetAnalysis){
                   if(fConvJetReader->GetNJets() > 0){
-                    if(!fDoLightOutput) fHistoMotherBackJetInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
-                    else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightJetJetMC);
+                    if(!fDoLightOutput) fHistoMotherBackJetInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(), fWeightJetJetMC);
+                    else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(), fWeightJetJetMC);
                   }
                 }
               }
               if(fDoTHnSparse){
-                Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
+                Double_t sparesFill[4] = {backgroundCandidate.M(),backgroundCandidate.Pt(),(Double_t)zbin,(Double_t)mbin};
                 if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
                 else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
               }
             }
-            delete backgroundCandidate;
-            backgroundCandidate = 0x0;
           }
         }
         }
@@ -5524,6 +5647,29 @@ void AliAnalysisTaskGammaConvV1::Terminate(const Option_t *)
   //fOutputContainer->Print(); // Will crash on GRID
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::FinishTaskOutput()
+{
+  // with the shared cut evaluation only the first cut of a group filled the photon cut
+  // histograms, the other cuts of the group get the same entries, histogram by histogram
+  for(Int_t iCut = 0; iCut<(Int_t)fPhotonCutGroup.size(); iCut++){
+    if(fPhotonCutGroup[iCut] == iCut) continue;
+    TList *groupHistos = ((AliConversionPhotonCuts*)fCutArray->At(fPhotonCutGroup[iCut]))->GetCutHistograms();
+    TList *cutHistos   = ((AliConversionPhotonCuts*)fCutArray->At(iCut))->GetCutHistograms();
+    if(!groupHistos || !cutHistos || groupHistos == cutHistos) continue;
+    TIter next(groupHistos);
+    TObject *obj = NULL;
+    while((obj = next())){
+      TH1 *groupHist = dynamic_cast<TH1*>(obj);
+      if(!groupHist) continue;
+      TH1 *cutHist = dynamic_cast<TH1*>(cutHistos->FindObject(groupHist->GetName()));
+      if(cutHist && cutHist != groupHist) cutHist->Add(groupHist);
+    }
+  }
+  // the entries are added only once, also if FinishTaskOutput is called again
+  fPhotonCutGroup.clear();
+}
+
 //________________________________________________________________________
 Int_t AliAnalysisTaskGammaConvV1::GetSourceClassification(Int_t daughter, Int_t pdgCode){
 
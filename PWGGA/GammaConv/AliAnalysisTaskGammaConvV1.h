@@ -15,10 +15,12 @@
 #include "TProfile2D.h"
 #include "TH3.h"
 #include "TH3F.h"
+#include "TBits.h"
 #include "TMVA/Tools.h"
 #include "TMVA/Reader.h"
 #include <vector>
 #include <map>
+#include <string>
 
 class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
 
@@ -31,6 +33,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     virtual Bool_t Notify();
     virtual void   UserExec(Option_t *);
     virtual void   Terminate(const Option_t*);
+    virtual void   FinishTaskOutput();
     void InitBack();
 
     void SetV0ReaderName(TString name){fV0ReaderName=name; return;}
@@ -75,6 +78,10 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
                                                                   fClusterCutArray              = CutArray  ;}
 
     void SetDoMaterialBudgetWeightingOfGammasForTrueMesons(Bool_t flag) {fDoMaterialBudgetWeightingOfGammasForTrueMesons = flag;}
+    // evaluate the photon selection once per event for all the cuts with the same event and photon cut
+    // configuration (cut strings and all the other settings of the cut objects), and build the meson
+    // candidate of a photon pair once per event for all the cuts selecting both photons
+    void SetDoSharedCutEvaluation(Bool_t flag)                    { fDoSharedCutEvaluation      = flag    ;}
 
     // BG HandlerSettings
     void SetMoveParticleAccordingToVertex(Bool_t flag)            {fMoveParticleAccordingToVertex = flag;}
@@ -91,6 +98,12 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     void FillMultipleCountMap(map<Int_t,Int_t> &ma, Int_t tobechecked);
     void FillMultipleCountHistoAndClear(map<Int_t,Int_t> &ma, TH1F* hist);
     Double_t GetOriginalInvMass(const AliConversionPhotonBase * photon, AliVEvent * event) const;
+    void InitSharedCutEvaluation();
+    std::string GetStreamedCut(TObject *cut) const;
+    Bool_t IsPhotonSelectedShared(AliAODConversionPhoton *photon, Int_t readerIndex);
+    Int_t GetReaderIndex(const TObject *photon) const;
+    AliAODConversionMother* GetPairCandidate(AliAODConversionPhoton *gamma0, AliAODConversionPhoton *gamma1, Int_t readerIndex0, Int_t readerIndex1);
+    void ClearPairCache();
 
   protected:
     AliV0ReaderV1*                    fV0Reader;                                  //
@@ -390,12 +403,19 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     Bool_t                            fDoMaterialBudgetWeightingOfGammasForTrueMesons;
     TTree*                            tBrokenFiles;                               // tree for keeping track of broken files
     TObjString*                       fFileNameBroken;                            // string object for broken file name
+    Bool_t                            fDoSharedCutEvaluation;                     // share the photon selection and the meson candidates of the event between the cuts
+    std::vector<Int_t>                fPhotonCutGroup;                            //! first cut with the same event and photon cut configuration, for each cut
+    TBits                             fPhotonSelEvaluated;                        //! photon selection of cut group g done for reader photon i, bit g*fNReaderGammas+i
+    TBits                             fPhotonSelAccepted;                         //! photon selection result of cut group g for reader photon i, bit g*fNReaderGammas+i
+    map<const TObject*,Int_t>         fReaderIndex;                               //! index of the reader photons of the event
+    std::vector<AliAODConversionMother*> fPairCache;                              //! meson candidates of the event, index i*fNReaderGammas+j of the reader photons
+    Int_t                             fNReaderGammas;                             //! number of reader photons of the event
 
   private:
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 46);
+    ClassDef(AliAnalysisTaskGammaConvV1, 48);
 };
 
 #endif
@@ -47,7 +47,8 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	fBGEvents(),
 	fBGEventsENeg(),
 	fBGEventsMeson(),
-	fBGEventsMCParticle()
+	fBGEventsMCParticle(),
+	fBGEventsStore()
 {
 	// constructor
 }
@@ -70,7 +71,8 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t binsZ,Int_t
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
-	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents)))
+	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents))),
+	fBGEventsStore(binsZ*binsMultiplicity*nEvents)
 {
 	// constructor
 }
@@ -95,7 +97,8 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t collisionSy
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
-	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents)))
+	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents))),
+	fBGEventsStore(binsZ*binsMultiplicity*nEvents)
 {
 	// constructor
     if(fNBinsMultiplicity>5) fNBinsMultiplicity = 5;
@@ -390,7 +393,8 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(const AliGammaCon
 	fBGEvents(original.fBGEvents),
 	fBGEventsENeg(original.fBGEventsENeg),
 	fBGEventsMeson(original.fBGEventsMeson),
-	fBGEventsMCParticle(original.fBGEventsMCParticle)
+	fBGEventsMCParticle(original.fBGEventsMCParticle),
+	fBGEventsStore(original.fBGEventsStore)
 {
 	//copy constructor	
 }
@@ -645,15 +649,20 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
 
 	//  cout<<"The size of this vector is: "<<fBGEvents[z][m][eventCounter].size()<<endl;
-    for(UInt_t d=0;d<fBGEvents[z][m][eventCounter].size();d++){
-		delete (AliAODConversionPhoton*)(fBGEvents[z][m][eventCounter][d]);
-	}
-	fBGEvents[z][m][eventCounter].clear();
+	// the photons are stored by value in the slot of this (z,m,event), which is reused
+	// event after event: once its capacity is reached no more allocations are done
+	if(fBGEventsStore.size() != (UInt_t)(fNBinsZ*fNBinsMultiplicity*fNEvents)) fBGEventsStore.resize(fNBinsZ*fNBinsMultiplicity*fNEvents);
+	std::vector<AliAODConversionPhoton> &store = fBGEventsStore[(z*fNBinsMultiplicity+m)*fNEvents+eventCounter];
+	store.clear();
 	
 	// add the gammas to the vector
 	for(Int_t i=0; i< eventGammas->GetEntries();i++){
-		//    AliKFParticle *t = new AliKFParticle(*(AliKFParticle*)(eventGammas->At(i)));
-		fBGEvents[z][m][eventCounter].push_back(new AliAODConversionPhoton(*(AliAODConversionPhoton*)(eventGammas->At(i))));
+		store.push_back(*(AliAODConversionPhoton*)(eventGammas->At(i)));
+	}
+	// pointers are only taken once the slot is filled, push_back may have moved the photons
+	fBGEvents[z][m][eventCounter].clear();
+	for(UInt_t d=0;d<store.size();d++){
+		fBGEvents[z][m][eventCounter].push_back(&store[d]);
 	}
 	fBGEventCounter[z][m]++;
 }
@@ -108,7 +108,8 @@ class AliGammaConversionAODBGHandler : public TObject {
 		AliGammaConversionBGVector 			fBGEventsENeg; 					// electron background electron events
 		AliGammaConversionMotherBGVector                fBGEventsMeson; 				// neutral meson background events
 		AliAODMCParticleBGVector 	                fBGEventsMCParticle; 				// MC Particle background events
+		std::vector<std::vector<AliAODConversionPhoton> > fBGEventsStore;		//! photons of fBGEvents stored by value, index (z*fNBinsMultiplicity+m)*fNEvents+event
 		
-	ClassDef(AliGammaConversionAODBGHandler,8)
+	ClassDef(AliGammaConversionAODBGHandler,9)
 };
 #endif
@@ -64,6 +64,7 @@
 #include "AliRDHFCutsDStartoKpipi.h"
 #include "AliAnalysisFilter.h"
 #include "AliAnalysisVertexingHF.h"
+#include "AliHFSecVtxFitter.h"
 #include "AliMixedEvent.h"
 #include "AliESDv0.h"
 #include "AliAODv0.h"
@@ -83,6 +84,7 @@ fAODMap(0),
 fVertexerTracks(0x0),
 fBzkG(0.),
 fSecVtxWithKF(kFALSE),
+fSecVtxWithFastFitter(kFALSE),
 fRecoPrimVtxSkippingTrks(kFALSE),
 fRmTrksFromPrimVtx(kFALSE),
 fV1(0x0),
@@ -138,6 +140,8 @@ fFindVertexForDstar(kTRUE),
 fFindVertexForCascades(kTRUE),
 fV0TypeForCascadeVertex(0),
 fMassCutBeforeVertexing(kFALSE),
+fUsePairDCACache(kFALSE),
+fMaxTrksForDCACache(2000),
 fMassCalc2(0),
 fMassCalc3(0),
 fMassCalc4(0),
@@ -178,6 +182,7 @@ fAODMap(source.fAODMap),
 fVertexerTracks(source.fVertexerTracks),
 fBzkG(source.fBzkG),
 fSecVtxWithKF(source.fSecVtxWithKF),
+fSecVtxWithFastFitter(source.fSecVtxWithFastFitter),
 fRecoPrimVtxSkippingTrks(source.fRecoPrimVtxSkippingTrks),
 fRmTrksFromPrimVtx(source.fRmTrksFromPrimVtx),
 fV1(source.fV1),
@@ -233,6 +238,8 @@ fFindVertexForDstar(source.fFindVertexForDstar),
 fFindVertexForCascades(source.fFindVertexForCascades),
 fV0TypeForCascadeVertex(source.fV0TypeForCascadeVertex),
 fMassCutBeforeVertexing(source.fMassCutBeforeVertexing),
+fUsePairDCACache(source.fUsePairDCACache),
+fMaxTrksForDCACache(source.fMaxTrksForDCACache),
 fMassCalc2(source.fMassCalc2),
 fMassCalc3(source.fMassCalc3),
 fMassCalc4(source.fMassCalc4),
@@ -270,6 +277,7 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fVertexerTracks = source.fVertexerTracks;
   fBzkG = source.fBzkG;
   fSecVtxWithKF = source.fSecVtxWithKF;
+  fSecVtxWithFastFitter = source.fSecVtxWithFastFitter;
   fRecoPrimVtxSkippingTrks = source.fRecoPrimVtxSkippingTrks;
   fRmTrksFromPrimVtx = source.fRmTrksFromPrimVtx;
   fV1 = source.fV1;
@@ -327,6 +335,8 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fFindVertexForCascades = source.fFindVertexForCascades;
   fV0TypeForCascadeVertex = source.fV0TypeForCascadeVertex;
   fMassCutBeforeVertexing = source.fMassCutBeforeVertexing;
+  fUsePairDCACache = source.fUsePairDCACache;
+  fMaxTrksForDCACache = source.fMaxTrksForDCACache;
   fMassCalc2 = source.fMassCalc2;
   fMassCalc3 = source.fMassCalc3;
   fMassCalc4 = source.fMassCalc4;
@@ -618,6 +628,22 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // pair DCA cache: the DCA of an ordered pair of selected tracks is computed
+  // once per event from their parameters at the primary vertex, with the same
+  // call as without the cache, and reused by the 3- and 4-prong loops, which
+  // otherwise recompute it for every outer combination (the 2-prong loop
+  // computes each DCA once anyway and only fills the cache)
+  Double_t *dcaCache=0x0;
+  if(fUsePairDCACache && nSeleTrks>1) {
+    if(nSeleTrks<=fMaxTrksForDCACache) {
+      Int_t nPairs=nSeleTrks*nSeleTrks;
+      dcaCache = new Double_t[nPairs];
+      for(Int_t iPair=0; iPair<nPairs; iPair++) dcaCache[iPair]=-1.;
+    } else {
+      AliWarning(Form("%d selected tracks, more than %d: pair DCA cache not used in this event",nSeleTrks,fMaxTrksForDCACache));
+    }
+  }
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -859,6 +885,12 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
       }
 
+      // DCA between the two tracks (from the cache, if available)
+      if(dcaCache) {
+	dcap1n1 = GetCachedPairDCA(tracksAtVertex,nSeleTrks,iTrkP1,iTrkN1,dcaCache);
+	if(dcap1n1>dcaMax) { negtrack1=0; continue; }
+      }
+
       // back to primary vertex
       //      postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
       //      negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -867,8 +899,10 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       negtrack1->GetPxPyPz(momneg1);
 
       // DCA between the two tracks
-      dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
-      if(dcap1n1>dcaMax) { negtrack1=0; continue; }
+      if(!dcaCache) {
+	dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+	if(dcap1n1>dcaMax) { negtrack1=0; continue; }
+      }
 
       // Vertexing
       twoTrackArray1->AddAt(postrack1,0);
@@ -1131,10 +1165,17 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	//printf("********** %d %d %d\n",postrack1->GetID(),postrack2->GetID(),negtrack1->GetID());
 
-	dcap2n1 = postrack2->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
-	if(dcap2n1>dcaMax) { postrack2=0; continue; }
-	dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
-	if(dcap1p2>dcaMax) { postrack2=0; continue; }
+	if(dcaCache) {
+	  dcap2n1 = GetCachedPairDCA(tracksAtVertex,nSeleTrks,iTrkP2,iTrkN1,dcaCache);
+	  if(dcap2n1>dcaMax) { postrack2=0; continue; }
+	  dcap1p2 = GetCachedPairDCA(tracksAtVertex,nSeleTrks,iTrkP2,iTrkP1,dcaCache);
+	  if(dcap1p2>dcaMax) { postrack2=0; continue; }
+	} else {
+	  dcap2n1 = postrack2->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+	  if(dcap2n1>dcaMax) { postrack2=0; continue; }
+	  dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
+	  if(dcap1p2>dcaMax) { postrack2=0; continue; }
+	}
 
 	// check invariant mass cuts for D+,Ds,Lc
         massCutOK=kTRUE;
@@ -1179,7 +1220,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	// 3 prong candidates
 	if(f3Prong && massCutOK) {
 
-	  AliAODVertex* secVert3PrAOD = ReconstructSecondaryVertex(threeTrackArray,dispersion);
+	  AliAODVertex* secVert3PrAOD = ReconstructCandidateVertex(threeTrackArray,dispersion);
 	  io3Prong = Make3Prong(threeTrackArray,event,secVert3PrAOD,dispersion,vertexp1n1,vertexp2n1,dcap1n1,dcap2n1,dcap1p2,okForLcTopKpi,okForDsToKKpi,ok3Prong);
 	  if(ok3Prong) {
             AliAODVertex *v3Prong=0x0;
@@ -1275,10 +1316,17 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    SetParametersAtVertex(postrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP2));
 	    SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 
-	    dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
-	    if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
-            dcap2n2 = postrack2->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
-            if(dcap2n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
+	    if(dcaCache) {
+	      dcap1n2 = GetCachedPairDCA(tracksAtVertex,nSeleTrks,iTrkP1,iTrkN2,dcaCache);
+	      if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
+	      dcap2n2 = GetCachedPairDCA(tracksAtVertex,nSeleTrks,iTrkP2,iTrkN2,dcaCache);
+	      if(dcap2n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
+	    } else {
+	      dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	      if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
+	      dcap2n2 = postrack2->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	      if(dcap2n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
+	    }
 
 
 	    fourTrackArray->AddAt(postrack1,0);
@@ -1298,7 +1346,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    }
 
 	    // Vertexing
-	    AliAODVertex* secVert4PrAOD = ReconstructSecondaryVertex(fourTrackArray,dispersion);
+	    AliAODVertex* secVert4PrAOD = ReconstructCandidateVertex(fourTrackArray,dispersion);
 	    io4Prong = Make4Prong(fourTrackArray,event,secVert4PrAOD,vertexp1n1,vertexp1n1p2,dcap1n1,dcap1n2,dcap2n1,dcap2n2,ok4Prong);
 	    if(ok4Prong) {
 	      rd = new(aodCharm4ProngRef[i4Prong++])AliAODRecoDecayHF4Prong(*io4Prong);
@@ -1409,10 +1457,17 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 	//printf("********** %d %d %d\n",postrack1->GetID(),negtrack1->GetID(),negtrack2->GetID());
 
-	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
-	if(dcap1n2>dcaMax) { negtrack2=0; continue; }
-	dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
-	if(dcan1n2>dcaMax) { negtrack2=0; continue; }
+	if(dcaCache) {
+	  dcap1n2 = GetCachedPairDCA(tracksAtVertex,nSeleTrks,iTrkP1,iTrkN2,dcaCache);
+	  if(dcap1n2>dcaMax) { negtrack2=0; continue; }
+	  dcan1n2 = GetCachedPairDCA(tracksAtVertex,nSeleTrks,iTrkN1,iTrkN2,dcaCache);
+	  if(dcan1n2>dcaMax) { negtrack2=0; continue; }
+	} else {
+	  dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	  if(dcap1n2>dcaMax) { negtrack2=0; continue; }
+	  dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	  if(dcan1n2>dcaMax) { negtrack2=0; continue; }
+	}
 
 	threeTrackArray->AddAt(negtrack1,0);
 	threeTrackArray->AddAt(postrack1,1);
@@ -1446,7 +1501,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	}
 
 	if(f3Prong) {
-	  AliAODVertex* secVert3PrAOD = ReconstructSecondaryVertex(threeTrackArray,dispersion);
+	  AliAODVertex* secVert3PrAOD = ReconstructCandidateVertex(threeTrackArray,dispersion);
 	  io3Prong = Make3Prong(threeTrackArray,event,secVert3PrAOD,dispersion,vertexp1n1,vertexp1n2,dcap1n1,dcap1n2,dcan1n2,okForLcTopKpi,okForDsToKKpi,ok3Prong);
 	  if(ok3Prong) {
 	    AliAODVertex *v3Prong = 0x0;
@@ -1546,6 +1601,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   fourTrackArray->Delete();  delete fourTrackArray;
   delete [] seleFlags; seleFlags=NULL;
   if(evtNumber) {delete [] evtNumber; evtNumber=NULL;}
+  if(dcaCache) {delete [] dcaCache; dcaCache=NULL;}
   tracksAtVertex.Delete();
 
   if(fInputAOD) {
@@ -2899,6 +2955,8 @@ void AliAnalysisVertexingHF::PrintStatus() const {
   //   fTrackFilter->Dump();
   if(fSecVtxWithKF) {
     printf("Secondary vertex with Kalman filter package (AliKFParticle)\n");
+  } else if(fSecVtxWithFastFitter) {
+    printf("Secondary vertex with AliHFSecVtxFitter\n");
   } else {
     printf("Secondary vertex with AliVertexerTracks\n");
   }
@@ -2957,6 +3015,14 @@ AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertex(TObjArray *trkA
   AliESDVertex *vertexESD = 0;
   AliAODVertex *vertexAOD = 0;
 
+  if(fSecVtxWithFastFitter && !fSecVtxWithKF) { // stack-based fitter, no intermediate AliESDVertex
+    Double_t pos[3],cov[6],chi2perNDF;
+    if(!FitSecondaryVertex(trkArray,pos,cov,chi2perNDF,dispersion)) return vertexAOD;
+    Int_t nprongs= (useTRefArray ? 0 : trkArray->GetEntriesFast());
+    vertexAOD = new AliAODVertex(pos,cov,chi2perNDF,0x0,-1,AliAODVertex::kUndef,nprongs);
+    return vertexAOD;
+  }
+
   if(!fSecVtxWithKF) { // AliVertexerTracks
 
     fVertexerTracks->SetVtxStart(fV1);
@@ -3010,6 +3076,77 @@ AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertex(TObjArray *trkA
   return vertexAOD;
 }
 //-----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::FitSecondaryVertex(TObjArray *trkArray,Double_t *pos,Double_t *cov,
+						   Double_t &chi2perNDF,Double_t &dispersion) const
+{
+  /// Secondary vertex with AliHFSecVtxFitter, without creating any object.
+  /// The fitter follows fVertexerTracks as used in ReconstructSecondaryVertex
+  /// (VertexForSelectedESDTracks from fV1, with the fitter and without the
+  /// diamond constraint) and the same selection is applied: all the tracks
+  /// have to contribute and the vertex has to be inside the beam pipe.
+  /// pos, cov, chi2perNDF and dispersion are set only if kTRUE is returned
+
+  AliHFSecVtxFitter fitter(fBzkG);
+  Double_t posStart[3];
+  fV1->GetXYZ(posStart);
+  fitter.SetStartPoint(posStart);
+  AliHFSecVtxFitter::VertexFit fit;
+  if(!fitter.Fit(trkArray,fit)) return kFALSE;
+
+  if(fit.fNContributors!=trkArray->GetEntriesFast()) {
+    //AliDebug(2,"vertexing failed");
+    return kFALSE;
+  }
+
+  if(fit.fPos[0]*fit.fPos[0]+fit.fPos[1]*fit.fPos[1]>8.){
+    // vertex outside beam pipe, reject candidate to avoid propagation through material
+    return kFALSE;
+  }
+
+  for(Int_t i=0; i<3; i++) pos[i]=fit.fPos[i];
+  for(Int_t i=0; i<6; i++) cov[i]=fit.fCov[i];
+  chi2perNDF = fit.GetChi2perNDF();
+  dispersion = fit.fDispersion;
+
+  return kTRUE;
+}
+//-----------------------------------------------------------------------------
+AliAODVertex* AliAnalysisVertexingHF::ReconstructCandidateVertex(TObjArray *trkArray,Double_t &dispersion)
+{
+  /// Secondary vertex of a 3 or 4 prong candidate, given to Make3Prong or
+  /// Make4Prong. With the fast fitter, their invariant mass cut at the
+  /// secondary vertex is applied to the fit result before the AliAODVertex
+  /// is built, so that nothing is allocated for the rejected combinations
+
+  Int_t nTrks=trkArray->GetEntriesFast();
+  if(!fSecVtxWithFastFitter || fSecVtxWithKF || fMassCutBeforeVertexing || nTrks<3 || nTrks>4)
+    return ReconstructSecondaryVertex(trkArray,dispersion);
+
+  Double_t pos[3],cov[6],chi2perNDF,disp;
+  if(!FitSecondaryVertex(trkArray,pos,cov,chi2perNDF,disp)) return 0x0;
+
+  // daughter momenta at the secondary vertex, as in Make3Prong/Make4Prong
+  AliESDVertex secVert(pos,cov,0.,nTrks);
+  Double_t px[4],py[4],pz[4],momentum[3];
+  for(Int_t i=0; i<nTrks; i++) {
+    AliExternalTrackParam trk(*(AliExternalTrackParam*)trkArray->UncheckedAt(i));
+    trk.PropagateToDCA(&secVert,fBzkG,kVeryBig);
+    trk.GetPxPyPz(momentum);
+    px[i] = momentum[0]; py[i] = momentum[1]; pz[i] = momentum[2];
+  }
+
+  Bool_t okMassCut=kFALSE;
+  if(nTrks==3) {
+    if(f3Prong && SelectInvMassAndPt3prong(px,py,pz)) okMassCut=kTRUE;
+  } else {
+    if(!(fCutsD0toKpipipi->GetUsePID()) && SelectInvMassAndPt4prong(px,py,pz)) okMassCut=kTRUE;
+  }
+  if(!okMassCut) return 0x0;
+
+  dispersion = disp;
+  return new AliAODVertex(pos,cov,chi2perNDF,0x0,-1,AliAODVertex::kUndef,0);
+}
+//-----------------------------------------------------------------------------
 Bool_t AliAnalysisVertexingHF::SelectInvMassAndPt3prong(TObjArray *trkArray){
   /// Invariant mass cut on tracks
   //AliCodeTimerAuto("",0);
@@ -3369,6 +3506,25 @@ Bool_t AliAnalysisVertexingHF::SelectInvMassAndPtCascade(Double_t *px,
   return retval;
 }
 //-----------------------------------------------------------------------------
+Double_t AliAnalysisVertexingHF::GetCachedPairDCA(const TObjArray &tracksAtVertex,
+						  Int_t nSeleTrks,Int_t iTrk1,Int_t iTrk2,
+						  Double_t *dcaCache) const {
+  /// Return the DCA of track iTrk1 to track iTrk2 (iTrk1->GetDCA(iTrk2)),
+  /// computed from their parameters at the primary vertex only the first
+  /// time the ordered pair is requested. The pairs are kept ordered, so that
+  /// the value is the one of the direct call also in like-sign mode (GetDCA
+  /// is not bitwise symmetric). The cache is an array of size n^2.
+
+  Int_t index=iTrk1*nSeleTrks+iTrk2;
+  if(dcaCache[index]<0.) {
+    Double_t xdummy,ydummy;
+    const AliExternalTrackParam *t1=(const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk1);
+    const AliExternalTrackParam *t2=(const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk2);
+    dcaCache[index]=t1->GetDCA(t2,fBzkG,xdummy,ydummy);
+  }
+  return dcaCache[index];
+}
+//-----------------------------------------------------------------------------
 void AliAnalysisVertexingHF::SelectTracksAndCopyVertex(const AliVEvent *event,
 						       Int_t trkEntries,
 						       TObjArray &seleTrksArray,
@@ -74,6 +74,7 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t RecoSecondaryVertexForCascades(AliVEvent *event, AliAODRecoCascadeHF *rc);
   void PrintStatus() const;
   void SetSecVtxWithKF() { fSecVtxWithKF=kTRUE; }
+  void SetSecVtxWithFastFitter(Bool_t flag=kTRUE) { fSecVtxWithFastFitter=flag; }
   void SetD0toKpiOn() { fD0toKpi=kTRUE; }
   void SetD0toKpiOff() { fD0toKpi=kFALSE; }
   void SetJPSItoEleOn() { fJPSItoEle=kTRUE; }
@@ -179,6 +180,9 @@ class AliAnalysisVertexingHF : public TNamed {
   void SetCutsDStartoKpipi(AliRDHFCutsDStartoKpipi* cuts) { fCutsDStartoKpipi = cuts; }
   AliRDHFCutsDStartoKpipi* GetCutsDStartoKpipi() const { return fCutsDStartoKpipi; }
   void SetMassCutBeforeVertexing(Bool_t flag) { fMassCutBeforeVertexing=flag; }
+  void SetUsePairDCACache(Bool_t flag=kTRUE, Int_t maxTrksForDCACache=2000) {
+    fUsePairDCACache=flag; fMaxTrksForDCACache=maxTrksForDCACache; }
+  Bool_t GetUsePairDCACache() const { return fUsePairDCACache; }
 
   void SetMasses();
   Bool_t CheckCutsConsistency();
@@ -259,6 +263,7 @@ class AliAnalysisVertexingHF : public TNamed {
   Double_t fBzkG; /// z componenent of field in kG
 
   Bool_t fSecVtxWithKF; /// if kTRUE use KF vertexer, else AliVertexerTracks
+  Bool_t fSecVtxWithFastFitter; /// if kTRUE use the allocation-free AliHFSecVtxFitter
 
   Bool_t fRecoPrimVtxSkippingTrks; /// flag for primary vertex reco on the fly
                                    /// for each candidate, w/o its daughters
@@ -326,6 +331,8 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t fFindVertexForCascades;  /// reconstruct a secondary vertex or assume it's from the primary vertex
   Int_t  fV0TypeForCascadeVertex;  /// Select which V0 type we want to use for the cascas
   Bool_t fMassCutBeforeVertexing; /// to go faster in PbPb
+  Bool_t fUsePairDCACache;       /// compute the DCA of each ordered track pair once per event (3- and 4-prong loops)
+  Int_t  fMaxTrksForDCACache;    /// max. number of selected tracks for which the pair DCA cache is allocated (n^2 doubles)
   // dummies for invariant mass calculation
   AliAODRecoDecay *fMassCalc2; /// for 2 prong
   AliAODRecoDecay *fMassCalc3; /// for 3 prong
@@ -395,6 +402,9 @@ class AliAnalysisVertexingHF : public TNamed {
   void MapAODtracks(AliVEvent *aod);
   AliAODVertex* PrimaryVertex(const TObjArray *trkArray=0x0,AliVEvent *event=0x0) const;
   AliAODVertex* ReconstructSecondaryVertex(TObjArray *trkArray,Double_t &dispersion,Bool_t useTRefArray=kTRUE) const;
+  AliAODVertex* ReconstructCandidateVertex(TObjArray *trkArray,Double_t &dispersion);
+  Bool_t FitSecondaryVertex(TObjArray *trkArray,Double_t *pos,Double_t *cov,
+			    Double_t &chi2perNDF,Double_t &dispersion) const;
 
   Bool_t SelectInvMassAndPt3prong(Double_t *px,Double_t *py,Double_t *pz, Int_t pidLcStatus=3);
   Bool_t SelectInvMassAndPt4prong(Double_t *px,Double_t *py,Double_t *pz);
@@ -402,6 +412,8 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t SelectInvMassAndPtJpsiee(Double_t *px,Double_t *py,Double_t *pz);
   Bool_t SelectInvMassAndPtDstarD0pi(Double_t *px,Double_t *py,Double_t *pz);
   Bool_t SelectInvMassAndPtCascade(Double_t *px,Double_t *py,Double_t *pz);
+  Double_t GetCachedPairDCA(const TObjArray &tracksAtVertex,Int_t nSeleTrks,Int_t iTrk1,Int_t iTrk2,
+			    Double_t *dcaCache) const;
 
   Bool_t SelectInvMassAndPt3prong(TObjArray *trkArray);
   Bool_t SelectInvMassAndPt4prong(TObjArray *trkArray);
@@ -422,7 +434,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,27);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,28);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
@@ -0,0 +1,214 @@
+/**************************************************************************
+ * Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//----------------------------------------------------------------------------
+//    Implementation of the lightweight secondary vertex fitter
+//    for HF 2, 3 and 4 prong candidates.
+//    The algorithm follows AliVertexerTracks as configured in
+//    AliAnalysisVertexingHF: weighted straight-line minimum distance
+//    finder seeded at the start point (which gives the dispersion),
+//    followed by a fit of the track (y,z) positions at the vertex with
+//    their covariances, without constraint.
+//----------------------------------------------------------------------------
+
+#include <TMath.h>
+#include <TObjArray.h>
+
+#include "AliExternalTrackParam.h"
+#include "AliHFSecVtxFitter.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHFSecVtxFitter);
+/// \endcond
+
+//-----------------------------------------------------------------------------
+AliHFSecVtxFitter::AliHFSecVtxFitter(Double_t bzkG) :
+TObject(),
+fBzkG(bzkG),
+fMaxIterations(3),
+fMinShift(1.e-4)
+{
+  /// Default constructor
+  fStart[0]=fStart[1]=fStart[2]=0.;
+}
+//-----------------------------------------------------------------------------
+Bool_t AliHFSecVtxFitter::Fit(const TObjArray *trkArray, VertexFit &fit) const
+{
+  /// Fit the vertex of the tracks in the array (AliExternalTrackParam
+  /// or derived, e.g. AliESDtrack)
+
+  const AliExternalTrackParam *tracks[kMaxTracks];
+  Int_t nTrks=trkArray->GetEntriesFast();
+  if(nTrks<2 || nTrks>kMaxTracks) return kFALSE;
+  for(Int_t i=0; i<nTrks; i++) {
+    tracks[i]=(const AliExternalTrackParam*)trkArray->UncheckedAt(i);
+    if(!tracks[i]) return kFALSE;
+  }
+  return Fit(tracks,nTrks,fit);
+}
+//-----------------------------------------------------------------------------
+Bool_t AliHFSecVtxFitter::Fit(const AliExternalTrackParam **tracks, Int_t nTrks,
+			      VertexFit &fit) const
+{
+  /// Find and fit the vertex of nTrks (2 to 4) tracks.
+  /// The input tracks are not modified, all the work is done on copies
+  /// on the stack. Returns kFALSE if a propagation or inversion fails.
+
+  if(nTrks<2 || nTrks>kMaxTracks) return kFALSE;
+  fit.fNContributors=0;
+
+  AliExternalTrackParam trk[kMaxTracks];
+  Double_t r[kMaxTracks][3];
+  Double_t u[kMaxTracks][3];
+
+  // vertex finder, as AliVertexerTracks::VertexFinder with the weighted
+  // minimum distance algorithm: straight lines tangent to the tracks at
+  // the start point, weighted with the track position errors
+  const Double_t kMinSigma2=1.e-12; // lower bound of the line position errors (cm^2)
+  Double_t a[3][3]={{0.,0.,0.},{0.,0.,0.},{0.,0.,0.}};
+  Double_t b[3]={0.,0.,0.};
+  for(Int_t i=0; i<nTrks; i++) {
+    trk[i]=*tracks[i];
+    if(!PropagateToPoint(trk[i],fStart)) return kFALSE;
+    trk[i].GetXYZ(r[i]);
+    trk[i].GetPxPyPz(u[i]);
+    Double_t norm=TMath::Sqrt(u[i][0]*u[i][0]+u[i][1]*u[i][1]+u[i][2]*u[i][2]);
+    if(norm<1.e-10) return kFALSE;
+    for(Int_t k=0; k<3; k++) u[i][k]/=norm;
+    Double_t sn=TMath::Sin(trk[i].GetAlpha());
+    Double_t cs=TMath::Cos(trk[i].GetAlpha());
+    Double_t wd[3]={sn*sn*trk[i].GetSigmaY2(),cs*cs*trk[i].GetSigmaY2(),trk[i].GetSigmaZ2()};
+    for(Int_t k=0; k<3; k++) wd[k]=1./TMath::Max(wd[k],kMinSigma2);
+    // M = W - W u u^T W / (u^T W u), with W=diag(wd)
+    Double_t uwu=wd[0]*u[i][0]*u[i][0]+wd[1]*u[i][1]*u[i][1]+wd[2]*u[i][2]*u[i][2];
+    for(Int_t j=0; j<3; j++) {
+      for(Int_t k=0; k<3; k++) {
+	Double_t m=(j==k ? wd[j] : 0.)-wd[j]*u[i][j]*u[i][k]*wd[k]/uwu;
+	a[j][k]+=m;
+	b[j]+=m*r[i][k];
+      }
+    }
+  }
+  Double_t ainv[3][3];
+  if(!Invert3x3(a,ainv)) return kFALSE;
+  Double_t vtx[3];
+  for(Int_t j=0; j<3; j++) vtx[j]=ainv[j][0]*b[0]+ainv[j][1]*b[1]+ainv[j][2]*b[2];
+
+  // dispersion of the lines around the found point, as stored in the
+  // AliESDVertex by AliVertexerTracks (sqrt of the sum of the squared distances)
+  Double_t sigma=0.;
+  for(Int_t i=0; i<nTrks; i++) {
+    Double_t d[3]={vtx[0]-r[i][0],vtx[1]-r[i][1],vtx[2]-r[i][2]};
+    Double_t dotu=d[0]*u[i][0]+d[1]*u[i][1]+d[2]*u[i][2];
+    for(Int_t k=0; k<3; k++) d[k]-=dotu*u[i][k];
+    sigma+=d[0]*d[0]+d[1]*d[1]+d[2]*d[2];
+  }
+  fit.fDispersion=(sigma>0. ? TMath::Sqrt(sigma) : 999.);
+
+  // vertex fitter: weighted mean of the track positions at the vertex,
+  // with weight matrices from the (y,z) covariance in the track frame
+  Double_t w[kMaxTracks][3][3];
+  Double_t cov[3][3];
+  for(Int_t iter=0; iter<fMaxIterations; iter++) {
+    Double_t sumW[3][3]={{0.,0.,0.},{0.,0.,0.},{0.,0.,0.}};
+    Double_t sumWr[3]={0.,0.,0.};
+    for(Int_t i=0; i<nTrks; i++) {
+      if(!PropagateToPoint(trk[i],vtx)) return kFALSE;
+      trk[i].GetXYZ(r[i]);
+      Double_t sy2=trk[i].GetSigmaY2();
+      Double_t syz=trk[i].GetSigmaZY();
+      Double_t sz2=trk[i].GetSigmaZ2();
+      Double_t det=sy2*sz2-syz*syz;
+      if(det<=0.) return kFALSE;
+      Double_t wyy=sz2/det, wyz=-syz/det, wzz=sy2/det;
+      Double_t cs=TMath::Cos(trk[i].GetAlpha());
+      Double_t sn=TMath::Sin(trk[i].GetAlpha());
+      // local y axis is (-sn,cs,0) in the global frame, local z is global z
+      w[i][0][0]=wyy*sn*sn;  w[i][0][1]=-wyy*sn*cs; w[i][0][2]=-wyz*sn;
+      w[i][1][0]=w[i][0][1]; w[i][1][1]=wyy*cs*cs;  w[i][1][2]=wyz*cs;
+      w[i][2][0]=w[i][0][2]; w[i][2][1]=w[i][1][2]; w[i][2][2]=wzz;
+      for(Int_t j=0; j<3; j++) {
+	for(Int_t k=0; k<3; k++) {
+	  sumW[j][k]+=w[i][j][k];
+	  sumWr[j]+=w[i][j][k]*r[i][k];
+	}
+      }
+    }
+    if(!Invert3x3(sumW,cov)) return kFALSE;
+    Double_t shift2=0.;
+    for(Int_t j=0; j<3; j++) {
+      Double_t newpos=cov[j][0]*sumWr[0]+cov[j][1]*sumWr[1]+cov[j][2]*sumWr[2];
+      shift2+=(newpos-vtx[j])*(newpos-vtx[j]);
+      vtx[j]=newpos;
+    }
+    if(shift2<fMinShift*fMinShift) break;
+  }
+
+  // chi2 of the track positions with respect to the fitted vertex
+  Double_t chi2=0.;
+  for(Int_t i=0; i<nTrks; i++) {
+    Double_t res[3]={r[i][0]-vtx[0],r[i][1]-vtx[1],r[i][2]-vtx[2]};
+    for(Int_t j=0; j<3; j++) {
+      for(Int_t k=0; k<3; k++) chi2+=res[j]*w[i][j][k]*res[k];
+    }
+  }
+
+  for(Int_t j=0; j<3; j++) fit.fPos[j]=vtx[j];
+  fit.fCov[0]=cov[0][0];
+  fit.fCov[1]=cov[0][1];
+  fit.fCov[2]=cov[1][1];
+  fit.fCov[3]=cov[0][2];
+  fit.fCov[4]=cov[1][2];
+  fit.fCov[5]=cov[2][2];
+  fit.fChi2=chi2;
+  fit.fNContributors=nTrks;
+
+  return kTRUE;
+}
+//-----------------------------------------------------------------------------
+Bool_t AliHFSecVtxFitter::PropagateToPoint(AliExternalTrackParam &trk,
+					   const Double_t *pos) const
+{
+  /// Propagate the track, in its own reference frame, to the X of pos
+  /// (as AliVertexerTracks does for the finder and the fitter)
+
+  Double_t alpha=trk.GetAlpha();
+  Double_t xl=pos[0]*TMath::Cos(alpha)+pos[1]*TMath::Sin(alpha);
+  return trk.PropagateTo(xl,fBzkG);
+}
+//-----------------------------------------------------------------------------
+Bool_t AliHFSecVtxFitter::Invert3x3(const Double_t m[3][3], Double_t inv[3][3])
+{
+  /// Invert a symmetric 3x3 matrix
+
+  Double_t c00=m[1][1]*m[2][2]-m[1][2]*m[2][1];
+  Double_t c01=m[1][2]*m[2][0]-m[1][0]*m[2][2];
+  Double_t c02=m[1][0]*m[2][1]-m[1][1]*m[2][0];
+  Double_t det=m[0][0]*c00+m[0][1]*c01+m[0][2]*c02;
+  if(TMath::Abs(det)<1.e-30) return kFALSE;
+  Double_t idet=1./det;
+  inv[0][0]=c00*idet;
+  inv[0][1]=(m[0][2]*m[2][1]-m[0][1]*m[2][2])*idet;
+  inv[0][2]=(m[0][1]*m[1][2]-m[0][2]*m[1][1])*idet;
+  inv[1][0]=c01*idet;
+  inv[1][1]=(m[0][0]*m[2][2]-m[0][2]*m[2][0])*idet;
+  inv[1][2]=(m[0][2]*m[1][0]-m[0][0]*m[1][2])*idet;
+  inv[2][0]=c02*idet;
+  inv[2][1]=(m[0][1]*m[2][0]-m[0][0]*m[2][1])*idet;
+  inv[2][2]=(m[0][0]*m[1][1]-m[0][1]*m[1][0])*idet;
+  return kTRUE;
+}
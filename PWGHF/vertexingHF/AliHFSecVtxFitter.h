@@ -0,0 +1,73 @@
+#ifndef ALIHFSECVTXFITTER_H
+#define ALIHFSECVTXFITTER_H
+/* Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+/// \class AliHFSecVtxFitter
+/// \brief Lightweight secondary vertex fitter for 2, 3 and 4 prong candidates
+///
+/// Stack-based replacement for AliVertexerTracks::VertexForSelectedESDTracks
+/// used in the HF vertexing: the tracks are copied on the stack, the vertex
+/// is found with the weighted straight-line minimum distance method and then
+/// fitted with the (y,z) track covariance matrices, as AliVertexerTracks does
+/// without constraint. The dispersion is the one of the finder, as in the
+/// AliESDVertex from AliVertexerTracks. No heap allocation is done,
+/// the result is returned in a plain VertexFit struct and the AliAODVertex
+/// is built by the caller only for accepted candidates.
+//-------------------------------------------------------------------------
+
+#include <TObject.h>
+
+class TObjArray;
+class AliExternalTrackParam;
+
+class AliHFSecVtxFitter : public TObject {
+ public:
+
+  enum { kMaxTracks=4 };
+
+  /// result of the fit, plain data
+  struct VertexFit {
+    Double_t fPos[3];       /// vertex position
+    Double_t fCov[6];       /// covariance matrix (xx,xy,yy,xz,yz,zz)
+    Double_t fChi2;         /// chi2 of the fit
+    Double_t fDispersion;   /// dispersion of the tracks around the vertex from the finder (AliESDVertex::GetDispersion)
+    Int_t    fNContributors;/// number of tracks used
+
+    Double_t GetChi2perNDF() const {
+      Int_t ndf=2*fNContributors-3;
+      return ndf>0 ? fChi2/ndf : -999.;
+    }
+  };
+
+  AliHFSecVtxFitter(Double_t bzkG=0.);
+  virtual ~AliHFSecVtxFitter() {}
+
+  void SetFieldkG(Double_t bzkG) { fBzkG=bzkG; }
+  Double_t GetFieldkG() const { return fBzkG; }
+  void SetStartPoint(const Double_t *pos) { for(Int_t i=0;i<3;i++) fStart[i]=pos[i]; }
+  void SetMaxIterations(Int_t nit) { fMaxIterations=nit; }
+  void SetMinShift(Double_t shift) { fMinShift=shift; }
+
+  Bool_t Fit(const TObjArray *trkArray, VertexFit &fit) const;
+  Bool_t Fit(const AliExternalTrackParam **tracks, Int_t nTrks, VertexFit &fit) const;
+
+ private:
+
+  Bool_t PropagateToPoint(AliExternalTrackParam &trk, const Double_t *pos) const;
+  static Bool_t Invert3x3(const Double_t m[3][3], Double_t inv[3][3]);
+
+  Double_t fBzkG;          /// magnetic field (kG)
+  Double_t fStart[3];      /// starting point for the track propagation
+  Int_t    fMaxIterations; /// max. number of fit iterations
+  Double_t fMinShift;      /// stop iterating when the vertex moves less than this (cm)
+
+  /// \cond CLASSIMP
+  ClassDef(AliHFSecVtxFitter,1); // Lightweight HF secondary vertex fitter
+  /// \endcond
+};
+
+#endif
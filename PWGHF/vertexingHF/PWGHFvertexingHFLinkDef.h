@@ -35,6 +35,7 @@
 #pragma link C++ class AliRDHFCutsXicZerotoXiPifromAODtracks++;
 #pragma link C++ class AliRDHFCutsXictoeleXifromAODtracks+;
 #pragma link C++ class AliAnalysisVertexingHF+;
+#pragma link C++ class AliHFSecVtxFitter+;
 #pragma link C++ class AliAnalysisTaskSEVertexingHF+;
 #pragma link C++ class AliAnalysisTaskMEVertexingHF+;
 #pragma link C++ class AliAnalysisTaskSEB0toDStarPi+;
@@ -30,6 +30,14 @@ ClassImp(AliFMDDensityCalculator)
 //____________________________________________________________________
 const char* AliFMDDensityCalculator::fgkFolderName = "fmdDensityCalculator";
 
+namespace {
+  // Range and granularity of the tables of the weighted energy loss
+  // response (in units of the MIP energy loss)
+  const Double_t kELossTableMax  = 12;
+  const Int_t    kELossTableSize = 1200;
+  const Double_t kELossTableStep = kELossTableMax / kELossTableSize;
+}
+
 //____________________________________________________________________
 AliFMDDensityCalculator::AliFMDDensityCalculator()
   : TNamed(), 
@@ -60,7 +68,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fTabulateELoss(false),
+    fELossTableIndex(),
+    fELossTable()
 {
   // 
   // Constructor 
@@ -98,7 +109,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fTabulateELoss(false),
+    fELossTableIndex(),
+    fELossTable()
 {
   // 
   // Constructor 
@@ -167,7 +181,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fTabulateELoss(o.fTabulateELoss),
+  fELossTableIndex(o.fELossTableIndex),
+  fELossTable(o.fELossTable)
 {
   // 
   // Copy constructor 
@@ -232,6 +249,9 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fTabulateELoss      = o.fTabulateELoss;
+  fELossTableIndex    = o.fELossTableIndex;
+  fELossTable         = o.fELossTable;
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -430,6 +450,10 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
       // etaCache.Reset(AliESDFMD::kInvalidEta);
       // phiCache.Reset(AliESDFMD::kInvalidEta);
 
+      // Cache the acceptance corrections of the strips 
+      Float_t acc[512];
+      for (UShort_t t=0; t<nt; t++) acc[t] = AcceptanceCorrection(r,t);
+
       // --- Loop over sectors and strips ----------------------------
       for (UShort_t s=0; s<ns; s++) { 
 	for (UShort_t t=0; t<nt; t++) {
@@ -485,7 +509,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 
 	  // --- Apply phi corner correction to eloss ----------------
 	  if (fUsePhiAcceptance == kPhiCorrectELoss) 
-	    mult *= AcceptanceCorrection(r,t);
+	    mult *= acc[t];
 
 	  // --- Get the low multiplicity cut ------------------------
 	  Double_t cut  = 1024;
@@ -507,7 +531,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  // Temporary stuff - remove Correction call 
 	  Double_t c = 1;
 	  if (fUsePhiAcceptance == kPhiCorrectNch) 
-	    c = AcceptanceCorrection(r,t);
+	    c = acc[t];
 	  // Double_t c = Correction(d,r,t,eta,lowFlux);
 	  ADD_TIMER(timer,corrTime);
 	  fCorrections->Fill(c);
@@ -740,6 +764,11 @@ AliFMDDensityCalculator::CacheMaxWeights(const TAxis& axis)
   fFMD2oMax.Set(nEta);
   fFMD3iMax.Set(nEta);
   fFMD3oMax.Set(nEta);
+
+  // Tables of the weighted response are made on first use 
+  fELossTableIndex.Set(5*(nEta+1));
+  fELossTableIndex.Reset(-2);
+  fELossTable.Set(0);
   
   fMaxWeights->SetBins(nEta, eta.GetXmin(), eta.GetXmax(), 5, .5, 5.5);
   fMaxWeights->GetYaxis()->SetBinLabel(1, "FMD1i");
@@ -864,21 +893,42 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   if (lowFlux) return 1;
   
   AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
-  AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
-  if (!fit) { 
-    AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
-		    d, r, eta, fMinQuality));
-    return 0;
+  const Double_t* table = 0;
+  if (fTabulateELoss && mult >= 0 && mult < kELossTableMax) 
+    table = GetELossTable(d, r, fcm.GetELossFit()->FindEtaBin(eta));
+
+  Double_t ret = 0;
+  if (table) { 
+    // Cubic (Catmull-Rom) interpolation in the table, linear at the ends
+    Double_t u = mult / kELossTableStep;
+    Int_t    i = Int_t(u);
+    Double_t f = u - i;
+    if (i < 1 || i+2 > kELossTableSize) 
+      ret = (1 - f) * table[i] + f * table[i+1];
+    else {
+      const Double_t* p = table + i - 1;
+      ret = p[1] + 0.5 * f * (p[2] - p[0] + 
+			      f * (2*p[0] - 5*p[1] + 4*p[2] - p[3] + 
+				   f * (3*(p[1] - p[2]) + p[3] - p[0])));
+    }
   }
+  else {
+    AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
+    if (!fit) { 
+      AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
+		      d, r, eta, fMinQuality));
+      return 0;
+    }
   
-  Int_t    m   = GetMaxWeight(d,r,eta); // fit->FindMaxWeight();
-  if (m < 1) { 
-    AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
-    return 0;
-  }
+    Int_t    m   = GetMaxWeight(d,r,eta); // fit->FindMaxWeight();
+    if (m < 1) { 
+      AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
+      return 0;
+    }
   
-  UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
-  Double_t ret = fit->EvaluateWeighted(mult, n);
+    UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
+    ret          = fit->EvaluateWeighted(mult, n);
+  }
   
   if (fDebug > 10) {
     AliInfo(Form("FMD%d%c, eta=%7.4f, %8.5f -> %8.5f", d, r, eta, mult, ret));
@@ -890,6 +940,56 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   return ret;
 }
 
+//_____________________________________________________________________
+const Double_t*
+AliFMDDensityCalculator::GetELossTable(UShort_t d, Char_t r, Int_t iEta) const
+{
+  // 
+  // Get the tabulated weighted energy loss response for FMD<i>dr</i> 
+  // in eta bin iEta, and make it on the first call 
+  // 
+  // Parameters:
+  //    d     Detector
+  //    r     Ring
+  //    iEta  Eta bin (1 based)
+  // 
+  // Return:
+  //    Table of the response, or null if there is no good fit 
+  //
+  Int_t nEta = fELossTableIndex.GetSize() / 5;
+  if (iEta <= 0 || iEta >= nEta) return 0;
+
+  Int_t ring = 0;
+  switch (d) { 
+  case 1: ring = 0; break;
+  case 2: ring = 1 + (r == 'I' || r == 'i' ? 0 : 1); break;
+  case 3: ring = 3 + (r == 'I' || r == 'i' ? 0 : 1); break;
+  default: return 0;
+  }
+  Int_t& offset = fELossTableIndex[ring*nEta+iEta];
+  if (offset >= 0)  return fELossTable.GetArray() + offset;
+  if (offset == -1) return 0;
+
+  // First use - if there is no good fit, the response is evaluated
+  // (and the problem reported) by NParticles 
+  offset = -1;
+  AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
+  AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,iEta,-1);
+  if (!fit) return 0;
+  Int_t    m   = GetMaxWeight(d,r,iEta-1);
+  if (m < 1) return 0;
+
+  UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
+  Int_t    off = fELossTable.GetSize();
+  fELossTable.Set(off + kELossTableSize + 1);
+  for (Int_t i = 0; i <= kELossTableSize; i++) 
+    fELossTable[off+i] = fit->EvaluateWeighted(i * kELossTableStep, n);
+  DMSG(fDebug, 2, "Tabulated response for FMD%d%c eta bin %d (n=%d)",
+       d, r, iEta, n);
+  offset = off;
+  return fELossTable.GetArray() + offset;
+}
+
 //_____________________________________________________________________
 Float_t 
 AliFMDDensityCalculator::Correction(UShort_t d, 
@@ -1201,6 +1301,7 @@ AliFMDDensityCalculator::Print(Option_t* option) const
   PFV("Threshold(hit)",         fHitThreshold);
   PFV("Max(outliers)",          fMaxOutliers);
   PFV("Cut(outlier)",           fOutlierCut);
+  PFB("Tabulate ELoss",         fTabulateELoss);
   PFV("Lower cut", "");
   fCuts.Print();
 
@@ -16,6 +16,7 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayD.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
@@ -211,6 +212,22 @@ public:
    * @param cut Cut value 
    */
   void SetHitThreshold(Double_t cut=0.9) { fHitThreshold = cut; }
+  /** 
+   * Set whether to evaluate the weighted energy loss response
+   * @f$ f_W(\Delta)@f$ (see AliFMDCorrELossFit::ELossFit::EvaluateWeighted)
+   * from tables rather than from the fits for each strip.  The tables
+   * are made on first use for each ring and @f$\eta@f$ bin, and
+   * remade when the energy loss fits are (re)cached.  The tables
+   * have a step of 0.01 (in units of the MIP energy loss) up to 12,
+   * and cubic interpolation in them reproduces @f$ f_W@f$ to better
+   * than @f$ 5\cdot10^{-4}@f$ (absolute, for fits with
+   * @f$\xi,\sigma\gtrsim 0.015@f$).  Signals above the table range
+   * are evaluated from the fits.  Off by default, i.e. @f$ f_W@f$
+   * is evaluated exactly.
+   * 
+   * @param use Whether to use tables 
+   */
+  void SetTabulateELoss(Bool_t use=true) { fTabulateELoss = use; }
   /** 
    * Get the multiplicity cut.  If the user has set fMultCut (via
    * SetMultCut) then that value is used.  If not, then the lower
@@ -336,6 +353,18 @@ protected:
 			     Char_t   r, 
 			     Float_t  eta, 
 			     Bool_t   lowFlux) const;
+  /** 
+   * Get the tabulated weighted energy loss response for FMD<i>dr</i>
+   * in @f$\eta@f$ bin @a iEta.  The table is made on the first call.
+   * 
+   * @param d     Detector
+   * @param r     Ring
+   * @param iEta  Eta bin (1 based) of the energy loss fits
+   * 
+   * @return Table of @f$ f_W@f$ at equidistant signals from 0, or
+   * null if there is no good fit in the bin
+   */
+  const Double_t* GetELossTable(UShort_t d, Char_t r, Int_t iEta) const;
   /** 
    * Get the inverse correction factor.  This consist of
    * 
@@ -504,8 +533,11 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  Bool_t                 fTabulateELoss; // Whether to tabulate f_W
+  mutable TArrayI        fELossTableIndex; //! Offsets of the f_W tables
+  mutable TArrayD        fELossTable;      //! Tabulated f_W
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
@@ -19,6 +19,8 @@
 #include <TTree.h>
 #include <TStopwatch.h>
 #include "TRandom.h"
+#include <algorithm>
+#include <map>
 
 #include "AliLog.h"
 #include "AliEventplane.h"
@@ -92,6 +94,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fMiniEvent(0x0),
    fBigOutput(kFALSE),
    fMixPrintRefresh(-1),
+   fMixBufferSizeLimit(0),
    fCheckDecay(kTRUE),
    fMaxNDaughters(-1),
    fCheckP(kFALSE),
@@ -160,6 +163,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fMiniEvent(0x0),
    fBigOutput(kFALSE),
    fMixPrintRefresh(-1),
+   fMixBufferSizeLimit(0),
    fCheckDecay(kTRUE),
    fMaxNDaughters(-1),
    fCheckP(kFALSE),
@@ -229,6 +233,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fMiniEvent(0x0),
    fBigOutput(copy.fBigOutput),
    fMixPrintRefresh(copy.fMixPrintRefresh),
+   fMixBufferSizeLimit(copy.fMixBufferSizeLimit),
    fCheckDecay(copy.fCheckDecay),
    fMaxNDaughters(copy.fMaxNDaughters),
    fCheckP(copy.fCheckP),
@@ -299,6 +304,7 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fESDtrackCuts = copy.fESDtrackCuts;
    fBigOutput = copy.fBigOutput;
    fMixPrintRefresh = copy.fMixPrintRefresh;
+   fMixBufferSizeLimit = copy.fMixBufferSizeLimit;
    fCheckDecay = copy.fCheckDecay;
    fMaxNDaughters = copy.fMaxNDaughters;
    fCheckP = copy.fCheckP;
@@ -567,7 +573,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // prepare variables
    Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
    Int_t idef, nDefs   = fHistograms.GetEntries();
-   Int_t imix, iloop, ifill;
+   Int_t imix, ifill;
    AliRsnMiniOutput *def = 0x0;
    AliRsnMiniOutput::EComputation compType;
 
@@ -578,6 +584,9 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       else printNum = 0;
    }
 
+   // mixing keys of each event, filled in the loop below
+   std::vector<Float_t> vz(nEvents), mult(nEvents), angle(nEvents);
+
    // loop on events, and for each one fill all outputs
    // using the appropriate procedure depending on its type
    // only mother-related histograms are filled in UserExec,
@@ -586,6 +595,9 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    for (ievt = 0; ievt < nEvents; ievt++) {
       // get next entry
       fEvBuffer->GetEntry(ievt);
+      vz[ievt]    = fMiniEvent->Vz();
+      mult[ievt]  = fMiniEvent->Mult();
+      angle[ievt] = fMiniEvent->Angle();
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] Std.Event %d/%d",GetName(), ievt,nEvents));
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
@@ -635,83 +647,75 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       return;
    }
 
-   // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
-   }
-
-
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
    // search for good matchings
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      if (printNum&&(ievt%printNum==0)) {
-         AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
-         timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
-      }
-      if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
-         if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
-         // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
-         // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
-         // check that the found good events has not enough matches already
-         if (nmatched[imix] >= fNMix) continue;
-         // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
-         nmatched[ievt]++;
-         nmatched[imix]++;
-         if (nmatched[ievt] >= fNMix) break;
-      }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
-   }
+   std::vector< std::vector<Int_t> > matched(nEvents);
+   FindMixMatches(vz, mult, angle, matched);
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
+   // the events used in the mixing are copied in memory, reading the buffer once in order,
+   // if the serialized size of the buffer is below fMixBufferSizeLimit (off by default, 0);
+   // otherwise they are read back for each pair. The copies take more memory than their
+   // serialized size (object headers and TClonesArray slots), the limit should leave room for that
+   TObjArray store(nEvents);
+   store.SetOwner();
+   Bool_t inMemory = (fMixBufferSizeLimit > 0 && fEvBuffer->GetTotBytes() <= fMixBufferSizeLimit);
+   if (inMemory) {
+      std::vector<Bool_t> used(nEvents, kFALSE);
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         if (!matched[ievt].empty()) used[ievt] = kTRUE;
+         for (UInt_t i = 0; i < matched[ievt].size(); i++) used[matched[ievt][i]] = kTRUE;
+      }
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         if (!used[ievt]) continue;
+         fEvBuffer->GetEntry(ievt);
+         store.AddAt(new AliRsnMiniEvent(*fMiniEvent), ievt);
+      }
+   } else if (fMixBufferSizeLimit > 0) {
+      AliInfo(Form("[%s] Serialized mini-event buffer of %lld bytes above the limit of %lld, mixed events are read from the buffer", GetName(), fEvBuffer->GetTotBytes(), fMixBufferSizeLimit));
+   }
+
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
+   AliRsnMiniEvent *evMain = 0x0, *evMix = 0x0, evMainCopy;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
+      if (matched[ievt].empty()) continue;
       ifill = 0;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
-         fEvBuffer->GetEntry(imix);
+      if (inMemory) {
+         evMain = (AliRsnMiniEvent *)store.UncheckedAt(ievt);
+      } else {
+         fEvBuffer->GetEntry(ievt);
+         evMainCopy = *fMiniEvent;
+         evMain = &evMainCopy;
+      }
+      for (UInt_t i = 0; i < matched[ievt].size(); i++) {
+         imix = matched[ievt][i];
+         if (inMemory) {
+            evMix = (AliRsnMiniEvent *)store.UncheckedAt(imix);
+         } else {
+            fEvBuffer->GetEntry(imix);
+            evMix = fMiniEvent;
+         }
          for (idef = 0; idef < nDefs; idef++) {
             def = (AliRsnMiniOutput *)fHistograms[idef];
             if (!def) continue;
             if (!def->IsTrackPairMix()) continue;
-            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
+            ifill += def->FillPair(evMain, evMix, &fValues, kTRUE);
             if (!def->IsSymmetric()) {
                AliDebugClass(2, "Reflecting non symmetric pair");
-               ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE);
+               ifill += def->FillPair(evMix, evMain, &fValues, kFALSE);
             }
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
-
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
 
@@ -1609,13 +1613,21 @@ void AliRsnMiniAnalysisTask::SetDselection(UShort_t originDselection)
 Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2)
 {
    if (!event1 || !event2) return kFALSE;
+   return EventsMatch(event1->Vz(), event1->Mult(), event1->Angle(), event2->Vz(), event2->Mult(), event2->Angle());
+}
+
+//__________________________________________________________________________________________________
+/// Check if two events, given by their vz, mult and angle, are compatible (see above).
+///
+Bool_t AliRsnMiniAnalysisTask::EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const
+{
    Int_t ivz1, ivz2, imult1, imult2, iangle1, iangle2;
    Double_t dv, dm, da;
 
    if (fContinuousMix) {
-      dv = TMath::Abs(event1->Vz()    - event2->Vz()   );
-      dm = TMath::Abs(event1->Mult()  - event2->Mult() );
-      da = TMath::Abs(event1->Angle() - event2->Angle());
+      dv = TMath::Abs(vz1    - vz2   );
+      dm = TMath::Abs(mult1  - mult2 );
+      da = TMath::Abs(angle1 - angle2);
       if (dv > fMaxDiffVz) {
          //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Vz = %f", event1->ID(), event2->ID(), dv));
          return kFALSE;
@@ -1630,12 +1642,12 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
       }
       return kTRUE;
    } else {
-      ivz1 = (Int_t)(event1->Vz() / fMaxDiffVz);
-      ivz2 = (Int_t)(event2->Vz() / fMaxDiffVz);
-      imult1 = (Int_t)(event1->Mult() / fMaxDiffMult);
-      imult2 = (Int_t)(event2->Mult() / fMaxDiffMult);
-      iangle1 = (Int_t)(event1->Angle() / fMaxDiffAngle);
-      iangle2 = (Int_t)(event2->Angle() / fMaxDiffAngle);
+      ivz1 = (Int_t)(vz1 / fMaxDiffVz);
+      ivz2 = (Int_t)(vz2 / fMaxDiffVz);
+      imult1 = (Int_t)(mult1 / fMaxDiffMult);
+      imult2 = (Int_t)(mult2 / fMaxDiffMult);
+      iangle1 = (Int_t)(angle1 / fMaxDiffAngle);
+      iangle2 = (Int_t)(angle2 / fMaxDiffAngle);
       if (ivz1 != ivz2) return kFALSE;
       if (imult1 != imult2) return kFALSE;
       if (iangle1 != iangle2) return kFALSE;
@@ -1643,6 +1655,119 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+/// Find the mixing partners of each event, given the vz, mult and angle of all events.
+///
+/// The result is the same as scanning, for each event, all the others in the order
+/// ievt+1, ..., nEvents-1, 0, ..., ievt-1 with EventsMatch, until fNMix partners are found
+/// (an event is used at most fNMix times, and a pair only once).
+/// The events are grouped in cells of the (vz, mult, angle) space: the mixing bins for the
+/// binned mixing, cells of size fMaxDiff* for the continuous mixing, where the partners are
+/// then in the neighbouring cells. Only the events of these cells are scanned, in the same
+/// order as above. If some value can not be put in a cell (e.g. not finite), all the events
+/// are scanned.
+///
+/// \param matched Filled with the list of partners of each event
+///
+void AliRsnMiniAnalysisTask::FindMixMatches(const std::vector<Float_t> &vz, const std::vector<Float_t> &mult, const std::vector<Float_t> &angle,
+                                            std::vector< std::vector<Int_t> > &matched) const
+{
+   typedef std::pair<Int_t, std::pair<Int_t, Int_t> > CellKey;
+   const Int_t nEvents = vz.size();
+   std::vector<Int_t> nmatched(nEvents, 0);
+
+   // cell of each event; for the continuous mixing the cells are slightly larger than the
+   // max differences, so that rounding can not put two matching events two cells apart
+   const Double_t widthScale = fContinuousMix ? 1.000001 : 1.0;
+   const Double_t width[3] = {fMaxDiffVz * widthScale, fMaxDiffMult * widthScale, fMaxDiffAngle * widthScale};
+   Bool_t useCells = kTRUE;
+   std::vector<CellKey> cellOf(nEvents);
+   for (Int_t ievt = 0; ievt < nEvents && useCells; ievt++) {
+      const Float_t value[3] = {vz[ievt], mult[ievt], angle[ievt]};
+      Int_t index[3];
+      for (Int_t k = 0; k < 3; k++) {
+         Double_t q = value[k] / width[k];
+         if (!(width[k] > 0.0) || !(TMath::Abs(q) < 1E9)) {
+            useCells = kFALSE;
+            break;
+         }
+         index[k] = fContinuousMix ? (Int_t)TMath::Floor(q) : (Int_t)q;
+      }
+      if (useCells) cellOf[ievt] = CellKey(index[0], std::make_pair(index[1], index[2]));
+   }
+   const Int_t nNeighbours = fContinuousMix ? 1 : 0;
+   std::map<CellKey, std::vector<Int_t> > cells;
+   std::vector<Int_t> all;
+   if (useCells) {
+      for (Int_t ievt = 0; ievt < nEvents; ievt++) cells[cellOf[ievt]].push_back(ievt);
+   } else {
+      AliInfo(Form("[%s] Mixing values out of range, scanning all events for the matches", GetName()));
+      for (Int_t ievt = 0; ievt < nEvents; ievt++) all.push_back(ievt);
+   }
+
+   Int_t printNum = fMixPrintRefresh;
+   if (printNum < 0) printNum = (nEvents > 1e5) ? nEvents/100 : ((nEvents > 1e4) ? nEvents/10 : 0);
+
+   std::vector<const std::vector<Int_t>*> lists;
+   std::vector<UInt_t> pos, end;
+   for (Int_t ievt = 0; ievt < nEvents; ievt++) {
+      if (printNum && (ievt%printNum == 0)) AliInfo(Form("[%s] EventMixing searching %d/%d", GetName(), ievt, nEvents));
+      if (nmatched[ievt] >= fNMix) continue;
+      // sorted lists of candidates
+      lists.clear();
+      if (useCells) {
+         for (Int_t dv = -nNeighbours; dv <= nNeighbours; dv++)
+            for (Int_t dm = -nNeighbours; dm <= nNeighbours; dm++)
+               for (Int_t da = -nNeighbours; da <= nNeighbours; da++) {
+                  CellKey key(cellOf[ievt].first + dv, std::make_pair(cellOf[ievt].second.first + dm, cellOf[ievt].second.second + da));
+                  std::map<CellKey, std::vector<Int_t> >::const_iterator it = cells.find(key);
+                  if (it != cells.end()) lists.push_back(&(it->second));
+               }
+      } else {
+         lists.push_back(&all);
+      }
+      const UInt_t nLists = lists.size();
+      pos.resize(nLists);
+      end.resize(nLists);
+      // first the candidates after ievt, then the ones before, merging the lists in increasing order
+      for (Int_t pass = 0; pass < 2 && nmatched[ievt] < fNMix; pass++) {
+         for (UInt_t l = 0; l < nLists; l++) {
+            const std::vector<Int_t> &list = *lists[l];
+            if (pass == 0) {
+               pos[l] = std::upper_bound(list.begin(), list.end(), ievt) - list.begin();
+               end[l] = list.size();
+            } else {
+               pos[l] = 0;
+               end[l] = std::lower_bound(list.begin(), list.end(), ievt) - list.begin();
+            }
+         }
+         while (kTRUE) {
+            Int_t imix = nEvents, next = -1;
+            for (UInt_t l = 0; l < nLists; l++) {
+               if (pos[l] < end[l] && (*lists[l])[pos[l]] < imix) {
+                  imix = (*lists[l])[pos[l]];
+                  next = l;
+               }
+            }
+            if (next < 0) break;
+            pos[next]++;
+            // skip if events are not matched
+            if (!EventsMatch(vz[ievt], mult[ievt], angle[ievt], vz[imix], mult[imix], angle[imix])) continue;
+            // check that the list of good matches for mixed does not already contain main event
+            if (std::find(matched[imix].begin(), matched[imix].end(), ievt) != matched[imix].end()) continue;
+            // check that the found good events has not enough matches already
+            if (nmatched[imix] >= fNMix) continue;
+            // add new mixing candidate
+            matched[ievt].push_back(imix);
+            nmatched[ievt]++;
+            nmatched[imix]++;
+            if (nmatched[ievt] >= fNMix) break;
+         }
+      }
+      AliDebugClass(1, Form("Matches for event %5d = %d", ievt, nmatched[ievt]));
+   }
+}
+
 //---------------------------------------------------------------------
 /// Patch to be used with 2011 Pb-Pb data for flat centrality distribution
 ///
@@ -17,6 +17,7 @@
 
 #include <TString.h>
 #include <TClonesArray.h>
+#include <vector>
 
 #include "AliAnalysisTaskSE.h"
 
@@ -66,6 +67,7 @@ public:
    void                SetMaxDiffAngle(Double_t val)      {fMaxDiffAngle = val;}
    void                SetEventCuts(AliRsnCutSet *cuts)   {fEventCuts    = cuts;}
    void                SetMixPrintRefresh(Int_t n)        {fMixPrintRefresh = n;}
+   void                SetMixBufferSizeLimit(Long64_t bytes)  {fMixBufferSizeLimit = bytes;}
    void                SetCheckDecay(Bool_t checkDecay = kTRUE) {fCheckDecay = checkDecay;}
    void                SetMaxNDaughters(Short_t n)        {fMaxNDaughters = n;}
    void                SetCheckMomentumConservation(Bool_t checkP) {fCheckP = checkP;}
@@ -115,6 +117,8 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   Bool_t   EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const;
+   void     FindMixMatches(const std::vector<Float_t> &vz, const std::vector<Float_t> &mult, const std::vector<Float_t> &angle, std::vector< std::vector<Int_t> > &matched) const;
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list, const char *subdetector, const char *expectedstep) const;
 
    Bool_t               fUseMC;           ///<  use or not MC info
@@ -156,6 +160,7 @@ private:
    AliRsnMiniEvent     *fMiniEvent;       ///< mini-event cursor
    Bool_t               fBigOutput;       ///< flag if open file for output list
    Int_t                fMixPrintRefresh; ///< how often info in mixing part is printed
+   Long64_t             fMixBufferSizeLimit;  ///< max serialized size (TTree::GetTotBytes, uncompressed bytes) of the mini-event buffer copied in memory for the mixing (0 = never copied, default)
    Bool_t               fCheckDecay;      ///< check if the mother decayed via the requested channel
    Short_t              fMaxNDaughters;   ///< maximum number of allowed mother's daughter
    Bool_t               fCheckP;          ///< flag to set in order to check the momentum conservation for mothers
@@ -175,7 +180,7 @@ private:
    TObjArray            fResonanceFinders;  ///< list of AliRsnMiniResonanceFinder objects
 
 /// \cond CLASSIMP
-   ClassDef(AliRsnMiniAnalysisTask, 20);     
+   ClassDef(AliRsnMiniAnalysisTask, 22);     
 /// \endcond
 };
 
@@ -125,7 +125,7 @@ ClassImp(AliAnalysisTaskStrangenessVsMultiplicityRun2)
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2()
 : AliAnalysisTaskSE(), fListHist(0), fListK0Short(0), fListLambda(0), fListAntiLambda(0),
 fListXiMinus(0), fListXiPlus(0), fListOmegaMinus(0), fListOmegaPlus(0),
-fTreeEvent(0), fTreeV0(0), fTreeCascade(0),
+fTreeEvent(0), fTreeV0(0), fTreeCascade(0), fV0CutTable(), fCascadeCutTable(),
 fPIDResponse(0), fESDtrackCuts(0),
 fESDtrackCutsITSsa2010(0), fESDtrackCutsGlobal2015(0),
 fUtils(0), fRand(0),
@@ -481,7 +481,7 @@ fHistCentrality(0)
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2(Bool_t lSaveEventTree, Bool_t lSaveV0Tree, Bool_t lSaveCascadeTree, const char *name, TString lExtraOptions)
 : AliAnalysisTaskSE(name), fListHist(0), fListK0Short(0), fListLambda(0), fListAntiLambda(0),
 fListXiMinus(0), fListXiPlus(0), fListOmegaMinus(0), fListOmegaPlus(0),
-fTreeEvent(0), fTreeV0(0), fTreeCascade(0),
+fTreeEvent(0), fTreeV0(0), fTreeCascade(0), fV0CutTable(), fCascadeCutTable(),
 fPIDResponse(0), fESDtrackCuts(0),
 fESDtrackCutsITSsa2010(0), fESDtrackCutsGlobal2015(0),
 fUtils(0), fRand(0),
@@ -1803,6 +1803,10 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     Int_t nv0s = 0;
     nv0s = lESDevent->GetNumberOfV0s();
     
+    //Columnar copy of the V0 configurations, made once
+    if( fV0CutTable.GetN() != fListK0Short->GetEntries()+fListLambda->GetEntries()+fListAntiLambda->GetEntries() )
+        fV0CutTable.Compile(fListK0Short, fListLambda, fListAntiLambda);
+    
     for (Int_t iV0 = 0; iV0 < nv0s; iV0++) //extra-crazy test
     {   // This is the begining of the V0 loop
         AliESDv0 *v0 = ((AliESDEvent*)lESDevent)->GetV0(iV0);
@@ -2147,178 +2151,140 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         
         //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
-        TH3F *histoout         = 0x0;
-        AliV0Result *lV0Result = 0x0;
-        
-        //pointers to valid results
-        AliV0Result *lPointers[50000];
-        Long_t lValidConfigurations=0;
-        
-        for( Int_t icfg=0; icfg<fListK0Short->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListK0Short->At(icfg);
-            lValidConfigurations++;
-        }
-        for( Int_t icfg=0; icfg<fListLambda->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListLambda->At(icfg);
-            lValidConfigurations++;
-        }
-        for( Int_t icfg=0; icfg<fListAntiLambda->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListAntiLambda->At(icfg);
-            lValidConfigurations++;
+        //The configurations are read from their columnar copy (fV0CutTable): the candidate
+        //properties under each mass hypothesis are computed once, then each cut is a plain
+        //comparison over the arrays, giving one pass flag per configuration
+        const Int_t lNConfigurations = fV0CutTable.GetN();
+        
+        //Candidate under each mass hypothesis (index: AliV0Result::EMassHypo)
+        const Float_t lMassHypo[3]  = {fTreeVariableInvMassK0s, fTreeVariableInvMassLambda, fTreeVariableInvMassAntiLambda};
+        const Float_t lRapHypo[3]   = {fTreeVariableRapK0Short, fTreeVariableRapLambda, fTreeVariableRapLambda};
+        const Float_t lPDGMassHypo[3] = {0.497, 1.115683, 1.115683};
+        Float_t lLifetimeHypo[3];
+        for(Int_t ihypo=0; ihypo<3; ihypo++) lLifetimeHypo[ihypo] = fTreeVariableDistOverTotMom*lPDGMassHypo[ihypo];
+        const Float_t lNegdEdxHypo[3] = {TMath::Abs(fTreeVariableNSigmasNegPion), TMath::Abs(fTreeVariableNSigmasNegPion), TMath::Abs(fTreeVariableNSigmasNegProton)};
+        const Float_t lPosdEdxHypo[3] = {TMath::Abs(fTreeVariableNSigmasPosPion), TMath::Abs(fTreeVariableNSigmasPosProton), TMath::Abs(fTreeVariableNSigmasPosPion)};
+        //Baryon momentum: K0Short always passes (Check 4)
+        const Float_t lBaryonMomentumHypo[3] = {-0.5, fTreeVariablePosInnerP, fTreeVariableNegInnerP};
+        //Special 2.76TeV-like dedx: either K0Short, or high-pT baryon daughter, or passes cut (Check 10)
+        const Bool_t l276TeVdEdxHypo[3] = {kTRUE,
+            lThisPosInnerPt > 1.0 || TMath::Abs(fTreeVariableNSigmasPosProton)<3.0,
+            lThisNegInnerPt > 1.0 || TMath::Abs(fTreeVariableNSigmasNegProton)<3.0};
+        
+        //Candidate-only quantities
+        const Float_t lAbsAlpha = TMath::Abs(fTreeVariableAlphaV0);
+        const Bool_t lITSRefitBoth = (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) && (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit);
+        const Double_t lLengthPtTerm     = TMath::Power(1/(fTreeVariablePt+1e-6),1.5); //rough parametrization, tune me!
+        const Double_t lLengthRadiusTerm = TMath::Max(fTreeVariableV0Radius-85., 0.); //rough parametrization, tune me!
+        const Bool_t lHasTOF = TMath::Abs(fTreeVariableNegTOFSignal) < 100 || TMath::Abs(fTreeVariablePosTOFSignal) < 100;
+        
+        //Setting up: Variable V0 CosPA (only use if tighter than the non-variable cut)
+        Float_t *lV0CosPACut = fV0CutTable.fV0CosPACut.data();
+        for(Int_t lcfg=0; lcfg<lNConfigurations; lcfg++){
+            lV0CosPACut[lcfg] = fV0CutTable.fV0CosPA[lcfg];
+            if( !fV0CutTable.fUseVarV0CosPA[lcfg] ) continue;
+            Float_t lVarV0CosPA = TMath::Cos(
+                                             fV0CutTable.fVarV0CosPAExp0Const[lcfg]*TMath::Exp(fV0CutTable.fVarV0CosPAExp0Slope[lcfg]*fTreeVariablePt) +
+                                             fV0CutTable.fVarV0CosPAExp1Const[lcfg]*TMath::Exp(fV0CutTable.fVarV0CosPAExp1Slope[lcfg]*fTreeVariablePt) +
+                                             fV0CutTable.fVarV0CosPAConst[lcfg]);
+            if( lVarV0CosPA > lV0CosPACut[lcfg] ) lV0CosPACut[lcfg] = lVarV0CosPA;
         }
         
-        for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lV0Result = lPointers[lcfg];
-            histoout  = lV0Result->GetHistogram();
+        const Int_t    *lHypo         = fV0CutTable.fMassHypo.data();
+        const Int_t    *lCutOnTheFly  = fV0CutTable.fUseOnTheFly.data();
+        const Double_t *lCutMinEta    = fV0CutTable.fMinEtaTracks.data();
+        const Double_t *lCutMaxEta    = fV0CutTable.fMaxEtaTracks.data();
+        const Double_t *lCutMinRap    = fV0CutTable.fMinRapidity.data();
+        const Double_t *lCutMaxRap    = fV0CutTable.fMaxRapidity.data();
+        const Double_t *lCutRadius    = fV0CutTable.fV0Radius.data();
+        const Double_t *lCutMaxRadius = fV0CutTable.fMaxV0Radius.data();
+        const Double_t *lCutDCANeg    = fV0CutTable.fDCANegToPV.data();
+        const Double_t *lCutDCAPos    = fV0CutTable.fDCAPosToPV.data();
+        const Double_t *lCutDCADau    = fV0CutTable.fDCAV0Daughters.data();
+        const Double_t *lCutLifetime  = fV0CutTable.fProperLifetime.data();
+        const Double_t *lCutNCR       = fV0CutTable.fLeastNumberOfCrossedRows.data();
+        const Double_t *lCutNCRFind   = fV0CutTable.fLeastNumberOfCrossedRowsOverFindable.data();
+        const Double_t *lCutBaryonMom = fV0CutTable.fMinBaryonMomentum.data();
+        const Double_t *lCutdEdx      = fV0CutTable.fTPCdEdx.data();
+        const UChar_t  *lCutArm       = fV0CutTable.fArmenteros.data();
+        const Double_t *lCutArmPar    = fV0CutTable.fArmenterosParameter.data();
+        const UChar_t  *lCutITSRefit  = fV0CutTable.fUseITSRefitTracks.data();
+        const Double_t *lCutChi2      = fV0CutTable.fMaxChi2PerCluster.data();
+        const Double_t *lCutLength    = fV0CutTable.fMinTrackLength.data();
+        const UChar_t  *lCutParLength = fV0CutTable.fUseParametricLength.data();
+        const UChar_t  *lCut276dEdx   = fV0CutTable.f276TeVLikedEdx.data();
+        const UChar_t  *lCutTOF       = fV0CutTable.fAtLeastOneTOF.data();
+        const Int_t    *lCutCowboy    = fV0CutTable.fIsCowboy.data();
+        const Double_t *lCutNcrLength = fV0CutTable.fMinCrossedRowsOverLength.data();
+        const UChar_t  *lCutITSorTOF  = fV0CutTable.fITSorTOF.data();
+        UChar_t        *lPass         = fV0CutTable.fPass.data();
+        
+        for(Int_t lcfg=0; lcfg<lNConfigurations; lcfg++){
+            const Int_t lh = lHypo[lcfg];
+            lPass[lcfg] =
+            //Check 1: Offline Vertexer
+            ( lOnFlyStatus == lCutOnTheFly[lcfg] ) &
             
-            Float_t lMass = 0;
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBaryonMomentum = -0.5;
-            Float_t lBaryonPt = -0.5;
-            Float_t lBaryondEdxFromProton = 0;
+            //Check 2: Basic Acceptance cuts
+            ( lCutMinEta[lcfg] < fTreeVariableNegEta ) & ( fTreeVariableNegEta < lCutMaxEta[lcfg] ) &
+            ( lCutMinEta[lcfg] < fTreeVariablePosEta ) & ( fTreeVariablePosEta < lCutMaxEta[lcfg] ) &
+            ( lRapHypo[lh] > lCutMinRap[lcfg] ) &
+            ( lRapHypo[lh] < lCutMaxRap[lcfg] ) &
             
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
-                                             lVarV0CosPApar[4]);
-            if( lV0Result->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
+            //Check 3: Topological Variables
+            ( fTreeVariableV0Radius > lCutRadius[lcfg] ) &
+            ( fTreeVariableV0Radius < lCutMaxRadius[lcfg] ) &
+            ( fTreeVariableDcaNegToPrimVertex > lCutDCANeg[lcfg] ) &
+            ( fTreeVariableDcaPosToPrimVertex > lCutDCAPos[lcfg] ) &
+            ( fTreeVariableDcaV0Daughters < lCutDCADau[lcfg] ) &
+            ( fTreeVariableV0CosineOfPointingAngle > lV0CosPACut[lcfg] ) &
+            ( lLifetimeHypo[lh] < lCutLifetime[lcfg] ) &
+            ( fTreeVariableLeastNbrCrossedRows > lCutNCR[lcfg] ) &
+            ( fTreeVariableLeastRatioCrossedRowsOverFindable > lCutNCRFind[lcfg] ) &
             
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ){
-                lMass    = fTreeVariableInvMassK0s;
-                lRap     = fTreeVariableRapK0Short;
-                lPDGMass = 0.497;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ){
-                lMass = fTreeVariableInvMassLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosProton;
-                lBaryonMomentum = fTreeVariablePosInnerP;
-                lBaryonPt = lThisPosInnerPt;
-                lBaryondEdxFromProton = fTreeVariableNSigmasPosProton;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ){
-                lMass = fTreeVariableInvMassAntiLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegProton;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-                lBaryonMomentum = fTreeVariableNegInnerP;
-                lBaryonPt = lThisNegInnerPt;
-                lBaryondEdxFromProton = fTreeVariableNSigmasNegProton;
-            }
+            //Check 4: Minimum momentum of baryon daughter
+            ( lh == AliV0Result::kK0Short || lBaryonMomentumHypo[lh] > lCutBaryonMom[lcfg] ) &
             
-            if (
-                //Check 1: Offline Vertexer
-                lOnFlyStatus == lV0Result->GetUseOnTheFly() &&
-                
-                //Check 2: Basic Acceptance cuts
-                lV0Result->GetCutMinEtaTracks() < fTreeVariableNegEta && fTreeVariableNegEta < lV0Result->GetCutMaxEtaTracks() &&
-                lV0Result->GetCutMinEtaTracks() < fTreeVariablePosEta && fTreeVariablePosEta < lV0Result->GetCutMaxEtaTracks() &&
-                lRap > lV0Result->GetCutMinRapidity() &&
-                lRap < lV0Result->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                fTreeVariableV0Radius > lV0Result->GetCutV0Radius() &&
-                fTreeVariableV0Radius < lV0Result->GetCutMaxV0Radius() &&
-                fTreeVariableDcaNegToPrimVertex > lV0Result->GetCutDCANegToPV() &&
-                fTreeVariableDcaPosToPrimVertex > lV0Result->GetCutDCAPosToPV() &&
-                fTreeVariableDcaV0Daughters < lV0Result->GetCutDCAV0Daughters() &&
-                fTreeVariableV0CosineOfPointingAngle > lV0CosPACut &&
-                fTreeVariableDistOverTotMom*lPDGMass < lV0Result->GetCutProperLifetime() &&
-                fTreeVariableLeastNbrCrossedRows > lV0Result->GetCutLeastNumberOfCrossedRows() &&
-                fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() &&
-                
-                //Check 4: Minimum momentum of baryon daughter
-                ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short || lBaryonMomentum > lV0Result->GetCutMinBaryonMomentum() ) &&
-                
-                //Check 5: TPC dEdx selections
-                TMath::Abs(lNegdEdx)<lV0Result->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx)<lV0Result->GetCutTPCdEdx() &&
-                
-                //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
-                ( ( lV0Result->GetCutArmenteros() == kFALSE || lV0Result->GetMassHypothesis() != AliV0Result::kK0Short ) || ( fTreeVariablePtArmV0>lV0Result->GetCutArmenterosParameter()*TMath::Abs(fTreeVariableAlphaV0) ) ) &&
-                
-                //Check 7: kITSrefit track selection if requested
-                (
-                 ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) )
-                 ||
-                 !lV0Result->GetCutUseITSRefitTracks()
-                 )&&
-                
-                //Check 8: Max Chi2/Clusters if not absurd
-                ( lV0Result->GetCutMaxChi2PerCluster()>1e+3 ||
-                 (fTreeVariableMaxChi2PerCluster < lV0Result->GetCutMaxChi2PerCluster())
-                 ) &&
-                
-                //Check 9: Min Track Length if positive
-                ( lV0Result->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()&& !lV0Result->GetCutUseParametricLength()) ||
-                 (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()
-                  - (TMath::Power(1/(fTreeVariablePt+1e-6),1.5)) //rough parametrization, tune me!
-                  - TMath::Max(fTreeVariableV0Radius-85., 0.) //rough parametrization, tune me!
-                  && lV0Result->GetCutUseParametricLength())
-                 )&&
-                
-                //Check 10: Special 2.76TeV-like dedx
-                // Logic: either not requested, or K0Short, or high-pT baryon daughter, or passes cut!
-                ( !lV0Result->GetCut276TeVLikedEdx() ||
-                 ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short ||
-                  ( lBaryonPt > 1.0 || TMath::Abs(lBaryondEdxFromProton)<3.0 )
-                  )
-                 )&&
-                
-                //Check 14: has at least one track with some TOF info, please (reject pileup)
-                //          warning: this is still to be studied in more detail!
-                (
-                 lV0Result->GetCutAtLeastOneTOF() == kFALSE ||
-                 (
-                  TMath::Abs(fTreeVariableNegTOFSignal) < 100 ||
-                  TMath::Abs(fTreeVariablePosTOFSignal) < 100
-                  )
-                 )&&
-                
-                //Check 15: cowboy/sailor for V0
-                (
-                 lV0Result->GetCutIsCowboy()==0 ||
-                 (lV0Result->GetCutIsCowboy()== 1 && fTreeVariableIsCowboy==kTRUE ) ||
-                 (lV0Result->GetCutIsCowboy()==-1 && fTreeVariableIsCowboy==kFALSE)
-                 )&&//end cowboy/sailor
-                
-                //Check 16: modern track quality selections
-                (
-                 lV0Result->GetCutMinCrossedRowsOverLength()<0 ||
-                 (lLeastNcrOverLength>lV0Result->GetCutMinCrossedRowsOverLength())
-                 )&&
-                //Check 17: ITS or TOF required 
-                (
-                 lV0Result->GetCutITSorTOF()==kFALSE || lITSorTOFsatisfied==kTRUE
-                 )
-                )//end major if
-            {
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeVariablePt, lMass );
-            }
+            //Check 5: TPC dEdx selections
+            ( lNegdEdxHypo[lh] < lCutdEdx[lcfg] ) &
+            ( lPosdEdxHypo[lh] < lCutdEdx[lcfg] ) &
+            
+            //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
+            ( !lCutArm[lcfg] || lh != AliV0Result::kK0Short || fTreeVariablePtArmV0 > lCutArmPar[lcfg]*lAbsAlpha ) &
+            
+            //Check 7: kITSrefit track selection if requested
+            ( lITSRefitBoth || !lCutITSRefit[lcfg] ) &
+            
+            //Check 8: Max Chi2/Clusters if not absurd
+            ( lCutChi2[lcfg] > 1e+3 || fTreeVariableMaxChi2PerCluster < lCutChi2[lcfg] ) &
+            
+            //Check 9: Min Track Length if positive
+            ( lCutLength[lcfg] < 0 || //this is a bit paranoid...
+             ( fTreeVariableMinTrackLength > lCutLength[lcfg] && !lCutParLength[lcfg] ) ||
+             ( fTreeVariableMinTrackLength > lCutLength[lcfg] - lLengthPtTerm - lLengthRadiusTerm && lCutParLength[lcfg] ) ) &
+            
+            //Check 10: Special 2.76TeV-like dedx
+            ( !lCut276dEdx[lcfg] || l276TeVdEdxHypo[lh] ) &
+            
+            //Check 14: has at least one track with some TOF info, please (reject pileup)
+            //          warning: this is still to be studied in more detail!
+            ( !lCutTOF[lcfg] || lHasTOF ) &
+            
+            //Check 15: cowboy/sailor for V0
+            ( lCutCowboy[lcfg] == 0 ||
+             ( lCutCowboy[lcfg] ==  1 && fTreeVariableIsCowboy == kTRUE ) ||
+             ( lCutCowboy[lcfg] == -1 && fTreeVariableIsCowboy == kFALSE ) ) &
+            
+            //Check 16: modern track quality selections
+            ( lCutNcrLength[lcfg] < 0 || lLeastNcrOverLength > lCutNcrLength[lcfg] ) &
+            
+            //Check 17: ITS or TOF required
+            ( !lCutITSorTOF[lcfg] || lITSorTOFsatisfied );
+        }
+        
+        //Fill histograms of the configurations satisfying all conditionals
+        for(Int_t lcfg=0; lcfg<lNConfigurations; lcfg++){
+            if( lPass[lcfg] ) fV0CutTable.fHistogram[lcfg] -> Fill ( fCentrality, fTreeVariablePt, lMassHypo[lHypo[lcfg]] );
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         // End Superlight adaptive output mode
@@ -2361,6 +2327,10 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     
     Bool_t lValidXiMinus, lValidXiPlus, lValidOmegaMinus, lValidOmegaPlus;
     
+    //Columnar copy of the cascade configurations, made once
+    if( fCascadeCutTable.GetN() != fListXiMinus->GetEntries()+fListXiPlus->GetEntries()+fListOmegaMinus->GetEntries()+fListOmegaPlus->GetEntries() )
+        fCascadeCutTable.Compile(fListXiMinus, fListXiPlus, fListOmegaMinus, fListOmegaPlus);
+    
     for (Int_t iXi = 0; iXi < ncascades; iXi++) {
         
         //------------------------------------------------
@@ -3201,381 +3171,262 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         
         //Step 1: Sweep members of the output object TLists and fill all of them as appropriate
-        TH3F *histoout         = 0x0;
-        AliCascadeResult *lCascadeResult = 0x0;
-        
-        //pointers to valid results
-        AliCascadeResult *lPointers[50000];
-        Long_t lValidConfigurations=0;
+        //The configurations are read from their columnar copy (fCascadeCutTable), as for V0s
+        const Int_t lNConfigurations = fCascadeCutTable.GetN();
+        
+        //For parametric V0 Mass selection
+        Float_t lExpV0Mass =
+        fLambdaMassMean[0]+
+        fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
+        fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
+        
+        Float_t lExpV0Sigma =
+        fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
+        fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
+        
+        //========================================================================
+        //For 2.76TeV-like parametric V0 CosPA
+        Float_t l276TeVV0CosPA = 0.998;
+        Float_t pThr=1.5;
+        if (lV0TotMomentum<pThr) {
+            //Below the threshold "pThr", try a momentum dependent cos(PA) cut
+            const Double_t bend=0.03; // approximate Xi bending angle
+            const Double_t qt=0.211;  // max Lambda pT in Omega decay
+            const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
+            Double_t
+            cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
+            l276TeVV0CosPA = cpaCut;
+        }
+        //========================================================================
+        
+        //Candidate under each mass hypothesis (index: AliCascadeResult::EMassHypo)
+        const Bool_t  lValidHypo[4] = {lValidXiMinus, lValidXiPlus, lValidOmegaMinus, lValidOmegaPlus};
+        const Float_t lMassHypo[4]  = {fTreeCascVarMassAsXi, fTreeCascVarMassAsXi, fTreeCascVarMassAsOmega, fTreeCascVarMassAsOmega};
+        const Float_t lV0MassHypo[4] = {fTreeCascVarV0MassLambda, fTreeCascVarV0MassAntiLambda, fTreeCascVarV0MassLambda, fTreeCascVarV0MassAntiLambda};
+        const Float_t lRapHypo[4]   = {fTreeCascVarRapXi, fTreeCascVarRapXi, fTreeCascVarRapOmega, fTreeCascVarRapOmega};
+        const Float_t lPDGMassHypo[4] = {1.32171, 1.32171, 1.67245, 1.67245};
+        const Float_t lNegdEdxHypo[4] = {TMath::Abs(fTreeCascVarNegNSigmaPion), TMath::Abs(fTreeCascVarNegNSigmaProton), TMath::Abs(fTreeCascVarNegNSigmaPion), TMath::Abs(fTreeCascVarNegNSigmaProton)};
+        const Float_t lPosdEdxHypo[4] = {TMath::Abs(fTreeCascVarPosNSigmaProton), TMath::Abs(fTreeCascVarPosNSigmaPion), TMath::Abs(fTreeCascVarPosNSigmaProton), TMath::Abs(fTreeCascVarPosNSigmaPion)};
+        const Float_t lBachdEdxHypo[4] = {TMath::Abs(fTreeCascVarBachNSigmaPion), TMath::Abs(fTreeCascVarBachNSigmaPion), TMath::Abs(fTreeCascVarBachNSigmaKaon), TMath::Abs(fTreeCascVarBachNSigmaKaon)};
+        const Float_t lNegTOFsigmaHypo[4] = {fTreeCascVarNegTOFNSigmaPion, fTreeCascVarNegTOFNSigmaProton, fTreeCascVarNegTOFNSigmaPion, fTreeCascVarNegTOFNSigmaProton};
+        const Float_t lPosTOFsigmaHypo[4] = {fTreeCascVarPosTOFNSigmaProton, fTreeCascVarPosTOFNSigmaPion, fTreeCascVarPosTOFNSigmaProton, fTreeCascVarPosTOFNSigmaPion};
+        const Float_t lBachTOFsigmaHypo[4] = {fTreeCascVarBachTOFNSigmaPion, fTreeCascVarBachTOFNSigmaPion, fTreeCascVarBachTOFNSigmaKaon, fTreeCascVarBachTOFNSigmaKaon};
+        Float_t  lLifetimeHypo[4];
+        Double_t lV0MassDiffHypo[4];
+        Float_t  lV0MassNSigmaHypo[4];
+        Bool_t   lTOFsigmaHypo[4];
+        for(Int_t ihypo=0; ihypo<4; ihypo++){
+            lLifetimeHypo[ihypo] = fTreeCascVarDistOverTotMom*lPDGMassHypo[ihypo];
+            lV0MassDiffHypo[ihypo] = TMath::Abs(lV0MassHypo[ihypo]-1.116);
+            //For parametric V0 Mass selection
+            lV0MassNSigmaHypo[ihypo] = TMath::Abs( (lV0MassHypo[ihypo]-lExpV0Mass) / lExpV0Sigma );
+            //TOF selections (experimental), only checked if GetCutUseTOFUnchecked
+            lTOFsigmaHypo[ihypo] = TMath::Abs(lNegTOFsigmaHypo[ihypo])< 4 && TMath::Abs(lPosTOFsigmaHypo[ihypo])< 4 && TMath::Abs(lBachTOFsigmaHypo[ihypo])< 4;
+        }
         
-        if( lValidXiMinus )
-            for( Int_t icfg=0; icfg<fListXiMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiMinus->At(icfg);
-                lValidConfigurations++;
+        //Candidate-only quantities
+        const Double_t lXiMassDiff = TMath::Abs( fTreeCascVarMassAsXi - 1.32171 );
+        const Bool_t lNegITSRefit  = fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit;
+        const Bool_t lPosITSRefit  = fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit;
+        const Bool_t lBachITSRefit = fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit;
+        const Double_t lLengthPtTerm     = TMath::Power(1/(fTreeCascVarPt+1e-6),1.5); //rough parametrization, tune me!
+        const Double_t lLengthRadiusTerm = TMath::Max(fTreeCascVarV0Radius-85., 0.); //rough parametrization, tune me!
+        const Double_t lCascDCAtoPV = TMath::Sqrt(fTreeCascVarCascDCAtoPVz*fTreeCascVarCascDCAtoPVz + fTreeCascVarCascDCAtoPVxy*fTreeCascVarCascDCAtoPVxy);
+        const Bool_t lHasTOF = TMath::Abs(fTreeCascVarNegTOFSignal) < 100 || TMath::Abs(fTreeCascVarPosTOFSignal) < 100 || TMath::Abs(fTreeCascVarBachTOFSignal) < 100;
+        
+        //Setting up: Variable Cascade CosPA, V0 CosPA, BB CosPA and DCA Casc Dau
+        Float_t *lCascCosPACut  = fCascadeCutTable.fCascCosPACut.data();
+        Float_t *lV0CosPACut    = fCascadeCutTable.fV0CosPACut.data();
+        Float_t *lBBCosPACut    = fCascadeCutTable.fBBCosPACut.data();
+        Float_t *lDCACascDauCut = fCascadeCutTable.fDCACascDauCut.data();
+        for(Int_t lcfg=0; lcfg<lNConfigurations; lcfg++){
+            lCascCosPACut[lcfg] = fCascadeCutTable.fCascCosPA[lcfg];
+            if( fCascadeCutTable.fUseVarCascCosPA[lcfg] ){
+                Float_t lVarCascCosPA = TMath::Cos(
+                                                   fCascadeCutTable.fVarCascCosPAExp0Const[lcfg]*TMath::Exp(fCascadeCutTable.fVarCascCosPAExp0Slope[lcfg]*fTreeCascVarPt) +
+                                                   fCascadeCutTable.fVarCascCosPAExp1Const[lcfg]*TMath::Exp(fCascadeCutTable.fVarCascCosPAExp1Slope[lcfg]*fTreeCascVarPt) +
+                                                   fCascadeCutTable.fVarCascCosPAConst[lcfg]);
+                //Only use if tighter than the non-variable cut
+                if( lVarCascCosPA > lCascCosPACut[lcfg] ) lCascCosPACut[lcfg] = lVarCascCosPA;
             }
-        if( lValidXiPlus )
-            for( Int_t icfg=0; icfg<fListXiPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiPlus->At(icfg);
-                lValidConfigurations++;
+            lV0CosPACut[lcfg] = fCascadeCutTable.fV0CosPA[lcfg];
+            if( fCascadeCutTable.fUseVarV0CosPA[lcfg] ){
+                Float_t lVarV0CosPA = TMath::Cos(
+                                                 fCascadeCutTable.fVarV0CosPAExp0Const[lcfg]*TMath::Exp(fCascadeCutTable.fVarV0CosPAExp0Slope[lcfg]*fTreeCascVarPt) +
+                                                 fCascadeCutTable.fVarV0CosPAExp1Const[lcfg]*TMath::Exp(fCascadeCutTable.fVarV0CosPAExp1Slope[lcfg]*fTreeCascVarPt) +
+                                                 fCascadeCutTable.fVarV0CosPAConst[lcfg]);
+                //Only use if tighter than the non-variable cut
+                if( lVarV0CosPA > lV0CosPACut[lcfg] ) lV0CosPACut[lcfg] = lVarV0CosPA;
             }
-        if( lValidOmegaMinus )
-            for( Int_t icfg=0; icfg<fListOmegaMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaMinus->At(icfg);
-                lValidConfigurations++;
+            lBBCosPACut[lcfg] = fCascadeCutTable.fBachBaryonCosPA[lcfg];
+            if( fCascadeCutTable.fUseVarBBCosPA[lcfg] ){
+                Float_t lVarBBCosPA = TMath::Cos(
+                                                 fCascadeCutTable.fVarBBCosPAExp0Const[lcfg]*TMath::Exp(fCascadeCutTable.fVarBBCosPAExp0Slope[lcfg]*fTreeCascVarPt) +
+                                                 fCascadeCutTable.fVarBBCosPAExp1Const[lcfg]*TMath::Exp(fCascadeCutTable.fVarBBCosPAExp1Slope[lcfg]*fTreeCascVarPt) +
+                                                 fCascadeCutTable.fVarBBCosPAConst[lcfg]);
+                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
+                if( lVarBBCosPA > lBBCosPACut[lcfg] ) lBBCosPACut[lcfg] = lVarBBCosPA;
             }
-        if( lValidOmegaPlus )
-            for( Int_t icfg=0; icfg<fListOmegaPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaPlus->At(icfg);
-                lValidConfigurations++;
+            lDCACascDauCut[lcfg] = fCascadeCutTable.fDCACascDaughters[lcfg];
+            if( fCascadeCutTable.fUseVarDCACascDau[lcfg] ){
+                Float_t lVarDCACascDau = fCascadeCutTable.fVarDCACascDauExp0Const[lcfg]*TMath::Exp(fCascadeCutTable.fVarDCACascDauExp0Slope[lcfg]*fTreeCascVarPt) +
+                fCascadeCutTable.fVarDCACascDauExp1Const[lcfg]*TMath::Exp(fCascadeCutTable.fVarDCACascDauExp1Slope[lcfg]*fTreeCascVarPt) +
+                fCascadeCutTable.fVarDCACascDauConst[lcfg];
+                //Loosest: default cut, parametric can go tighter
+                if( lVarDCACascDau < lDCACascDauCut[lcfg] ) lDCACascDauCut[lcfg] = lVarDCACascDau;
             }
+        }
         
-        for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lCascadeResult = lPointers[lcfg];
-            Bool_t lTheOne = fkConfigToSave.EqualTo( lCascadeResult->GetName() );
-            histoout  = lCascadeResult->GetHistogram();
+        const Int_t    *lHypo            = fCascadeCutTable.fMassHypo.data();
+        const Int_t    *lCutCharge       = fCascadeCutTable.fCharge.data();
+        const Double_t *lCutMinEta       = fCascadeCutTable.fMinEtaTracks.data();
+        const Double_t *lCutMaxEta       = fCascadeCutTable.fMaxEtaTracks.data();
+        const Double_t *lCutMinRap       = fCascadeCutTable.fMinRapidity.data();
+        const Double_t *lCutMaxRap       = fCascadeCutTable.fMaxRapidity.data();
+        const Double_t *lCutDCANeg       = fCascadeCutTable.fDCANegToPV.data();
+        const Double_t *lCutDCAPos       = fCascadeCutTable.fDCAPosToPV.data();
+        const Double_t *lCutDCAV0Dau     = fCascadeCutTable.fDCAV0Daughters.data();
+        const Double_t *lCutV0Radius     = fCascadeCutTable.fV0Radius.data();
+        const Double_t *lCutDCAV0ToPV    = fCascadeCutTable.fDCAV0ToPV.data();
+        const Double_t *lCutV0Mass       = fCascadeCutTable.fV0Mass.data();
+        const Double_t *lCutV0MassSigma  = fCascadeCutTable.fV0MassSigma.data();
+        const Double_t *lCutDCABach      = fCascadeCutTable.fDCABachToPV.data();
+        const Double_t *lCutCascRadius   = fCascadeCutTable.fCascRadius.data();
+        const Double_t *lCutLifetime     = fCascadeCutTable.fProperLifetime.data();
+        const Double_t *lCutNClusters    = fCascadeCutTable.fLeastNumberOfClusters.data();
+        const Double_t *lCutdEdx         = fCascadeCutTable.fTPCdEdx.data();
+        const UChar_t  *lCutTOFUnchecked = fCascadeCutTable.fUseTOFUnchecked.data();
+        const Double_t *lCutXiRejection  = fCascadeCutTable.fXiRejection.data();
+        const Double_t *lCutDCABachBar   = fCascadeCutTable.fDCABachToBaryon.data();
+        const Double_t *lCutMinV0Life    = fCascadeCutTable.fMinV0Lifetime.data();
+        const Double_t *lCutMaxV0Life    = fCascadeCutTable.fMaxV0Lifetime.data();
+        const UChar_t  *lCutITSRefit     = fCascadeCutTable.fUseITSRefitTracks.data();
+        const Double_t *lCutChi2         = fCascadeCutTable.fMaxChi2PerCluster.data();
+        const Double_t *lCutLength       = fCascadeCutTable.fMinTrackLength.data();
+        const UChar_t  *lCutParLength    = fCascadeCutTable.fUseParametricLength.data();
+        const UChar_t  *lCut276V0CosPA   = fCascadeCutTable.fUse276TeVV0CosPA.data();
+        const Double_t *lCutCascDCAToPV  = fCascadeCutTable.fDCACascadeToPV.data();
+        const UChar_t  *lCutTOF          = fCascadeCutTable.fAtLeastOneTOF.data();
+        const UChar_t  *lCutITSRefitNeg  = fCascadeCutTable.fUseITSRefitNegative.data();
+        const UChar_t  *lCutITSRefitPos  = fCascadeCutTable.fUseITSRefitPositive.data();
+        const UChar_t  *lCutITSRefitBach = fCascadeCutTable.fUseITSRefitBachelor.data();
+        const Int_t    *lCutCowboy       = fCascadeCutTable.fIsCowboy.data();
+        const Int_t    *lCutCascCowboy   = fCascadeCutTable.fIsCascadeCowboy.data();
+        const Double_t *lCutNcrLength    = fCascadeCutTable.fMinCrossedRowsOverLength.data();
+        const Double_t *lCutNCR          = fCascadeCutTable.fLeastNumberOfCrossedRows.data();
+        const UChar_t  *lCutITSorTOF     = fCascadeCutTable.fITSorTOF.data();
+        UChar_t        *lPass            = fCascadeCutTable.fPass.data();
+        
+        for(Int_t lcfg=0; lcfg<lNConfigurations; lcfg++){
+            const Int_t lh = lHypo[lcfg];
+            lPass[lcfg] =
+            //Check 0: Pre-selection for this mass hypothesis
+            lValidHypo[lh] &
             
-            Float_t lMass = 0;
-            Float_t lV0Mass = 0;
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBachdEdx = 100;
-            Float_t lNegTOFsigma = 100;
-            Float_t lPosTOFsigma = 100;
-            Float_t lBachTOFsigma = 100;
-            Short_t  lCharge = -2;
-            Int_t lChargePos =  1;
-            Int_t lChargeNeg = -1;
-            Float_t lprpx, lprpy, lprpz, lpipx, lpipy, lpipz;
-            lpipx = fTreeCascVarBachPx;
-            lpipy = fTreeCascVarBachPy;
-            lpipz = fTreeCascVarBachPz;
+            //Check 1: Charge consistent with expectations
+            ( fTreeCascVarCharge == lCutCharge[lcfg] ) &
             
-            //For parametric V0 Mass selection
-            Float_t lExpV0Mass =
-            fLambdaMassMean[0]+
-            fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
-            fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
+            //Check 2: Basic Acceptance cuts
+            ( lCutMinEta[lcfg] < fTreeCascVarPosEta ) & ( fTreeCascVarPosEta < lCutMaxEta[lcfg] ) &
+            ( lCutMinEta[lcfg] < fTreeCascVarNegEta ) & ( fTreeCascVarNegEta < lCutMaxEta[lcfg] ) &
+            ( lCutMinEta[lcfg] < fTreeCascVarBachEta ) & ( fTreeCascVarBachEta < lCutMaxEta[lcfg] ) &
+            ( lRapHypo[lh] > lCutMinRap[lcfg] ) &
+            ( lRapHypo[lh] < lCutMaxRap[lcfg] ) &
             
-            Float_t lExpV0Sigma =
-            fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
-            fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
+            //Check 3: Topological Variables
+            // - V0 Selections
+            ( fTreeCascVarDCANegToPrimVtx > lCutDCANeg[lcfg] ) &
+            ( fTreeCascVarDCAPosToPrimVtx > lCutDCAPos[lcfg] ) &
+            ( fTreeCascVarDCAV0Daughters < lCutDCAV0Dau[lcfg] ) &
+            ( fTreeCascVarV0CosPointingAngle > lV0CosPACut[lcfg] ) &
+            ( fTreeCascVarV0Radius > lCutV0Radius[lcfg] ) &
+            // - Cascade Selections
+            ( fTreeCascVarDCAV0ToPrimVtx > lCutDCAV0ToPV[lcfg] ) &
+            ( lV0MassDiffHypo[lh] < lCutV0Mass[lcfg] ) &
+            ( fTreeCascVarDCABachToPrimVtx > lCutDCABach[lcfg] ) &
+            ( fTreeCascVarDCACascDaughters < lDCACascDauCut[lcfg] ) &
+            ( fTreeCascVarCascCosPointingAngle > lCascCosPACut[lcfg] ) &
+            ( fTreeCascVarCascRadius > lCutCascRadius[lcfg] ) &
             
-            //========================================================================
-            //For 2.76TeV-like parametric V0 CosPA
-            Float_t l276TeVV0CosPA = 0.998;
-            Float_t pThr=1.5;
-            if (lV0TotMomentum<pThr) {
-                //Below the threshold "pThr", try a momentum dependent cos(PA) cut
-                const Double_t bend=0.03; // approximate Xi bending angle
-                const Double_t qt=0.211;  // max Lambda pT in Omega decay
-                const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
-                Double_t
-                cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
-                l276TeVV0CosPA = cpaCut;
-            }
-            //========================================================================
+            // - Implementation of a parametric V0 Mass cut if requested
+            ( lCutV0MassSigma[lcfg] > 50 || //anything goes
+             lV0MassNSigmaHypo[lh] < lCutV0MassSigma[lcfg] ) &
             
-            //========================================================================
-            //Setting up: Variable Cascade CosPA
-            Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
-            Float_t lVarCascCosPApar[5];
-            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
-            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
-            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
-            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
-            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
-            Float_t lVarCascCosPA = TMath::Cos(
-                                               lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarCascCosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
-            }
-            //========================================================================
+            // - Miscellaneous
+            ( lLifetimeHypo[lh] < lCutLifetime[lcfg] ) &
+            ( fTreeCascVarLeastNbrClusters > lCutNClusters[lcfg] ) &
             
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[4]);
-            if( lCascadeResult->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
+            //Check 4: TPC dEdx selections
+            ( lNegdEdxHypo[lh] < lCutdEdx[lcfg] ) &
+            ( lPosdEdxHypo[lh] < lCutdEdx[lcfg] ) &
+            ( lBachdEdxHypo[lh] < lCutdEdx[lcfg] ) &
             
-            //========================================================================
-            //Setting up: Variable BB CosPA
-            Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
-            Float_t lVarBBCosPApar[5];
-            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
-            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
-            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
-            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
-            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
-            Float_t lVarBBCosPA = TMath::Cos(
-                                             lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarBBCosPA() ){
-                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
-                if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
-            }
-            //========================================================================
+            //Check 4bis: TOF selections (experimental)
+            ( !lCutTOFUnchecked[lcfg] || lTOFsigmaHypo[lh] ) &
             
-            //========================================================================
-            //Setting up: Variable DCA Casc Dau
-            Float_t lDCACascDauCut = lCascadeResult -> GetCutDCACascDaughters();
-            Float_t lVarDCACascDaupar[5];
-            lVarDCACascDaupar[0] = lCascadeResult->GetCutVarDCACascDauExp0Const();
-            lVarDCACascDaupar[1] = lCascadeResult->GetCutVarDCACascDauExp0Slope();
-            lVarDCACascDaupar[2] = lCascadeResult->GetCutVarDCACascDauExp1Const();
-            lVarDCACascDaupar[3] = lCascadeResult->GetCutVarDCACascDauExp1Slope();
-            lVarDCACascDaupar[4] = lCascadeResult->GetCutVarDCACascDauConst();
-            Float_t lVarDCACascDau = lVarDCACascDaupar[0]*TMath::Exp(lVarDCACascDaupar[1]*fTreeCascVarPt) +
-            lVarDCACascDaupar[2]*TMath::Exp(lVarDCACascDaupar[3]*fTreeCascVarPt) +
-            lVarDCACascDaupar[4];
-            if( lCascadeResult->GetCutUseVarDCACascDau() ){
-                //Loosest: default cut, parametric can go tighter
-                if( lVarDCACascDau < lDCACascDauCut ) lDCACascDauCut = lVarDCACascDau;
-            }
-            //========================================================================
+            //Check 5: Xi rejection for Omega analysis
+            ( ( lh != AliCascadeResult::kOmegaMinus && lh != AliCascadeResult::kOmegaPlus ) || lXiMassDiff > lCutXiRejection[lcfg] ) &
             
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lNegTOFsigma = fTreeCascVarNegTOFNSigmaPion;
-                lPosTOFsigma = fTreeCascVarPosTOFNSigmaProton;
-                lBachTOFsigma = fTreeCascVarBachTOFNSigmaPion;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lNegTOFsigma = fTreeCascVarNegTOFNSigmaProton;
-                lPosTOFsigma = fTreeCascVarPosTOFNSigmaPion;
-                lBachTOFsigma = fTreeCascVarBachTOFNSigmaPion;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lNegTOFsigma = fTreeCascVarNegTOFNSigmaPion;
-                lPosTOFsigma = fTreeCascVarPosTOFNSigmaProton;
-                lBachTOFsigma = fTreeCascVarBachTOFNSigmaKaon;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lNegTOFsigma = fTreeCascVarNegTOFNSigmaProton;
-                lPosTOFsigma = fTreeCascVarPosTOFNSigmaPion;
-                lBachTOFsigma = fTreeCascVarBachTOFNSigmaKaon;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
+            //Check 6: Experimental DCA Bachelor to Baryon cut
+            ( fTreeCascVarDCABachToBaryon > lCutDCABachBar[lcfg] ) &
             
-            if (lCascadeResult->GetCutUseTOFUnchecked() == kFALSE ){
-                //Always-pass values
-                lNegTOFsigma = 0;
-                lPosTOFsigma = 0;
-                lBachTOFsigma = 0;
-            }
+            //Check 7: Experimental Bach Baryon CosPA
+            ( fTreeCascVarWrongCosPA < lBBCosPACut[lcfg] ) &
             
-            if (
-                //Check 1: Charge consistent with expectations
-                fTreeCascVarCharge == lCharge &&
-                
-                //Check 2: Basic Acceptance cuts
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarPosEta && fTreeCascVarPosEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarNegEta && fTreeCascVarNegEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarBachEta && fTreeCascVarBachEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lRap > lCascadeResult->GetCutMinRapidity() &&
-                lRap < lCascadeResult->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                // - V0 Selections
-                fTreeCascVarDCANegToPrimVtx > lCascadeResult->GetCutDCANegToPV() &&
-                fTreeCascVarDCAPosToPrimVtx > lCascadeResult->GetCutDCAPosToPV() &&
-                fTreeCascVarDCAV0Daughters < lCascadeResult->GetCutDCAV0Daughters() &&
-                fTreeCascVarV0CosPointingAngle > lV0CosPACut &&
-                fTreeCascVarV0Radius > lCascadeResult->GetCutV0Radius() &&
-                // - Cascade Selections
-                fTreeCascVarDCAV0ToPrimVtx > lCascadeResult->GetCutDCAV0ToPV() &&
-                TMath::Abs(lV0Mass-1.116) < lCascadeResult->GetCutV0Mass() &&
-                fTreeCascVarDCABachToPrimVtx > lCascadeResult->GetCutDCABachToPV() &&
-                fTreeCascVarDCACascDaughters < lDCACascDauCut &&
-                fTreeCascVarCascCosPointingAngle > lCascCosPACut &&
-                fTreeCascVarCascRadius > lCascadeResult->GetCutCascRadius() &&
-                
-                // - Implementation of a parametric V0 Mass cut if requested
-                (
-                 ( lCascadeResult->GetCutV0MassSigma() > 50 ) || //anything goes
-                 (TMath::Abs( (lV0Mass-lExpV0Mass) / lExpV0Sigma ) < lCascadeResult->GetCutV0MassSigma() )
-                 ) &&
-                
-                // - Miscellaneous
-                fTreeCascVarDistOverTotMom*lPDGMass < lCascadeResult->GetCutProperLifetime() &&
-                fTreeCascVarLeastNbrClusters > lCascadeResult->GetCutLeastNumberOfClusters() &&
-                
-                //Check 4: TPC dEdx selections
-                TMath::Abs(lNegdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lBachdEdx)<lCascadeResult->GetCutTPCdEdx() &&
-                
-                //Check 4bis: TOF selections (experimental)
-                //WARNING: if lCascadeResult->GetCutUseTOFUnchecked is false, the TOFsigmas will be zero: will always pass
-                TMath::Abs(lNegTOFsigma )< 4 &&
-                TMath::Abs(lPosTOFsigma )< 4 &&
-                TMath::Abs(lBachTOFsigma)< 4 &&
-                
-                //Check 5: Xi rejection for Omega analysis
-                ( ( lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaMinus && lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaPlus  ) || ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCascadeResult->GetCutXiRejection() ) ) &&
-                
-                //Check 6: Experimental DCA Bachelor to Baryon cut
-                ( fTreeCascVarDCABachToBaryon > lCascadeResult->GetCutDCABachToBaryon() ) &&
-                
-                //Check 7: Experimental Bach Baryon CosPA
-                ( fTreeCascVarWrongCosPA < lBBCosPACut  ) &&
-                
-                //Check 8: Min/Max V0 Lifetime cut
-                ( ( fTreeCascVarV0Lifetime > lCascadeResult->GetCutMinV0Lifetime() ) &&
-                 ( fTreeCascVarV0Lifetime < lCascadeResult->GetCutMaxV0Lifetime() ||
-                  lCascadeResult->GetCutMaxV0Lifetime() > 1e+3 ) ) &&
-                
-                //Check 9: kITSrefit track selection if requested
-                (
-                 ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit)
-                  )
-                 ||
-                 !lCascadeResult->GetCutUseITSRefitTracks()
-                 ) &&
-                
-                //Check 10: Max Chi2/Clusters if not absurd
-                ( lCascadeResult->GetCutMaxChi2PerCluster()>1e+3 ||
-                 (fTreeCascVarMaxChi2PerCluster < lCascadeResult->GetCutMaxChi2PerCluster())
-                 )&&
-                
-                //Check 11: Min Track Length if positive, [min - (1/pt)^1.5] if parametric requested
-                ( lCascadeResult->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength() && !lCascadeResult->GetCutUseParametricLength())||
-                 (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength()
-                  - (TMath::Power(1/(fTreeCascVarPt+1e-6),1.5)) //rough parametrization, tune me!
-                  - TMath::Max(fTreeCascVarV0Radius-85., 0.) //rough parametrization, tune me!
-                  && lCascadeResult->GetCutUseParametricLength())
-                 )&&
-                
-                //Check 12: Check if special V0 CosPA cut used
-                //either don't use the cut at all, or make sure it's above threshold
-                ( lCascadeResult->GetCutUse276TeVV0CosPA()==kFALSE ||
-                 fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA
-                 )&&
-                
-                //Check 13: 3D Cascade DCA to PV
-                ( lCascadeResult->GetCutDCACascadeToPV() > 999 ||
-                 (TMath::Sqrt(fTreeCascVarCascDCAtoPVz*fTreeCascVarCascDCAtoPVz + fTreeCascVarCascDCAtoPVxy*fTreeCascVarCascDCAtoPVxy)<lCascadeResult->GetCutDCACascadeToPV() )
-                 )&&
-                
-                //Check 14: has at least one track with some TOF info, please (reject pileup)
-                //          warning: this is still to be studied in more detail!
-                (
-                 lCascadeResult->GetCutAtLeastOneTOF() == kFALSE ||
-                 (
-                  TMath::Abs(fTreeCascVarNegTOFSignal) < 100 ||
-                  TMath::Abs(fTreeCascVarPosTOFSignal) < 100 ||
-                  TMath::Abs(fTreeCascVarBachTOFSignal) < 100
-                  )
-                 )&&
-                
-                //Check 15: check each prong for ITS refit
-                (
-                 ( lCascadeResult->GetCutUseITSRefitNegative()==kFALSE || fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit ) &&
-                 ( lCascadeResult->GetCutUseITSRefitPositive()==kFALSE || fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit ) &&
-                 ( lCascadeResult->GetCutUseITSRefitBachelor()==kFALSE || fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit )
-                 )&&
-                
-                //Check 16: cowboy/sailor for V0
-                (
-                    lCascadeResult->GetCutIsCowboy()==0 ||
-                 (lCascadeResult->GetCutIsCowboy()== 1 && fTreeCascVarIsCowboy==kTRUE ) ||
-                 (lCascadeResult->GetCutIsCowboy()==-1 && fTreeCascVarIsCowboy==kFALSE)
-                )&&//end cowboy/sailor
-                
-                //Check 17: cowboy/sailor for cascade
-                (
-                 lCascadeResult->GetCutIsCascadeCowboy()==0 ||
-                 (lCascadeResult->GetCutIsCascadeCowboy()== 1 && fTreeCascVarIsCascadeCowboy==kTRUE ) ||
-                 (lCascadeResult->GetCutIsCascadeCowboy()==-1 && fTreeCascVarIsCascadeCowboy==kFALSE)
-                 )&&//end cowboy/sailor
-                
-                //Check 18: modern track quality selections
-                (
-                 lCascadeResult->GetCutMinCrossedRowsOverLength()<0 ||
-                 (lLeastNcrOverLength>lCascadeResult->GetCutMinCrossedRowsOverLength())
-                 )&&
-                //Check 19: modern track quality selections
-                (
-                 lCascadeResult->GetCutLeastNumberOfCrossedRows()<0 ||
-                 (lLeastNbrCrossedRows>lCascadeResult->GetCutLeastNumberOfCrossedRows())
-                 )&&
-                //Check 20: ITS or TOF required 
-                (
-                 lCascadeResult->GetCutITSorTOF()==kFALSE || lITSorTOFsatisfied==kTRUE
-                 )
-                )//end major if
-            {
-                //This satisfies all my conditionals! Fill histogram
-                if( lTheOne && fkSaveSpecificConfig ) fTreeCascade->Fill();
-                histoout -> Fill ( fCentrality, fTreeCascVarPt, lMass );
-            }
+            //Check 8: Min/Max V0 Lifetime cut
+            ( fTreeCascVarV0Lifetime > lCutMinV0Life[lcfg] ) &
+            ( fTreeCascVarV0Lifetime < lCutMaxV0Life[lcfg] || lCutMaxV0Life[lcfg] > 1e+3 ) &
+            
+            //Check 9: kITSrefit track selection if requested
+            ( ( lPosITSRefit && lNegITSRefit && lBachITSRefit ) || !lCutITSRefit[lcfg] ) &
+            
+            //Check 10: Max Chi2/Clusters if not absurd
+            ( lCutChi2[lcfg] > 1e+3 || fTreeCascVarMaxChi2PerCluster < lCutChi2[lcfg] ) &
+            
+            //Check 11: Min Track Length if positive, [min - (1/pt)^1.5] if parametric requested
+            ( lCutLength[lcfg] < 0 || //this is a bit paranoid...
+             ( fTreeCascVarMinTrackLength > lCutLength[lcfg] && !lCutParLength[lcfg] ) ||
+             ( fTreeCascVarMinTrackLength > lCutLength[lcfg] - lLengthPtTerm - lLengthRadiusTerm && lCutParLength[lcfg] ) ) &
+            
+            //Check 12: Check if special V0 CosPA cut used
+            //either don't use the cut at all, or make sure it's above threshold
+            ( !lCut276V0CosPA[lcfg] || fTreeCascVarV0CosPointingAngle > l276TeVV0CosPA ) &
+            
+            //Check 13: 3D Cascade DCA to PV
+            ( lCutCascDCAToPV[lcfg] > 999 || lCascDCAtoPV < lCutCascDCAToPV[lcfg] ) &
+            
+            //Check 14: has at least one track with some TOF info, please (reject pileup)
+            //          warning: this is still to be studied in more detail!
+            ( !lCutTOF[lcfg] || lHasTOF ) &
+            
+            //Check 15: check each prong for ITS refit
+            ( !lCutITSRefitNeg[lcfg] || lNegITSRefit ) &
+            ( !lCutITSRefitPos[lcfg] || lPosITSRefit ) &
+            ( !lCutITSRefitBach[lcfg] || lBachITSRefit ) &
+            
+            //Check 16: cowboy/sailor for V0
+            ( lCutCowboy[lcfg] == 0 ||
+             ( lCutCowboy[lcfg] ==  1 && fTreeCascVarIsCowboy == kTRUE ) ||
+             ( lCutCowboy[lcfg] == -1 && fTreeCascVarIsCowboy == kFALSE ) ) &
+            
+            //Check 17: cowboy/sailor for cascade
+            ( lCutCascCowboy[lcfg] == 0 ||
+             ( lCutCascCowboy[lcfg] ==  1 && fTreeCascVarIsCascadeCowboy == kTRUE ) ||
+             ( lCutCascCowboy[lcfg] == -1 && fTreeCascVarIsCascadeCowboy == kFALSE ) ) &
+            
+            //Check 18: modern track quality selections
+            ( lCutNcrLength[lcfg] < 0 || lLeastNcrOverLength > lCutNcrLength[lcfg] ) &
+            //Check 19: modern track quality selections
+            ( lCutNCR[lcfg] < 0 || lLeastNbrCrossedRows > lCutNCR[lcfg] ) &
+            //Check 20: ITS or TOF required
+            ( !lCutITSorTOF[lcfg] || lITSorTOFsatisfied );
+        }
+        
+        //Fill histograms of the configurations satisfying all conditionals
+        for(Int_t lcfg=0; lcfg<lNConfigurations; lcfg++){
+            if( !lPass[lcfg] ) continue;
+            if( fkSaveSpecificConfig && fkConfigToSave.EqualTo( fCascadeCutTable.fResult[lcfg]->GetName() ) ) fTreeCascade->Fill();
+            fCascadeCutTable.fHistogram[lcfg] -> Fill ( fCentrality, fTreeCascVarPt, lMassHypo[lHypo[lcfg]] );
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         // End Superlight adaptive output mode
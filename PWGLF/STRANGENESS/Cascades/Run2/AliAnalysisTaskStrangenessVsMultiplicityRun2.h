@@ -50,6 +50,8 @@ class AliExternalTrackParam;
 //#include "AliESDtrackCuts.h"
 #include "AliAnalysisTaskSE.h"
 #include "AliEventCuts.h"
+#include "AliV0CutTable.h"
+#include "AliCascadeCutTable.h"
 
 class AliAnalysisTaskStrangenessVsMultiplicityRun2 : public AliAnalysisTaskSE {
 public:
@@ -245,6 +247,8 @@ private:
     TTree  *fTreeEvent;              //! Output Tree, Events
     TTree  *fTreeV0;              //! Output Tree, V0s
     TTree  *fTreeCascade;              //! Output Tree, Cascades
+    AliV0CutTable      fV0CutTable;      //! Columnar copy of the V0 configurations
+    AliCascadeCutTable fCascadeCutTable; //! Columnar copy of the cascade configurations
 
     AliPIDResponse *fPIDResponse;     //! PID response object
     AliESDtrackCuts *fESDtrackCuts;   //! ESD track cuts used for primary track definition
@@ -658,7 +662,7 @@ private:
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 4);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 5);
     //1: first implementation
 };
 
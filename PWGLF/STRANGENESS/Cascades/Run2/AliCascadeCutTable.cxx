@@ -0,0 +1,186 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Columnar copy of the selections of a set of AliCascadeResult objects
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include "TList.h"
+#include "TH3F.h"
+#include "AliCascadeResult.h"
+#include "AliCascadeCutTable.h"
+
+ClassImp(AliCascadeCutTable);
+//________________________________________________________________
+AliCascadeCutTable::AliCascadeCutTable() :
+fN(0)
+{
+    // Empty table, filled by Compile
+}
+//________________________________________________________________
+void AliCascadeCutTable::Reset()
+{
+    fN = 0;
+    fMassHypo.clear();
+    fHistogram.clear();
+    fResult.clear();
+    fCharge.clear();
+    fMinEtaTracks.clear();
+    fMaxEtaTracks.clear();
+    fMinRapidity.clear();
+    fMaxRapidity.clear();
+    fDCANegToPV.clear();
+    fDCAPosToPV.clear();
+    fDCAV0Daughters.clear();
+    fV0CosPA.clear();
+    fUseVarV0CosPA.clear();
+    fVarV0CosPAExp0Const.clear();
+    fVarV0CosPAExp0Slope.clear();
+    fVarV0CosPAExp1Const.clear();
+    fVarV0CosPAExp1Slope.clear();
+    fVarV0CosPAConst.clear();
+    fV0Radius.clear();
+    fDCAV0ToPV.clear();
+    fV0Mass.clear();
+    fV0MassSigma.clear();
+    fDCABachToPV.clear();
+    fDCACascDaughters.clear();
+    fUseVarDCACascDau.clear();
+    fVarDCACascDauExp0Const.clear();
+    fVarDCACascDauExp0Slope.clear();
+    fVarDCACascDauExp1Const.clear();
+    fVarDCACascDauExp1Slope.clear();
+    fVarDCACascDauConst.clear();
+    fCascCosPA.clear();
+    fUseVarCascCosPA.clear();
+    fVarCascCosPAExp0Const.clear();
+    fVarCascCosPAExp0Slope.clear();
+    fVarCascCosPAExp1Const.clear();
+    fVarCascCosPAExp1Slope.clear();
+    fVarCascCosPAConst.clear();
+    fCascRadius.clear();
+    fProperLifetime.clear();
+    fLeastNumberOfClusters.clear();
+    fTPCdEdx.clear();
+    fUseTOFUnchecked.clear();
+    fXiRejection.clear();
+    fDCABachToBaryon.clear();
+    fBachBaryonCosPA.clear();
+    fUseVarBBCosPA.clear();
+    fVarBBCosPAExp0Const.clear();
+    fVarBBCosPAExp0Slope.clear();
+    fVarBBCosPAExp1Const.clear();
+    fVarBBCosPAExp1Slope.clear();
+    fVarBBCosPAConst.clear();
+    fMinV0Lifetime.clear();
+    fMaxV0Lifetime.clear();
+    fUseITSRefitTracks.clear();
+    fMaxChi2PerCluster.clear();
+    fMinTrackLength.clear();
+    fUseParametricLength.clear();
+    fUse276TeVV0CosPA.clear();
+    fDCACascadeToPV.clear();
+    fAtLeastOneTOF.clear();
+    fUseITSRefitNegative.clear();
+    fUseITSRefitPositive.clear();
+    fUseITSRefitBachelor.clear();
+    fIsCowboy.clear();
+    fIsCascadeCowboy.clear();
+    fMinCrossedRowsOverLength.clear();
+    fLeastNumberOfCrossedRows.clear();
+    fITSorTOF.clear();
+    fV0CosPACut.clear();
+    fCascCosPACut.clear();
+    fBBCosPACut.clear();
+    fDCACascDauCut.clear();
+    fPass.clear();
+}
+//________________________________________________________________
+void AliCascadeCutTable::Compile(TList *lListXiMinus, TList *lListXiPlus, TList *lListOmegaMinus, TList *lListOmegaPlus)
+{
+    //Configurations are stored in the order of the lists, which is the
+    //order in which the task used to loop over them
+    Reset();
+    TList *lLists[4] = {lListXiMinus, lListXiPlus, lListOmegaMinus, lListOmegaPlus};
+    for(Int_t ilist=0; ilist<4; ilist++){
+        if( !lLists[ilist] ) continue;
+        for(Int_t icfg=0; icfg<lLists[ilist]->GetEntries(); icfg++){
+            AliCascadeResult *lCascadeResult = (AliCascadeResult*) lLists[ilist]->At(icfg);
+            //Xi-, Omega-: negative; Xi+, Omega+: positive
+            Int_t lCharge = ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus ||
+                             lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus ) ? -1 : +1;
+            if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+            fMassHypo.push_back( lCascadeResult->GetMassHypothesis() );
+            fResult.push_back( lCascadeResult );
+            fCharge.push_back( lCharge );
+            fHistogram.push_back( lCascadeResult->GetHistogram() );
+            fMinEtaTracks.push_back( lCascadeResult->GetCutMinEtaTracks() );
+            fMaxEtaTracks.push_back( lCascadeResult->GetCutMaxEtaTracks() );
+            fMinRapidity.push_back( lCascadeResult->GetCutMinRapidity() );
+            fMaxRapidity.push_back( lCascadeResult->GetCutMaxRapidity() );
+            fDCANegToPV.push_back( lCascadeResult->GetCutDCANegToPV() );
+            fDCAPosToPV.push_back( lCascadeResult->GetCutDCAPosToPV() );
+            fDCAV0Daughters.push_back( lCascadeResult->GetCutDCAV0Daughters() );
+            fV0CosPA.push_back( lCascadeResult->GetCutV0CosPA() );
+            fUseVarV0CosPA.push_back( lCascadeResult->GetCutUseVarV0CosPA() );
+            fVarV0CosPAExp0Const.push_back( lCascadeResult->GetCutVarV0CosPAExp0Const() );
+            fVarV0CosPAExp0Slope.push_back( lCascadeResult->GetCutVarV0CosPAExp0Slope() );
+            fVarV0CosPAExp1Const.push_back( lCascadeResult->GetCutVarV0CosPAExp1Const() );
+            fVarV0CosPAExp1Slope.push_back( lCascadeResult->GetCutVarV0CosPAExp1Slope() );
+            fVarV0CosPAConst.push_back( lCascadeResult->GetCutVarV0CosPAConst() );
+            fV0Radius.push_back( lCascadeResult->GetCutV0Radius() );
+            fDCAV0ToPV.push_back( lCascadeResult->GetCutDCAV0ToPV() );
+            fV0Mass.push_back( lCascadeResult->GetCutV0Mass() );
+            fV0MassSigma.push_back( lCascadeResult->GetCutV0MassSigma() );
+            fDCABachToPV.push_back( lCascadeResult->GetCutDCABachToPV() );
+            fDCACascDaughters.push_back( lCascadeResult->GetCutDCACascDaughters() );
+            fUseVarDCACascDau.push_back( lCascadeResult->GetCutUseVarDCACascDau() );
+            fVarDCACascDauExp0Const.push_back( lCascadeResult->GetCutVarDCACascDauExp0Const() );
+            fVarDCACascDauExp0Slope.push_back( lCascadeResult->GetCutVarDCACascDauExp0Slope() );
+            fVarDCACascDauExp1Const.push_back( lCascadeResult->GetCutVarDCACascDauExp1Const() );
+            fVarDCACascDauExp1Slope.push_back( lCascadeResult->GetCutVarDCACascDauExp1Slope() );
+            fVarDCACascDauConst.push_back( lCascadeResult->GetCutVarDCACascDauConst() );
+            fCascCosPA.push_back( lCascadeResult->GetCutCascCosPA() );
+            fUseVarCascCosPA.push_back( lCascadeResult->GetCutUseVarCascCosPA() );
+            fVarCascCosPAExp0Const.push_back( lCascadeResult->GetCutVarCascCosPAExp0Const() );
+            fVarCascCosPAExp0Slope.push_back( lCascadeResult->GetCutVarCascCosPAExp0Slope() );
+            fVarCascCosPAExp1Const.push_back( lCascadeResult->GetCutVarCascCosPAExp1Const() );
+            fVarCascCosPAExp1Slope.push_back( lCascadeResult->GetCutVarCascCosPAExp1Slope() );
+            fVarCascCosPAConst.push_back( lCascadeResult->GetCutVarCascCosPAConst() );
+            fCascRadius.push_back( lCascadeResult->GetCutCascRadius() );
+            fProperLifetime.push_back( lCascadeResult->GetCutProperLifetime() );
+            fLeastNumberOfClusters.push_back( lCascadeResult->GetCutLeastNumberOfClusters() );
+            fTPCdEdx.push_back( lCascadeResult->GetCutTPCdEdx() );
+            fUseTOFUnchecked.push_back( lCascadeResult->GetCutUseTOFUnchecked() );
+            fXiRejection.push_back( lCascadeResult->GetCutXiRejection() );
+            fDCABachToBaryon.push_back( lCascadeResult->GetCutDCABachToBaryon() );
+            fBachBaryonCosPA.push_back( lCascadeResult->GetCutBachBaryonCosPA() );
+            fUseVarBBCosPA.push_back( lCascadeResult->GetCutUseVarBBCosPA() );
+            fVarBBCosPAExp0Const.push_back( lCascadeResult->GetCutVarBBCosPAExp0Const() );
+            fVarBBCosPAExp0Slope.push_back( lCascadeResult->GetCutVarBBCosPAExp0Slope() );
+            fVarBBCosPAExp1Const.push_back( lCascadeResult->GetCutVarBBCosPAExp1Const() );
+            fVarBBCosPAExp1Slope.push_back( lCascadeResult->GetCutVarBBCosPAExp1Slope() );
+            fVarBBCosPAConst.push_back( lCascadeResult->GetCutVarBBCosPAConst() );
+            fMinV0Lifetime.push_back( lCascadeResult->GetCutMinV0Lifetime() );
+            fMaxV0Lifetime.push_back( lCascadeResult->GetCutMaxV0Lifetime() );
+            fUseITSRefitTracks.push_back( lCascadeResult->GetCutUseITSRefitTracks() );
+            fMaxChi2PerCluster.push_back( lCascadeResult->GetCutMaxChi2PerCluster() );
+            fMinTrackLength.push_back( lCascadeResult->GetCutMinTrackLength() );
+            fUseParametricLength.push_back( lCascadeResult->GetCutUseParametricLength() );
+            fUse276TeVV0CosPA.push_back( lCascadeResult->GetCutUse276TeVV0CosPA() );
+            fDCACascadeToPV.push_back( lCascadeResult->GetCutDCACascadeToPV() );
+            fAtLeastOneTOF.push_back( lCascadeResult->GetCutAtLeastOneTOF() );
+            fUseITSRefitNegative.push_back( lCascadeResult->GetCutUseITSRefitNegative() );
+            fUseITSRefitPositive.push_back( lCascadeResult->GetCutUseITSRefitPositive() );
+            fUseITSRefitBachelor.push_back( lCascadeResult->GetCutUseITSRefitBachelor() );
+            fIsCowboy.push_back( lCascadeResult->GetCutIsCowboy() );
+            fIsCascadeCowboy.push_back( lCascadeResult->GetCutIsCascadeCowboy() );
+            fMinCrossedRowsOverLength.push_back( lCascadeResult->GetCutMinCrossedRowsOverLength() );
+            fLeastNumberOfCrossedRows.push_back( lCascadeResult->GetCutLeastNumberOfCrossedRows() );
+            fITSorTOF.push_back( lCascadeResult->GetCutITSorTOF() );
+            fN++;
+        }
+    }
+    fV0CosPACut.resize(fN);
+    fCascCosPACut.resize(fN);
+    fBBCosPACut.resize(fN);
+    fDCACascDauCut.resize(fN);
+    fPass.resize(fN);
+}
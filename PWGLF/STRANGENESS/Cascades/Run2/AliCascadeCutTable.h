@@ -0,0 +1,109 @@
+#ifndef AliCascadeCutTable_H
+#define AliCascadeCutTable_H
+#include <Rtypes.h>
+#include <vector>
+
+class TList;
+class TH3F;
+class AliCascadeResult;
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Columnar copy of the selections of a set of AliCascadeResult objects
+//
+// Same as AliV0CutTable, for cascades: one array per cut variable,
+// indexed by configuration, compiled once from the output lists of the
+// analysis task and read in its candidate loop.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliCascadeCutTable {
+
+public:
+    AliCascadeCutTable();
+    virtual ~AliCascadeCutTable() {}
+
+    //Fill the columns from the configurations in the lists (in this order)
+    void Compile(TList *lListXiMinus, TList *lListXiPlus, TList *lListOmegaMinus, TList *lListOmegaPlus);
+    void Reset();
+    Int_t GetN() const { return fN; }
+
+    //Columns: read directly in the candidate loop of the task
+    Int_t fN; //number of configurations
+    std::vector<Int_t>             fMassHypo;                             //AliCascadeResult::EMassHypo
+    std::vector<TH3F*>             fHistogram;                            //output histogram (owned by the AliCascadeResult)
+    std::vector<AliCascadeResult*> fResult;                               //the configuration itself
+    std::vector<Int_t>             fCharge;                               //expected cascade charge (bachelor charge swap included)
+    std::vector<Double_t>          fMinEtaTracks;
+    std::vector<Double_t>          fMaxEtaTracks;
+    std::vector<Double_t>          fMinRapidity;
+    std::vector<Double_t>          fMaxRapidity;
+    std::vector<Double_t>          fDCANegToPV;
+    std::vector<Double_t>          fDCAPosToPV;
+    std::vector<Double_t>          fDCAV0Daughters;
+    std::vector<Float_t>           fV0CosPA;
+    std::vector<UChar_t>           fUseVarV0CosPA;
+    std::vector<Float_t>           fVarV0CosPAExp0Const;
+    std::vector<Float_t>           fVarV0CosPAExp0Slope;
+    std::vector<Float_t>           fVarV0CosPAExp1Const;
+    std::vector<Float_t>           fVarV0CosPAExp1Slope;
+    std::vector<Float_t>           fVarV0CosPAConst;
+    std::vector<Double_t>          fV0Radius;
+    std::vector<Double_t>          fDCAV0ToPV;
+    std::vector<Double_t>          fV0Mass;
+    std::vector<Double_t>          fV0MassSigma;
+    std::vector<Double_t>          fDCABachToPV;
+    std::vector<Float_t>           fDCACascDaughters;
+    std::vector<UChar_t>           fUseVarDCACascDau;
+    std::vector<Float_t>           fVarDCACascDauExp0Const;
+    std::vector<Float_t>           fVarDCACascDauExp0Slope;
+    std::vector<Float_t>           fVarDCACascDauExp1Const;
+    std::vector<Float_t>           fVarDCACascDauExp1Slope;
+    std::vector<Float_t>           fVarDCACascDauConst;
+    std::vector<Float_t>           fCascCosPA;
+    std::vector<UChar_t>           fUseVarCascCosPA;
+    std::vector<Float_t>           fVarCascCosPAExp0Const;
+    std::vector<Float_t>           fVarCascCosPAExp0Slope;
+    std::vector<Float_t>           fVarCascCosPAExp1Const;
+    std::vector<Float_t>           fVarCascCosPAExp1Slope;
+    std::vector<Float_t>           fVarCascCosPAConst;
+    std::vector<Double_t>          fCascRadius;
+    std::vector<Double_t>          fProperLifetime;
+    std::vector<Double_t>          fLeastNumberOfClusters;
+    std::vector<Double_t>          fTPCdEdx;
+    std::vector<UChar_t>           fUseTOFUnchecked;
+    std::vector<Double_t>          fXiRejection;
+    std::vector<Double_t>          fDCABachToBaryon;
+    std::vector<Float_t>           fBachBaryonCosPA;
+    std::vector<UChar_t>           fUseVarBBCosPA;
+    std::vector<Float_t>           fVarBBCosPAExp0Const;
+    std::vector<Float_t>           fVarBBCosPAExp0Slope;
+    std::vector<Float_t>           fVarBBCosPAExp1Const;
+    std::vector<Float_t>           fVarBBCosPAExp1Slope;
+    std::vector<Float_t>           fVarBBCosPAConst;
+    std::vector<Double_t>          fMinV0Lifetime;
+    std::vector<Double_t>          fMaxV0Lifetime;
+    std::vector<UChar_t>           fUseITSRefitTracks;
+    std::vector<Double_t>          fMaxChi2PerCluster;
+    std::vector<Double_t>          fMinTrackLength;
+    std::vector<UChar_t>           fUseParametricLength;
+    std::vector<UChar_t>           fUse276TeVV0CosPA;
+    std::vector<Double_t>          fDCACascadeToPV;
+    std::vector<UChar_t>           fAtLeastOneTOF;
+    std::vector<UChar_t>           fUseITSRefitNegative;
+    std::vector<UChar_t>           fUseITSRefitPositive;
+    std::vector<UChar_t>           fUseITSRefitBachelor;
+    std::vector<Int_t>             fIsCowboy;
+    std::vector<Int_t>             fIsCascadeCowboy;
+    std::vector<Double_t>          fMinCrossedRowsOverLength;
+    std::vector<Double_t>          fLeastNumberOfCrossedRows;
+    std::vector<UChar_t>           fITSorTOF;
+
+    //Working arrays, per candidate
+    std::vector<Float_t>           fV0CosPACut;                           //V0 CosPA cut including the variable part
+    std::vector<Float_t>           fCascCosPACut;                         //cascade CosPA cut including the variable part
+    std::vector<Float_t>           fBBCosPACut;                           //bachelor-baryon CosPA cut including the variable part
+    std::vector<Float_t>           fDCACascDauCut;                        //DCA cascade daughters cut including the variable part
+    std::vector<UChar_t>           fPass;                                 //1 if the candidate passes the configuration
+
+    ClassDef(AliCascadeCutTable, 1)
+};
+#endif
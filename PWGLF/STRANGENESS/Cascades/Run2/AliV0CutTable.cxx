@@ -0,0 +1,110 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Columnar copy of the selections of a set of AliV0Result objects
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include "TList.h"
+#include "TH3F.h"
+#include "AliV0Result.h"
+#include "AliV0CutTable.h"
+
+ClassImp(AliV0CutTable);
+//________________________________________________________________
+AliV0CutTable::AliV0CutTable() :
+fN(0)
+{
+    // Empty table, filled by Compile
+}
+//________________________________________________________________
+void AliV0CutTable::Reset()
+{
+    fN = 0;
+    fMassHypo.clear();
+    fHistogram.clear();
+    fUseOnTheFly.clear();
+    fMinEtaTracks.clear();
+    fMaxEtaTracks.clear();
+    fMinRapidity.clear();
+    fMaxRapidity.clear();
+    fV0Radius.clear();
+    fMaxV0Radius.clear();
+    fDCANegToPV.clear();
+    fDCAPosToPV.clear();
+    fDCAV0Daughters.clear();
+    fV0CosPA.clear();
+    fUseVarV0CosPA.clear();
+    fVarV0CosPAExp0Const.clear();
+    fVarV0CosPAExp0Slope.clear();
+    fVarV0CosPAExp1Const.clear();
+    fVarV0CosPAExp1Slope.clear();
+    fVarV0CosPAConst.clear();
+    fProperLifetime.clear();
+    fLeastNumberOfCrossedRows.clear();
+    fLeastNumberOfCrossedRowsOverFindable.clear();
+    fMinBaryonMomentum.clear();
+    fTPCdEdx.clear();
+    fArmenteros.clear();
+    fArmenterosParameter.clear();
+    fUseITSRefitTracks.clear();
+    fMaxChi2PerCluster.clear();
+    fMinTrackLength.clear();
+    fUseParametricLength.clear();
+    f276TeVLikedEdx.clear();
+    fAtLeastOneTOF.clear();
+    fIsCowboy.clear();
+    fMinCrossedRowsOverLength.clear();
+    fITSorTOF.clear();
+    fV0CosPACut.clear();
+    fPass.clear();
+}
+//________________________________________________________________
+void AliV0CutTable::Compile(TList *lListK0Short, TList *lListLambda, TList *lListAntiLambda)
+{
+    //Configurations are stored in the order of the lists, which is the
+    //order in which the task used to loop over them
+    Reset();
+    TList *lLists[3] = {lListK0Short, lListLambda, lListAntiLambda};
+    for(Int_t ilist=0; ilist<3; ilist++){
+        if( !lLists[ilist] ) continue;
+        for(Int_t icfg=0; icfg<lLists[ilist]->GetEntries(); icfg++){
+            AliV0Result *lV0Result = (AliV0Result*) lLists[ilist]->At(icfg);
+            fMassHypo.push_back( lV0Result->GetMassHypothesis() );
+            fHistogram.push_back( lV0Result->GetHistogram() );
+            fUseOnTheFly.push_back( lV0Result->GetUseOnTheFly() );
+            fMinEtaTracks.push_back( lV0Result->GetCutMinEtaTracks() );
+            fMaxEtaTracks.push_back( lV0Result->GetCutMaxEtaTracks() );
+            fMinRapidity.push_back( lV0Result->GetCutMinRapidity() );
+            fMaxRapidity.push_back( lV0Result->GetCutMaxRapidity() );
+            fV0Radius.push_back( lV0Result->GetCutV0Radius() );
+            fMaxV0Radius.push_back( lV0Result->GetCutMaxV0Radius() );
+            fDCANegToPV.push_back( lV0Result->GetCutDCANegToPV() );
+            fDCAPosToPV.push_back( lV0Result->GetCutDCAPosToPV() );
+            fDCAV0Daughters.push_back( lV0Result->GetCutDCAV0Daughters() );
+            fV0CosPA.push_back( lV0Result->GetCutV0CosPA() );
+            fUseVarV0CosPA.push_back( lV0Result->GetCutUseVarV0CosPA() );
+            fVarV0CosPAExp0Const.push_back( lV0Result->GetCutVarV0CosPAExp0Const() );
+            fVarV0CosPAExp0Slope.push_back( lV0Result->GetCutVarV0CosPAExp0Slope() );
+            fVarV0CosPAExp1Const.push_back( lV0Result->GetCutVarV0CosPAExp1Const() );
+            fVarV0CosPAExp1Slope.push_back( lV0Result->GetCutVarV0CosPAExp1Slope() );
+            fVarV0CosPAConst.push_back( lV0Result->GetCutVarV0CosPAConst() );
+            fProperLifetime.push_back( lV0Result->GetCutProperLifetime() );
+            fLeastNumberOfCrossedRows.push_back( lV0Result->GetCutLeastNumberOfCrossedRows() );
+            fLeastNumberOfCrossedRowsOverFindable.push_back( lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() );
+            fMinBaryonMomentum.push_back( lV0Result->GetCutMinBaryonMomentum() );
+            fTPCdEdx.push_back( lV0Result->GetCutTPCdEdx() );
+            fArmenteros.push_back( lV0Result->GetCutArmenteros() );
+            fArmenterosParameter.push_back( lV0Result->GetCutArmenterosParameter() );
+            fUseITSRefitTracks.push_back( lV0Result->GetCutUseITSRefitTracks() );
+            fMaxChi2PerCluster.push_back( lV0Result->GetCutMaxChi2PerCluster() );
+            fMinTrackLength.push_back( lV0Result->GetCutMinTrackLength() );
+            fUseParametricLength.push_back( lV0Result->GetCutUseParametricLength() );
+            f276TeVLikedEdx.push_back( lV0Result->GetCut276TeVLikedEdx() );
+            fAtLeastOneTOF.push_back( lV0Result->GetCutAtLeastOneTOF() );
+            fIsCowboy.push_back( lV0Result->GetCutIsCowboy() );
+            fMinCrossedRowsOverLength.push_back( lV0Result->GetCutMinCrossedRowsOverLength() );
+            fITSorTOF.push_back( lV0Result->GetCutITSorTOF() );
+            fN++;
+        }
+    }
+    fV0CosPACut.resize(fN);
+    fPass.resize(fN);
+}
@@ -0,0 +1,75 @@
+#ifndef AliV0CutTable_H
+#define AliV0CutTable_H
+#include <Rtypes.h>
+#include <vector>
+
+class TList;
+class TH3F;
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Columnar copy of the selections of a set of AliV0Result objects
+//
+// One array per cut variable, indexed by configuration, compiled once
+// from the output lists of the analysis task. Each candidate is then
+// checked against all configurations in plain loops over these arrays
+// (filling fPass) instead of a chain of getter calls per configuration.
+// Cut values keep the type with which they are compared in the task,
+// so that the selection is unchanged.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliV0CutTable {
+
+public:
+    AliV0CutTable();
+    virtual ~AliV0CutTable() {}
+
+    //Fill the columns from the configurations in the lists (in this order)
+    void Compile(TList *lListK0Short, TList *lListLambda, TList *lListAntiLambda);
+    void Reset();
+    Int_t GetN() const { return fN; }
+
+    //Columns: read directly in the candidate loop of the task
+    Int_t fN; //number of configurations
+    std::vector<Int_t>    fMassHypo;                //AliV0Result::EMassHypo
+    std::vector<TH3F*>    fHistogram;               //output histogram (owned by the AliV0Result)
+    std::vector<Int_t>    fUseOnTheFly;
+    std::vector<Double_t> fMinEtaTracks;
+    std::vector<Double_t> fMaxEtaTracks;
+    std::vector<Double_t> fMinRapidity;
+    std::vector<Double_t> fMaxRapidity;
+    std::vector<Double_t> fV0Radius;
+    std::vector<Double_t> fMaxV0Radius;
+    std::vector<Double_t> fDCANegToPV;
+    std::vector<Double_t> fDCAPosToPV;
+    std::vector<Double_t> fDCAV0Daughters;
+    std::vector<Float_t>  fV0CosPA;
+    std::vector<UChar_t>  fUseVarV0CosPA;
+    std::vector<Float_t>  fVarV0CosPAExp0Const;
+    std::vector<Float_t>  fVarV0CosPAExp0Slope;
+    std::vector<Float_t>  fVarV0CosPAExp1Const;
+    std::vector<Float_t>  fVarV0CosPAExp1Slope;
+    std::vector<Float_t>  fVarV0CosPAConst;
+    std::vector<Double_t> fProperLifetime;
+    std::vector<Double_t> fLeastNumberOfCrossedRows;
+    std::vector<Double_t> fLeastNumberOfCrossedRowsOverFindable;
+    std::vector<Double_t> fMinBaryonMomentum;
+    std::vector<Double_t> fTPCdEdx;
+    std::vector<UChar_t>  fArmenteros;
+    std::vector<Double_t> fArmenterosParameter;
+    std::vector<UChar_t>  fUseITSRefitTracks;
+    std::vector<Double_t> fMaxChi2PerCluster;
+    std::vector<Double_t> fMinTrackLength;
+    std::vector<UChar_t>  fUseParametricLength;
+    std::vector<UChar_t>  f276TeVLikedEdx;
+    std::vector<UChar_t>  fAtLeastOneTOF;
+    std::vector<Int_t>    fIsCowboy;
+    std::vector<Double_t> fMinCrossedRowsOverLength;
+    std::vector<UChar_t>  fITSorTOF;
+
+    //Working arrays, per candidate
+    std::vector<Float_t>  fV0CosPACut;              //V0 CosPA cut including the variable part
+    std::vector<UChar_t>  fPass;                    //1 if the candidate passes the configuration
+
+    ClassDef(AliV0CutTable, 1)
+};
+#endif
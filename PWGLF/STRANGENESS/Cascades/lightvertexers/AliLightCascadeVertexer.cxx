@@ -137,9 +137,10 @@ Int_t AliLightCascadeVertexer::V0sTracks2CascadeVertices(AliESDEvent *event) {
    }
    nV0=vtcs.GetEntriesFast();
 
-   // stores relevant tracks in another array
+   // stores relevant tracks in other arrays, by charge
    Int_t nentr=(Int_t)event->GetNumberOfTracks();
-   TArrayI trk(nentr); Int_t ntr=0;
+   TArrayI trkNotPos(nentr); Int_t ntrNotPos=0; //bachelor candidates for cascades
+   TArrayI trkNotNeg(nentr); Int_t ntrNotNeg=0; //bachelor candidates for anti-cascades
    for (i=0; i<nentr; i++) {
        AliESDtrack *esdtr=event->GetTrack(i);
        ULong_t status=esdtr->GetStatus();
@@ -152,9 +153,21 @@ Int_t AliLightCascadeVertexer::V0sTracks2CascadeVertices(AliESDEvent *event) {
 
        if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fDBachMin) continue;
 
-       trk[ntr++]=i;
+       //Track pre-selection: eta. The bachelor is only propagated (without
+       //material) to the DCA, which leaves its dip angle unchanged: this is
+       //the eta cut applied after PropagateToDCA, done once per track
+       if (TMath::Abs(esdtr->AliExternalTrackParam::Eta())>fMaxEta) continue;
+
+       if (!(esdtr->GetSign()>0)) trkNotPos[ntrNotPos++]=i;
+       if (!(esdtr->GetSign()<0)) trkNotNeg[ntrNotNeg++]=i;
    }   
 
+   //bachelor's charge: negative (switched: positive) for cascades, the opposite for anti-cascades
+   const TArrayI &trkCasc     = fSwitchCharges ? trkNotNeg : trkNotPos;
+   const TArrayI &trkAntiCasc = fSwitchCharges ? trkNotPos : trkNotNeg;
+   const Int_t ntrCasc     = fSwitchCharges ? ntrNotNeg : ntrNotPos;
+   const Int_t ntrAntiCasc = fSwitchCharges ? ntrNotPos : ntrNotNeg;
+
    Double_t massLambda=1.11568;
    Int_t ncasc=0;
 
@@ -167,25 +180,23 @@ Int_t AliLightCascadeVertexer::V0sTracks2CascadeVertices(AliESDEvent *event) {
       v0.ChangeMassHypothesis(kLambda0); // the v0 must be Lambda 
       if (TMath::Abs(v0.GetEffMass()-massLambda)>fMassWin) continue; 
 
-      for (Int_t j=0; j<ntr; j++) {//loop on tracks
-	 Int_t bidx=trk[j];
+      for (Int_t j=0; j<ntrCasc; j++) {//loop on tracks
+	 Int_t bidx=trkCasc[j];
  	 //Bo:   if (bidx==v->GetNindex()) continue; //bachelor and v0's negative tracks must be different
           if (!fSwitchCharges && bidx==v0.GetIndex(0)) continue; //Bo:  consistency 0 for neg
           if ( fSwitchCharges && bidx==v0.GetIndex(1)) continue; //Bo:  consistency 0 for neg
           
           AliESDtrack *btrk=event->GetTrack(bidx);
           
-         if (!fSwitchCharges && btrk->GetSign()>0) continue;  // bachelor's charge
-         if ( fSwitchCharges && btrk->GetSign()<0) continue;  // bachelor's charge
+         //bachelor's charge: see track pre-selection
           
     	 AliESDv0 *pv0=&v0;
          AliExternalTrackParam bt(*btrk), *pbt=&bt;
 
-         Double_t dca=PropagateToDCA(pv0,pbt,b);
+         Double_t dca=PropagateToDCA(pv0,pbt,b,fDCAmax);
          if (dca > fDCAmax) continue;
           
-          //eta cut - test
-            if (TMath::Abs(pbt->Eta())>fMaxEta) continue;
+          //eta cut - test: see track pre-selection
 
          AliESDcascade cascade(*pv0,*pbt,bidx);//constucts a cascade candidate
 	 //PH        if (cascade.GetChi2Xi() > fChi2max) continue;
@@ -218,25 +229,23 @@ Int_t AliLightCascadeVertexer::V0sTracks2CascadeVertices(AliESDEvent *event) {
       v0.ChangeMassHypothesis(kLambda0Bar); //the v0 must be anti-Lambda 
       if (TMath::Abs(v0.GetEffMass()-massLambda)>fMassWin) continue; 
 
-      for (Int_t j=0; j<ntr; j++) {//loop on tracks
-	 Int_t bidx=trk[j];
+      for (Int_t j=0; j<ntrAntiCasc; j++) {//loop on tracks
+	 Int_t bidx=trkAntiCasc[j];
  	 //Bo:   if (bidx==v->GetPindex()) continue; //bachelor and v0's positive tracks must be different
          if (!fSwitchCharges && bidx==v0.GetIndex(1)) continue; //Bo:  consistency 1 for pos
          if ( fSwitchCharges && bidx==v0.GetIndex(0)) continue; //Bo:  consistency 1 for pos
           
           AliESDtrack *btrk=event->GetTrack(bidx);
           
-         if (!fSwitchCharges && btrk->GetSign()<0) continue;  // bachelor's charge
-         if ( fSwitchCharges && btrk->GetSign()>0) continue;  // bachelor's charge
+         //bachelor's charge: see track pre-selection
           
 	 AliESDv0 *pv0=&v0;
          AliExternalTrackParam bt(*btrk), *pbt=&bt;
 
-         Double_t dca=PropagateToDCA(pv0,pbt,b);
+         Double_t dca=PropagateToDCA(pv0,pbt,b,fDCAmax);
          if (dca > fDCAmax) continue;
 
-          //eta cut - test
-          if (TMath::Abs(pbt->Eta())>fMaxEta) continue;
+          //eta cut - test: see track pre-selection
           
          AliESDcascade cascade(*pv0,*pbt,bidx); //constucts a cascade candidate
 	 //PH         if (cascade.GetChi2Xi() > fChi2max) continue;
@@ -284,9 +293,10 @@ Double_t AliLightCascadeVertexer::Det(Double_t a00,Double_t a01,Double_t a02,
   return  a00*Det(a11,a12,a21,a22)-a01*Det(a10,a12,a20,a22)+a02*Det(a10,a11,a20,a21);
 }
 
-Double_t AliLightCascadeVertexer::PropagateToDCA(AliESDv0 *v, AliExternalTrackParam *t, Double_t b) {
+Double_t AliLightCascadeVertexer::PropagateToDCA(AliESDv0 *v, AliExternalTrackParam *t, Double_t b, Double_t dcamax) {
   //--------------------------------------------------------------------
   // This function returns the DCA between the V0 and the track
+  // The track is not propagated if the DCA is above dcamax (if positive)
   //--------------------------------------------------------------------
   Double_t alpha=t->GetAlpha(), cs1=TMath::Cos(alpha), sn1=TMath::Sin(alpha);
   Double_t r[3]; t->GetXYZ(r);
@@ -308,6 +318,7 @@ Double_t AliLightCascadeVertexer::PropagateToDCA(AliESDv0 *v, AliExternalTrackPa
   Double_t az= Det(px1,py1,px2,py2);
 
   Double_t dca=TMath::Abs(dd)/TMath::Sqrt(ax*ax + ay*ay + az*az);
+  if (dcamax > 0 && dca > dcamax) return dca; //rejected anyway, skip the propagation
 
 //points of the DCA
   Double_t t1 = Det(x2-x1,y2-y1,z2-z1,px2,py2,pz2,ax,ay,az)/
@@ -27,6 +27,7 @@
 
 #include "AliESDEvent.h"
 #include "AliESDv0.h"
+#include "TArrayC.h"
 #include "AliLightV0vertexer.h"
 
 ClassImp(AliLightV0vertexer)
@@ -62,6 +63,7 @@ Int_t AliLightV0vertexer::Tracks2V0vertices(AliESDEvent *event) {
     
     TArrayI neg(nentr);
     TArrayI pos(nentr);
+    TArrayC lowd(nentr); //tracks with an impact parameter below fDNmin
     
     Int_t nneg=0, npos=0, nvtx=0;
     
@@ -80,6 +82,14 @@ Int_t AliLightV0vertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (TMath::Abs(d)<fDPmin) continue;
         if (TMath::Abs(d)>fRmax) continue;
         
+        //Track pre-selection: eta. The daughters are only propagated (without
+        //material) to the V0 vertex, which leaves their dip angle unchanged:
+        //this is the eta cut applied after propagation, done once per track
+        //instead of after the DCA minimization of each pair
+        if (TMath::Abs(esdTrack->AliExternalTrackParam::Eta())>fMaxEta) continue;
+        
+        lowd[i]=(TMath::Abs(d)<fDNmin);
+        
         if (esdTrack->GetSign() < 0.) neg[nneg++]=i;
         else pos[npos++]=i;
     }
@@ -91,13 +101,11 @@ Int_t AliLightV0vertexer::Tracks2V0vertices(AliESDEvent *event) {
         
         for (Int_t k=0; k<npos; k++) {
             Int_t pidx=pos[k];
-            AliESDtrack *ptrk=event->GetTrack(pidx);
             
-            //Track pre-selection: clusters
-            if (ptrk->GetTPCNcls() < fMinClusters ) continue;
+            //Impact parameters from the track pre-selection
+            if (lowd[nidx] && lowd[pidx]) continue;
             
-            if (TMath::Abs(ntrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fDNmin)
-                if (TMath::Abs(ptrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fDNmin) continue;
+            AliESDtrack *ptrk=event->GetTrack(pidx);
             
             Double_t xn, xp, dca=ntrk->GetDCA(ptrk,b,xn,xp);
             if (dca > fDCAmax) continue;
@@ -123,9 +131,7 @@ Int_t AliLightV0vertexer::Tracks2V0vertices(AliESDEvent *event) {
             
             nt.PropagateTo(xn,b); pt.PropagateTo(xp,b);
             
-            //select maximum eta range (after propagation)
-            if (TMath::Abs(nt.Eta())>fMaxEta) continue;
-            if (TMath::Abs(pt.Eta())>fMaxEta) continue;
+            //maximum eta range (after propagation): see track pre-selection
             
             AliESDv0 vertex(nt,nidx,pt,pidx);
             
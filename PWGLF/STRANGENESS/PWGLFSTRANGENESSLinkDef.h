@@ -50,6 +50,8 @@
 #pragma link C++ class AliVWeakResult+;
 #pragma link C++ class AliV0Result+;
 #pragma link C++ class AliCascadeResult+;
+#pragma link C++ class AliV0CutTable+;
+#pragma link C++ class AliCascadeCutTable+;
 #pragma link C++ class AliStrangenessModule+;
 #pragma link C++ class AliAnalysisTaskWeakDecayVertexer+;
 #pragma link C++ class AliAnalysisTaskStrEffStudy+;
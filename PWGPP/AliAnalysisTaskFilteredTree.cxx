@@ -47,6 +47,7 @@
 #include "TCanvas.h"
 #include "TList.h"
 #include "TObjArray.h"
+#include "TParameter.h"
 #include "TFile.h"
 #include "TMatrixD.h"
 #include "TRandom3.h"
@@ -79,6 +80,7 @@
 #include "AliMCEventHandler.h"
 #include "AliFilteredTreeEventCuts.h"
 #include "AliFilteredTreeAcceptanceCuts.h"
+#include "AliFilteredTreeSchema.h"
 
 #include "AliAnalysisTaskFilteredTree.h"
 #include "AliKFParticle.h"
@@ -92,6 +94,36 @@ using namespace std;
 
 ClassImp(AliAnalysisTaskFilteredTree)
 
+namespace {
+  //_____________________________________________________________________________
+  void DeclareEventColumns(AliFilteredTreeSchema &schema)
+  {
+    // event identification columns common to all the schema output trees
+    schema.AddColumn("gid",'l');
+    schema.AddString("fileName");
+    schema.AddColumn("runNumber",'I');
+    schema.AddColumn("evtTimeStamp",'I');
+    schema.AddColumn("timeStamp",'D');
+    schema.AddColumn("evtNumberInFile",'I');
+    schema.AddString("triggerClass",1024);
+    schema.AddColumn("Bz",'F');
+  }
+
+  //_____________________________________________________________________________
+  void SetEventColumns(AliFilteredTreeSchema &schema, ULong64_t gid, const TObjString &fileName, Int_t runNumber, Int_t evtTimeStamp,
+                       Double_t timeStamp, Int_t evtNumberInFile, const TObjString &triggerClass, Double_t bz)
+  {
+    schema.SetInteger("gid",gid);
+    schema.SetString("fileName",fileName.GetString().Data());
+    schema.SetInteger("runNumber",runNumber);
+    schema.SetInteger("evtTimeStamp",evtTimeStamp);
+    schema.SetValue("timeStamp",timeStamp);
+    schema.SetInteger("evtNumberInFile",evtNumberInFile);
+    schema.SetString("triggerClass",triggerClass.GetString().Data());
+    schema.SetValue("Bz",bz);
+  }
+}
+
   //_____________________________________________________________________________
   AliAnalysisTaskFilteredTree::AliAnalysisTaskFilteredTree(const char *name) 
   : AliAnalysisTaskSE(name)
@@ -112,6 +144,22 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fTrigger(AliTriggerAnalysis::kMB1) 
   , fAnalysisMode(kTPCAnalysisMode) 
   , fTreeSRedirector(0)
+  , fSchemaOutput(kFALSE)
+  , fStreamTrackObjects(kTRUE)
+  , fSchemaCompression(-1)
+  , fSchemaBasketSize(256000)
+  , fSchemaColumnCompression(0)
+  , fSchemaColumnBasketSize(0)
+  , fSchemaColumnType(0)
+  , fHighPtSchema(0)
+  , fV0Schema(0)
+  , fdEdxSchema(0)
+  , fLaserSchema(0)
+  , fMCEffSchema(0)
+  , fCosmicPairsSchema(0)
+  , fEventInfoTracksSchema(0)
+  , fEventInfoV0Schema(0)
+  , fITSTPCSchema(0)
   , fCentralityEstimator(0)
   , fLowPtTrackDownscaligF(0)
   , fLowPtV0DownscaligF(0)
@@ -165,6 +213,74 @@ AliAnalysisTaskFilteredTree::~AliAnalysisTaskFilteredTree()
   delete fFilteredTreeAcceptanceCuts;
   delete fFilteredTreeRecAcceptanceCuts;
   delete fEsdTrackCuts;
+  delete fSchemaColumnCompression;
+  delete fSchemaColumnBasketSize;
+  delete fSchemaColumnType;
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::SetSchemaColumnCompression(const char *treeName, const char *prefix, Int_t compression)
+{
+  //
+  // Compression settings of the columns of the schema output tree treeName whose names
+  // start with prefix, e.g. ("highPt","paramITS",505); -1 for the tree default.
+  // Applied with AliFilteredTreeSchema::SetColumnCompression when the trees are made.
+  //
+  if (!fSchemaColumnCompression) {
+    fSchemaColumnCompression = new TObjArray;
+    fSchemaColumnCompression->SetOwner();
+  }
+  fSchemaColumnCompression->Add(new TParameter<Int_t>(TString::Format("%s/%s",treeName,prefix),compression));
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::SetSchemaColumnBasketSize(const char *treeName, const char *prefix, Int_t basketSize)
+{
+  //
+  // Basket size of the columns of the schema output tree treeName whose names
+  // start with prefix; 0 for the tree default (see SetSchemaCompression).
+  // Applied with AliFilteredTreeSchema::SetColumnBasketSize when the trees are made.
+  //
+  if (!fSchemaColumnBasketSize) {
+    fSchemaColumnBasketSize = new TObjArray;
+    fSchemaColumnBasketSize->SetOwner();
+  }
+  fSchemaColumnBasketSize->Add(new TParameter<Int_t>(TString::Format("%s/%s",treeName,prefix),basketSize));
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::SetSchemaColumnType(const char *treeName, const char *prefix, Char_t type)
+{
+  //
+  // Precision ('F' or 'D') of the floating point columns of the schema output tree
+  // treeName whose names start with prefix, e.g. ("highPt","extInnerParamRef",'F').
+  // Track parameters and vertices are written in double precision by default.
+  // Applied with AliFilteredTreeSchema::SetColumnType when the trees are made.
+  //
+  if (!fSchemaColumnType) {
+    fSchemaColumnType = new TObjArray;
+    fSchemaColumnType->SetOwner();
+  }
+  fSchemaColumnType->Add(new TParameter<Int_t>(TString::Format("%s/%s",treeName,prefix),type));
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisTaskFilteredTree::GetSchemas(AliFilteredTreeSchema **schemas) const
+{
+  //
+  // Schemas of the output trees (schemas has to hold 9 entries), returns their number.
+  // Entries are NULL before DeclareSchemas and after FinishTaskOutput.
+  //
+  schemas[0]=fHighPtSchema;
+  schemas[1]=fV0Schema;
+  schemas[2]=fdEdxSchema;
+  schemas[3]=fLaserSchema;
+  schemas[4]=fMCEffSchema;
+  schemas[5]=fCosmicPairsSchema;
+  schemas[6]=fEventInfoTracksSchema;
+  schemas[7]=fEventInfoV0Schema;
+  schemas[8]=fITSTPCSchema;
+  return 9;
 }
 
 //____________________________________________________________________________
@@ -208,12 +324,22 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
 
   //
   // Create trees
-  fV0Tree = ((*fTreeSRedirector)<<"V0s").GetTree();
-  fHighPtTree = ((*fTreeSRedirector)<<"highPt").GetTree();
-  fdEdxTree = ((*fTreeSRedirector)<<"dEdx").GetTree();
-  fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
-  fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
-  fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+  if (fSchemaOutput) {
+    DeclareSchemas();
+    fV0Tree = fV0Schema->GetTree();
+    fHighPtTree = fHighPtSchema->GetTree();
+    fdEdxTree = fdEdxSchema->GetTree();
+    fLaserTree = fLaserSchema->GetTree();
+    fMCEffTree = fMCEffSchema->GetTree();
+    fCosmicPairsTree = fCosmicPairsSchema->GetTree();
+  } else {
+    fV0Tree = ((*fTreeSRedirector)<<"V0s").GetTree();
+    fHighPtTree = ((*fTreeSRedirector)<<"highPt").GetTree();
+    fdEdxTree = ((*fTreeSRedirector)<<"dEdx").GetTree();
+    fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
+    fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
+    fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+  }
 
   if (!fDummyTrack)  {
     fDummyTrack=new AliESDtrack();
@@ -317,6 +443,228 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
   PostData(7,fOutput);
 }
 
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::DeclareSchemas()
+{
+  //
+  // Declare the output trees for the schema output (SetSchemaOutput)
+  // Scalar branches keep the names of the TTreeSRedirector output, tracks, vertices
+  // and V0s are written as flat <name>_<member> columns (see AliFilteredTreeSchema).
+  // Whole AliESDtrack and AliESDfriendTrack objects are added only with fStreamTrackObjects.
+  // The trees are made in the current directory (output file of slot 1).
+  //
+  const Int_t nSpecies=AliPID::kSPECIES;
+  fHighPtSchema = new AliFilteredTreeSchema("highPt","highPt");
+  fV0Schema = new AliFilteredTreeSchema("V0s","V0s");
+  fdEdxSchema = new AliFilteredTreeSchema("dEdx","dEdx");
+  fLaserSchema = new AliFilteredTreeSchema("Laser","Laser");
+  fMCEffSchema = new AliFilteredTreeSchema("MCEffTree","MCEffTree");
+  fCosmicPairsSchema = new AliFilteredTreeSchema("CosmicPairs","CosmicPairs");
+  fEventInfoTracksSchema = new AliFilteredTreeSchema("eventInfoTracks","eventInfoTracks");
+  fEventInfoV0Schema = new AliFilteredTreeSchema("eventInfoV0","eventInfoV0");
+  if (fProcessITSTPCmatchOut) fITSTPCSchema = new AliFilteredTreeSchema("itsTPC","itsTPC");
+  AliFilteredTreeSchema *treeSchemas[6]={fHighPtSchema, fV0Schema, fdEdxSchema, fLaserSchema, fMCEffSchema, fCosmicPairsSchema};
+  for (Int_t i=0; i<6; i++) DeclareEventColumns(*treeSchemas[i]);
+  //
+  // highPt - union of the ProcessAll and Process entries
+  AliFilteredTreeSchema &highPt = *fHighPtSchema;
+  highPt.AddColumn("downscaleCounter",'I');
+  highPt.AddColumn("fLowPtTrackDownscaligF",'D');
+  highPt.AddColumn("selectionPtMask",'I');
+  highPt.AddColumn("selectionPIDMask",'I');
+  highPt.AddVertex("vtxESD");
+  highPt.AddColumn("IRtot",'I');
+  highPt.AddColumn("IRint2",'I');
+  highPt.AddColumn("mult",'I');
+  highPt.AddColumn("ntracks",'I');
+  highPt.AddColumn("ntracksESD",'I');
+  highPt.AddColumn("multSPD",'I');
+  highPt.AddColumn("multTPC",'I');
+  highPt.AddColumn("contTPC",'I');
+  highPt.AddColumn("contSPD",'I');
+  highPt.AddColumn("vertexPosTPC",'F',3);
+  highPt.AddColumn("vertexPosSPD",'F',3);
+  highPt.AddColumn("ntracksTPC",'I');
+  highPt.AddColumn("ntracksITS",'I');
+  highPt.AddESDtrack("esdTrack",fStreamTrackObjects);
+  highPt.AddColumn("tofClInfo",'F',5);
+  highPt.AddColumn("tofNsigma",'F',nSpecies);
+  highPt.AddColumn("tpcNsigma",'F',nSpecies);
+  highPt.AddColumn("tofPID",'F',nSpecies);
+  highPt.AddColumn("tpcPID",'F',nSpecies);
+  if (fStreamTrackObjects) highPt.AddObject("friendTrack","AliESDfriendTrack");
+  highPt.AddTrackParam("extTPCInnerC");
+  highPt.AddTrackParam("extInnerParamV");
+  highPt.AddTrackParam("extInnerParamC");
+  highPt.AddTrackParam("extInnerParam");
+  highPt.AddTrackParam("extOuterITS");
+  highPt.AddTrackParam("extInnerParamRef");
+  highPt.AddColumn("chi2TPCInnerC",'F');
+  highPt.AddColumn("chi2InnerC",'F');
+  highPt.AddColumn("chi2OuterITS",'F');
+  highPt.AddColumn("centralityF",'F');
+  highPt.AddTrackParam("paramITS");
+  highPt.AddTrackParam("paramITSC");
+  highPt.AddTrackParam("paramComb");
+  highPt.AddColumn("indexNearestITS",'I');
+  highPt.AddColumn("indexNearestITSC",'I');
+  highPt.AddColumn("indexNearestComb",'I');
+  // the MC columns are filled whenever the MC event is available, as in the TTreeSRedirector output
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (fUseMCInfo || (mgr && mgr->GetMCtruthEventHandler())) {
+    const char *refs[7]={"refTPCIn","refTPCOut","refITS","refTRD","refTOF","refEMCAL","refPHOS"};
+    const char *nrefs[6]={"nrefITS","nrefTPC","nrefTRD","nrefTOF","nrefEMCAL","nrefPHOS"};
+    highPt.AddColumn("multMCTrueTracks",'I');
+    for (Int_t i=0; i<6; i++) highPt.AddColumn(nrefs[i],'I');
+    for (Int_t i=0; i<7; i++) highPt.AddObject(refs[i],"AliTrackReference");
+    const char *suffix[3]={"","TPC","ITS"};
+    for (Int_t i=0; i<3; i++) {
+      highPt.AddObject(TString::Format("particle%s",suffix[i]),"TParticle");
+      highPt.AddObject(TString::Format("particleMother%s",suffix[i]),"TParticle");
+      highPt.AddColumn(TString::Format("mech%s",suffix[i]),'I');
+      highPt.AddColumn(TString::Format("isPrim%s",suffix[i]),'b');
+      highPt.AddColumn(TString::Format("isFromStrangess%s",suffix[i]),'b');
+      highPt.AddColumn(TString::Format("isFromConversion%s",suffix[i]),'b');
+      highPt.AddColumn(TString::Format("isFromMaterial%s",suffix[i]),'b');
+    }
+  }
+  //
+  // V0s
+  AliFilteredTreeSchema &v0s = *fV0Schema;
+  v0s.AddColumn("fLowPtV0DownscaligF",'D');
+  v0s.AddColumn("selectionPtMask",'I');
+  v0s.AddColumn("downscaleCounter",'I');
+  v0s.AddColumn("type",'I');
+  v0s.AddColumn("ntracks",'I');
+  v0s.AddV0("v0");
+  v0s.AddObject("v0","AliESDv0");
+  v0s.AddObject("kf","AliKFParticle");
+  for (Int_t i=0; i<2; i++) {
+    v0s.AddESDtrack(TString::Format("track%d",i),fStreamTrackObjects);
+    v0s.AddColumn(TString::Format("tofClInfo%d",i),'F',5);
+    v0s.AddColumn(TString::Format("tofNsigma%d",i),'F',nSpecies);
+    v0s.AddColumn(TString::Format("tpcNsigma%d",i),'F',nSpecies);
+    if (fStreamTrackObjects) v0s.AddObject(TString::Format("friendTrack%d",i),"AliESDfriendTrack");
+  }
+  v0s.AddColumn("centralityF",'F');
+  //
+  // dEdx
+  AliFilteredTreeSchema &dEdx = *fdEdxSchema;
+  dEdx.AddVertex("vtxESD");
+  dEdx.AddColumn("mult",'I');
+  dEdx.AddESDtrack("esdTrack",fStreamTrackObjects);
+  if (fStreamTrackObjects) dEdx.AddObject("friendTrack","AliESDfriendTrack");
+  dEdx.AddColumn("tofNsigma",'F',nSpecies);
+  dEdx.AddColumn("tpcNsigma",'F',nSpecies);
+  //
+  // Laser
+  AliFilteredTreeSchema &laser = *fLaserSchema;
+  laser.AddColumn("multTPCtracks",'I');
+  laser.AddESDtrack("track",fStreamTrackObjects);
+  if (fStreamTrackObjects) laser.AddObject("friendTrack","AliESDfriendTrack");
+  //
+  // MCEffTree
+  AliFilteredTreeSchema &mcEff = *fMCEffSchema;
+  mcEff.AddVertex("vtxESD");
+  mcEff.AddColumn("mult",'I');
+  mcEff.AddColumn("multMCTrueTracks",'I');
+  mcEff.AddColumn("contTPC",'I');
+  mcEff.AddColumn("contSPD",'I');
+  mcEff.AddColumn("vertexPosTPC",'F',3);
+  mcEff.AddColumn("vertexPosSPD",'F',3);
+  mcEff.AddColumn("ntracksTPC",'I');
+  mcEff.AddColumn("ntracksITS",'I');
+  mcEff.AddColumn("isAcc0",'I');
+  mcEff.AddColumn("isAcc1",'I');
+  mcEff.AddESDtrack("esdTrack",fStreamTrackObjects);
+  mcEff.AddColumn("isRec",'b');
+  mcEff.AddColumn("tpcTrackLength",'F');
+  mcEff.AddObject("particle","TParticle");
+  mcEff.AddObject("particleMother","TParticle");
+  mcEff.AddColumn("mech",'I');
+  mcEff.AddColumn("nRec",'I');
+  mcEff.AddColumn("nFakes",'I');
+  //
+  // CosmicPairs
+  AliFilteredTreeSchema &cosmic = *fCosmicPairsSchema;
+  cosmic.AddColumn("trigger",'l');
+  cosmic.AddColumn("multSPD",'I');
+  cosmic.AddColumn("multTPC",'I');
+  cosmic.AddVertex("vertSPD");
+  cosmic.AddVertex("vertTPC");
+  for (Int_t i=0; i<2; i++) {
+    cosmic.AddESDtrack(TString::Format("t%d",i),fStreamTrackObjects);
+    if (fStreamTrackObjects) cosmic.AddObject(TString::Format("friendTrack%d",i),"AliESDfriendTrack");
+  }
+  //
+  // eventInfoTracks - one entry per event of Process
+  AliFilteredTreeSchema &eventInfoTracks = *fEventInfoTracksSchema;
+  DeclareEventColumns(eventInfoTracks);
+  eventInfoTracks.AddColumn("triggerMask",'l');
+  eventInfoTracks.AddColumn("mult",'I');
+  eventInfoTracks.AddColumn("ntracks",'I');
+  eventInfoTracks.AddColumn("isEventOK",'b');
+  eventInfoTracks.AddColumn("isEventTriggered",'b');
+  //
+  // eventInfoV0 - one entry per event of ProcessV0, run and time as in the TTreeSRedirector output
+  AliFilteredTreeSchema &eventInfoV0 = *fEventInfoV0Schema;
+  eventInfoV0.AddColumn("gid",'l');
+  eventInfoV0.AddString("fileName");
+  eventInfoV0.AddColumn("run",'I');
+  eventInfoV0.AddColumn("time",'I');
+  eventInfoV0.AddColumn("timeStamp",'D');
+  eventInfoV0.AddColumn("evtNumberInFile",'I');
+  eventInfoV0.AddString("triggerClass",1024);
+  eventInfoV0.AddColumn("Bz",'F');
+  eventInfoV0.AddColumn("mult",'I');
+  eventInfoV0.AddColumn("ntracks",'I');
+  eventInfoV0.AddColumn("nV0s",'I');
+  eventInfoV0.AddColumn("isEventOK",'b');
+  eventInfoV0.AddColumn("isEventTriggered",'b');
+  //
+  // itsTPC - ITS standalone track and its closest TPC tracks
+  if (fITSTPCSchema) {
+    AliFilteredTreeSchema &itsTPC = *fITSTPCSchema;
+    const char *indices[5]={"indexAll","indexTPC","indexTPCITS","ncandidates0","ncandidates1"};
+    for (Int_t i=0; i<5; i++) itsTPC.AddColumn(indices[i],'I');
+    itsTPC.AddColumn("chi2All",'D');
+    itsTPC.AddColumn("chi2TPC",'D');
+    itsTPC.AddColumn("chi2TPCITS",'D');
+    const char *tracks[4]={"track0","trackAll","trackTPC","trackTPCITS"};
+    for (Int_t i=0; i<4; i++) itsTPC.AddESDtrack(tracks[i],fStreamTrackObjects);
+    itsTPC.AddTrackParam("itsAtTPC");
+    itsTPC.AddTrackParam("itsAtITSTPC");
+  }
+  //
+  // per-column settings, in the order they were set
+  AliFilteredTreeSchema *schemas[9];
+  Int_t nSchemas=GetSchemas(schemas);
+  TObjArray *columnSettings[3]={fSchemaColumnCompression, fSchemaColumnBasketSize, fSchemaColumnType};
+  for (Int_t iSetting=0; iSetting<3; iSetting++) {
+    if (!columnSettings[iSetting]) continue;
+    for (Int_t j=0; j<columnSettings[iSetting]->GetEntriesFast(); j++) {
+      TParameter<Int_t> *setting = (TParameter<Int_t>*)columnSettings[iSetting]->At(j);
+      TString name = setting->GetName();
+      Int_t slash = name.Index("/");
+      TString treeName = name(0,slash);
+      TString prefix = name(slash+1,name.Length());
+      Bool_t found = kFALSE;
+      for (Int_t i=0; i<nSchemas; i++) {
+        if (!schemas[i] || treeName != schemas[i]->GetName()) continue;
+        if (iSetting==0) schemas[i]->SetColumnCompression(prefix,setting->GetVal());
+        else if (iSetting==1) schemas[i]->SetColumnBasketSize(prefix,setting->GetVal());
+        else schemas[i]->SetColumnType(prefix,setting->GetVal());
+        found = kTRUE;
+      }
+      if (!found) AliError(Form("No schema output tree %s for the column setting %s",treeName.Data(),name.Data()));
+    }
+  }
+  //
+  for (Int_t i=0; i<nSchemas; i++) {
+    if (schemas[i]) schemas[i]->MakeTree(fSchemaCompression,fSchemaBasketSize);
+  }
+}
+
 //_____________________________________________________________________________
 void AliAnalysisTaskFilteredTree::UserExec(Option_t *) 
 {
@@ -518,8 +866,8 @@ void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliES
 	}
       }
       if (fFriendDownscaling<=0){
-	if (((*fTreeSRedirector)<<"CosmicPairs").GetTree()){
-	  TTree * tree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+	{
+	  TTree * tree = fCosmicPairsTree;
 	  if (tree){
 	    Double_t sizeAll=tree->GetZipBytes();
 	    TBranch * br= tree->GetBranch("friendTrack0.fPoints");
@@ -535,6 +883,23 @@ void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliES
       }
       if(!fFillTree) return;
       if(!fTreeSRedirector) return;
+      if (fSchemaOutput) {
+        AliFilteredTreeSchema &schema = *fCosmicPairsSchema;
+        SetEventColumns(schema,gid,fCurrentFileName,runNumber,evtTimeStamp,timeStamp,eventNumber,triggerClass,magField);
+        schema.SetInteger("trigger",triggerMask);
+        schema.SetInteger("multSPD",ntracksSPD);
+        schema.SetInteger("multTPC",ntracksTPC);
+        schema.SetVertex("vertSPD",vertexSPD);
+        schema.SetVertex("vertTPC",vertexTPC);
+        schema.SetESDtrack("t0",track0);
+        schema.SetESDtrack("t1",track1);
+        if (fStreamTrackObjects) {
+          schema.SetObject("friendTrack0",friendTrackStore0);
+          schema.SetObject("friendTrack1",friendTrackStore1);
+        }
+        schema.Fill();
+        continue;
+      }
       (*fTreeSRedirector)<<"CosmicPairs"<<
         "gid="<<gid<<                         // global id of track
         "fileName.="<<&fCurrentFileName<<     // file name
@@ -745,6 +1110,22 @@ void AliAnalysisTaskFilteredTree::Process(AliESDEvent *const esdEvent, AliMCEven
       if(!fFillTree) return;
       if(!fTreeSRedirector) return;
       downscaleCounter++;
+      if (fSchemaOutput) {
+        AliFilteredTreeSchema &schema = *fHighPtSchema;
+        SetEventColumns(schema,gid,fCurrentFileName,runNumber,evtTimeStamp,timeStamp,evtNumberInFile,triggerClass,bz);
+        schema.SetInteger("selectionPtMask",selectionPtMask);
+        schema.SetVertex("vtxESD",vtxESD);
+        schema.SetInteger("ntracksESD",ntracks);
+        schema.SetInteger("IRtot",ir1);
+        schema.SetInteger("IRint2",ir2);
+        schema.SetInteger("mult",mult);
+        schema.SetInteger("multSPD",multSPD);
+        schema.SetInteger("multTPC",multTPC);
+        schema.SetESDtrack("esdTrack",track);
+        schema.SetValue("centralityF",centralityF);
+        schema.Fill();
+        continue;
+      }
       (*fTreeSRedirector)<<"highPt"<<
         "gid="<<gid<<
         "selectionPtMask="<<selectionPtMask<<
@@ -804,6 +1185,15 @@ void AliAnalysisTaskFilteredTree::ProcessLaser(AliESDEvent *const esdEvent, AliM
       Bool_t skipTrack=gRandom->Rndm()>1/(1+TMath::Abs(fFriendDownscaling));
       if (skipTrack) continue;
       if (esdFriend) {if (!esdFriend->TestSkipBit()) friendTrack = (AliESDfriendTrack*)track->GetFriendTrack();} //this guy can be NULL      
+      if (fSchemaOutput) {
+        AliFilteredTreeSchema &schema = *fLaserSchema;
+        SetEventColumns(schema,gid,fCurrentFileName,runNumber,evtTimeStamp,0,evtNumberInFile,triggerClass,bz);
+        schema.SetInteger("multTPCtracks",countLaserTracks);
+        schema.SetESDtrack("track",track);
+        if (fStreamTrackObjects) schema.SetObject("friendTrack",friendTrack);
+        schema.Fill();
+        continue;
+      }
       (*fTreeSRedirector)<<"Laser"<<
         "gid="<<gid<<                          // global identifier of event
         "fileName.="<<&fCurrentFileName<<              //
@@ -972,6 +1362,16 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
   Double_t timeStamp= esdEvent->GetTimeStampCTPBCCorr();
   Int_t evtNumberInFile = esdEvent->GetEventNumberInFile();
   Int_t mult = vtxESD->GetNContributors();
+  if (fSchemaOutput) {
+    AliFilteredTreeSchema &schema = *fEventInfoTracksSchema;
+    SetEventColumns(schema,gid,fCurrentFileName,runNumber,evtTimeStamp,timeStamp,evtNumberInFile,triggerClass,bz);
+    schema.SetInteger("triggerMask",triggerMask);
+    schema.SetInteger("mult",mult);
+    schema.SetInteger("ntracks",ntracks);
+    schema.SetInteger("isEventOK",isEventOK);
+    schema.SetInteger("isEventTriggered",isEventTriggered);
+    schema.Fill();
+  } else {
   (*fTreeSRedirector)<<"eventInfoTracks"<<
     "gid="<<gid<<
     "fileName.="<<&fCurrentFileName<<                // name of the chunk file (hopefully full)
@@ -987,6 +1387,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
     "isEventOK="<<isEventOK<<                 // flag - AliFilteredTreeEventCuts - track dumped only for selected events 
     "isEventTriggered="<<isEventTriggered<<   // flag - if tigger required - track dumped only for selected events 
     "\n";
+  }
 
 
 
@@ -1429,8 +1830,8 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
 	  friendTrackStore = (gRandom->Rndm()<1./fFriendDownscaling)? friendTrack:0;
 	}
 	if (fFriendDownscaling<=0){
-	  if (((*fTreeSRedirector)<<"highPt").GetTree()){
-	    TTree * tree = ((*fTreeSRedirector)<<"highPt").GetTree();
+	  {
+	    TTree * tree = fHighPtTree;
 	    if (tree){
 	      Double_t sizeAll=tree->GetZipBytes();
 	      TBranch * br= tree->GetBranch("friendTrack.fPoints");
@@ -1483,7 +1884,89 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
 	  pidResponse->ComputePIDProbability(AliPIDResponse::kTPC, track, nSpecies, tpcPID.GetMatrixArray());
 	  pidResponse->ComputePIDProbability(AliPIDResponse::kTOF, track, nSpecies, tofPID.GetMatrixArray());	    
 	}
-        if(fTreeSRedirector && dumpToTree && fFillTree) {
+        if(fTreeSRedirector && dumpToTree && fFillTree && fSchemaOutput) {
+	  downscaleCounter++;
+          AliFilteredTreeSchema &schema = *fHighPtSchema;
+          SetEventColumns(schema,gid,fCurrentFileName,runNumber,evtTimeStamp,timeStamp,evtNumberInFile,triggerClass,bz);
+          schema.SetInteger("downscaleCounter",downscaleCounter);
+          schema.SetValue("fLowPtTrackDownscaligF",fLowPtTrackDownscaligF);
+          schema.SetInteger("selectionPtMask",selectionPtMask);
+          schema.SetInteger("selectionPIDMask",selectionPIDMask);
+          schema.SetVertex("vtxESD",vtxESD);
+          schema.SetInteger("IRtot",ir1);
+          schema.SetInteger("IRint2",ir2);
+          schema.SetInteger("mult",mult);
+          schema.SetInteger("ntracks",ntracks);
+          schema.SetInteger("contTPC",contTPC);
+          schema.SetInteger("contSPD",contSPD);
+          schema.SetArray("vertexPosTPC",vertexPosTPC);
+          schema.SetArray("vertexPosSPD",vertexPosSPD);
+          schema.SetInteger("ntracksTPC",ntracksTPC);
+          schema.SetInteger("ntracksITS",ntracksITS);
+          schema.SetESDtrack("esdTrack",track);
+          schema.SetArray("tofClInfo",tofClInfo);
+          schema.SetArray("tofNsigma",tofNsigma);
+          schema.SetArray("tpcNsigma",tpcNsigma);
+          schema.SetArray("tofPID",tofPID);
+          schema.SetArray("tpcPID",tpcPID);
+          if (fStreamTrackObjects) schema.SetObject("friendTrack",friendTrackStore);
+          schema.SetTrackParam("extTPCInnerC",tpcInnerC);
+          schema.SetTrackParam("extInnerParamV",trackInnerV);
+          schema.SetTrackParam("extInnerParamC",trackInnerC);
+          schema.SetTrackParam("extInnerParam",trackInnerC2);
+          schema.SetTrackParam("extOuterITS",outerITSc);
+          schema.SetTrackParam("extInnerParamRef",trackInnerC3);
+          schema.SetValue("chi2TPCInnerC",chi2(0,0));
+          schema.SetValue("chi2InnerC",chi2trackC(0,0));
+          schema.SetValue("chi2OuterITS",chi2OuterITS(0,0));
+          schema.SetValue("centralityF",centralityF);
+          schema.SetTrackParam("paramITS",&paramITS);
+          schema.SetTrackParam("paramITSC",&paramITSC);
+          schema.SetTrackParam("paramComb",&paramComb);
+          schema.SetInteger("indexNearestITS",indexNearestITS);
+          schema.SetInteger("indexNearestITSC",indexNearestITSC);
+          schema.SetInteger("indexNearestComb",indexNearestComb);
+          if (mcEvent) {
+            downscaleCounter++;
+            schema.SetInteger("multMCTrueTracks",multMCTrueTracks);
+            schema.SetInteger("nrefITS",nrefITS);
+            schema.SetInteger("nrefTPC",nrefTPC);
+            schema.SetInteger("nrefTRD",nrefTRD);
+            schema.SetInteger("nrefTOF",nrefTOF);
+            schema.SetInteger("nrefEMCAL",nrefEMCAL);
+            schema.SetInteger("nrefPHOS",nrefPHOS);
+            schema.SetObject("refTPCIn",refTPCIn);
+            schema.SetObject("refTPCOut",refTPCOut);
+            schema.SetObject("refITS",refITS);
+            schema.SetObject("refTRD",refTRD);
+            schema.SetObject("refTOF",refTOF);
+            schema.SetObject("refEMCAL",refEMCAL);
+            schema.SetObject("refPHOS",refPHOS);
+            schema.SetObject("particle",particle);
+            schema.SetObject("particleMother",particleMother);
+            schema.SetInteger("mech",mech);
+            schema.SetInteger("isPrim",isPrim);
+            schema.SetInteger("isFromStrangess",isFromStrangess);
+            schema.SetInteger("isFromConversion",isFromConversion);
+            schema.SetInteger("isFromMaterial",isFromMaterial);
+            schema.SetObject("particleTPC",particleTPC);
+            schema.SetObject("particleMotherTPC",particleMotherTPC);
+            schema.SetInteger("mechTPC",mechTPC);
+            schema.SetInteger("isPrimTPC",isPrimTPC);
+            schema.SetInteger("isFromStrangessTPC",isFromStrangessTPC);
+            schema.SetInteger("isFromConversionTPC",isFromConversionTPC);
+            schema.SetInteger("isFromMaterialTPC",isFromMaterialTPC);
+            schema.SetObject("particleITS",particleITS);
+            schema.SetObject("particleMotherITS",particleMotherITS);
+            schema.SetInteger("mechITS",mechITS);
+            schema.SetInteger("isPrimITS",isPrimITS);
+            schema.SetInteger("isFromStrangessITS",isFromStrangessITS);
+            schema.SetInteger("isFromConversionITS",isFromConversionITS);
+            schema.SetInteger("isFromMaterialITS",isFromMaterialITS);
+          }
+          schema.Fill();
+        }
+        else if(fTreeSRedirector && dumpToTree && fFillTree) {
 	  downscaleCounter++;
           (*fTreeSRedirector)<<"highPt"<<
 	    "downscaleCounter="<<downscaleCounter<<
@@ -1837,7 +2320,32 @@ void AliAnalysisTaskFilteredTree::ProcessMCEff(AliESDEvent *const esdEvent, AliM
 
 
       //
-      if(fTreeSRedirector && fFillTree) {
+      if(fTreeSRedirector && fFillTree && fSchemaOutput) {
+	downscaleCounter++;
+        AliFilteredTreeSchema &schema = *fMCEffSchema;
+        SetEventColumns(schema,0,fCurrentFileName,runNumber,evtTimeStamp,timeStamp,evtNumberInFile,triggerClass,bz);
+        schema.SetVertex("vtxESD",vtxESD);
+        schema.SetInteger("mult",mult);
+        schema.SetInteger("multMCTrueTracks",multMCTrueTracks);
+        schema.SetInteger("contTPC",contTPC);
+        schema.SetInteger("contSPD",contSPD);
+        schema.SetArray("vertexPosTPC",vertexPosTPC);
+        schema.SetArray("vertexPosSPD",vertexPosSPD);
+        schema.SetInteger("ntracksTPC",ntracksTPC);
+        schema.SetInteger("ntracksITS",ntracksITS);
+        schema.SetInteger("isAcc0",isESDtrackCut);
+        schema.SetInteger("isAcc1",isAccCuts);
+        schema.SetESDtrack("esdTrack",recTrack);
+        schema.SetInteger("isRec",isRec);
+        schema.SetValue("tpcTrackLength",tpcTrackLength);
+        schema.SetObject("particle",particle);
+        schema.SetObject("particleMother",particleMother);
+        schema.SetInteger("mech",mech);
+        schema.SetInteger("nRec",nRec);
+        schema.SetInteger("nFakes",nFakes);
+        schema.Fill();
+      }
+      else if(fTreeSRedirector && fFillTree) {
 	downscaleCounter++;
         (*fTreeSRedirector)<<"MCEffTree"<<
           "fileName.="<<&fCurrentFileName<<
@@ -1985,6 +2493,23 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
   Int_t evtNumberInFile = esdEvent->GetEventNumberInFile();
   Int_t nV0s = esdEvent->GetNumberOfV0s();
   Int_t mult = vtxESD->GetNContributors();
+  if (fSchemaOutput) {
+    AliFilteredTreeSchema &schema = *fEventInfoV0Schema;
+    schema.SetInteger("gid",gid);
+    schema.SetString("fileName",fCurrentFileName.GetString().Data());
+    schema.SetInteger("run",run);
+    schema.SetInteger("time",time);
+    schema.SetValue("timeStamp",timeStamp);
+    schema.SetInteger("evtNumberInFile",evtNumberInFile);
+    schema.SetString("triggerClass",triggerClass.GetString().Data());
+    schema.SetValue("Bz",bz);
+    schema.SetInteger("mult",mult);
+    schema.SetInteger("ntracks",ntracks);
+    schema.SetInteger("nV0s",nV0s);
+    schema.SetInteger("isEventOK",isEventOK);
+    schema.SetInteger("isEventTriggered",isEventTriggered);
+    schema.Fill();
+  } else {
   (*fTreeSRedirector)<<"eventInfoV0"<<
     "gid="<<gid<<
     "fileName.="<<&fCurrentFileName<<                // name of the chunk file (hopefully full)
@@ -2000,6 +2525,7 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
     "isEventOK="<<isEventOK<<                 // flag - AliFilteredTreeEventCuts - track dumped only for selected events 
     "isEventTriggered="<<isEventTriggered<<   // flag - if tigger required - track dumped only for selected events 
     "\n";
+  }
 
 
 
@@ -2049,8 +2575,8 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
 	}
       }
       if (fFriendDownscaling<=0){
-	if (((*fTreeSRedirector)<<"V0s").GetTree()){
-	  TTree * tree = ((*fTreeSRedirector)<<"V0s").GetTree();
+	{
+	  TTree * tree = fV0Tree;
 	  if (tree){
 	    Double_t sizeAll=tree->GetZipBytes();
 	    TBranch * br= tree->GetBranch("friendTrack0.fPoints");
@@ -2112,6 +2638,33 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
       }
 
       downscaleCounter++;
+      if (fSchemaOutput) {
+        AliFilteredTreeSchema &schema = *fV0Schema;
+        SetEventColumns(schema,gid,fCurrentFileName,run,time,0,evNr,triggerClass,bz);
+        schema.SetValue("fLowPtV0DownscaligF",fLowPtV0DownscaligF);
+        schema.SetInteger("selectionPtMask",selectionPtMask);
+        schema.SetInteger("downscaleCounter",downscaleCounter);
+        schema.SetInteger("type",type);
+        schema.SetInteger("ntracks",ntracks);
+        schema.SetV0("v0",v0);
+        schema.SetObject("v0",v0);
+        schema.SetObject("kf",&kfparticle);
+        schema.SetESDtrack("track0",track0);
+        schema.SetESDtrack("track1",track1);
+        schema.SetArray("tofClInfo0",tofClInfo0);
+        schema.SetArray("tofClInfo1",tofClInfo1);
+        schema.SetArray("tofNsigma0",tofNsigma0);
+        schema.SetArray("tofNsigma1",tofNsigma1);
+        schema.SetArray("tpcNsigma0",tpcNsigma0);
+        schema.SetArray("tpcNsigma1",tpcNsigma1);
+        if (fStreamTrackObjects) {
+          schema.SetObject("friendTrack0",friendTrackStore0);
+          schema.SetObject("friendTrack1",friendTrackStore1);
+        }
+        schema.SetValue("centralityF",centralityF);
+        schema.Fill();
+        continue;
+      }
       (*fTreeSRedirector)<<"V0s"<<
         "gid="<<gid<<                         //  global id of event
         "fLowPtV0DownscaligF="<<fLowPtV0DownscaligF<<
@@ -2267,6 +2820,18 @@ void AliAnalysisTaskFilteredTree::ProcessdEdx(AliESDEvent *const esdEvent, AliMC
       }
 	
       downscaleCounter++;
+      if (fSchemaOutput) {
+        AliFilteredTreeSchema &schema = *fdEdxSchema;
+        SetEventColumns(schema,gid,fCurrentFileName,runNumber,evtTimeStamp,timeStamp,evtNumberInFile,triggerClass,bz);
+        schema.SetVertex("vtxESD",vtxESD);
+        schema.SetInteger("mult",mult);
+        schema.SetESDtrack("esdTrack",track);
+        if (fStreamTrackObjects) schema.SetObject("friendTrack",friendTrack);
+        schema.SetArray("tofNsigma",tofNsigma);
+        schema.SetArray("tpcNsigma",tpcNsigma);
+        schema.Fill();
+        continue;
+      }
       (*fTreeSRedirector)<<"dEdx"<<           // high dEdx tree
         "gid="<<gid<<                         // global id
         "fileName.="<<&fCurrentFileName<<     // file name
@@ -2689,6 +3254,22 @@ void AliAnalysisTaskFilteredTree::FinishTaskOutput()
   }
   if (deleteTrees) delete fTreeSRedirector;
   fTreeSRedirector=NULL;
+  if (fSchemaOutput) {
+    // as TTreeSRedirector::Close - write the schema trees to their directory
+    AliFilteredTreeSchema *schemas[9];
+    Int_t nSchemas=GetSchemas(schemas);
+    for (Int_t i=0; i<nSchemas; i++) {
+      if (!schemas[i]) continue;
+      TTree *tree = schemas[i]->GetTree();
+      if (deleteTrees && tree && tree->GetDirectory()) {
+        TDirectory::TContext context(tree->GetDirectory());
+        tree->Write(tree->GetName());
+      }
+      delete schemas[i];
+    }
+    fHighPtSchema=fV0Schema=fdEdxSchema=fLaserSchema=fMCEffSchema=fCosmicPairsSchema=NULL;
+    fEventInfoTracksSchema=fEventInfoV0Schema=fITSTPCSchema=NULL;
+  }
 }
 
 //_____________________________________________________________________________
@@ -2962,6 +3543,25 @@ void AliAnalysisTaskFilteredTree::ProcessITSTPCmatchOut(AliESDEvent *const esdEv
     AliESDtrack * trackAll= (indexAll>=0)? esdEvent->GetTrack(indexAll):&esdTrackDummy;
     AliESDtrack * trackTPC= (indexTPC>=0)? esdEvent->GetTrack(indexTPC):&esdTrackDummy;
     AliESDtrack * trackTPCITS= (indexTPCITS>=0)? esdEvent->GetTrack(indexTPCITS):&esdTrackDummy;
+    if (fITSTPCSchema) {
+      AliFilteredTreeSchema &schema = *fITSTPCSchema;
+      schema.SetInteger("indexAll",indexAll);
+      schema.SetInteger("indexTPC",indexTPC);
+      schema.SetInteger("indexTPCITS",indexTPCITS);
+      schema.SetInteger("ncandidates0",ncandidates0);
+      schema.SetInteger("ncandidates1",ncandidates1);
+      schema.SetValue("chi2All",minChi2All);
+      schema.SetValue("chi2TPC",minChi2TPC);
+      schema.SetValue("chi2TPCITS",minChi2TPCITS);
+      schema.SetESDtrack("track0",track0);
+      schema.SetESDtrack("trackAll",trackAll);
+      schema.SetESDtrack("trackTPC",trackTPC);
+      schema.SetESDtrack("trackTPCITS",trackTPCITS);
+      schema.SetTrackParam("itsAtTPC",&itsAtTPC);
+      schema.SetTrackParam("itsAtITSTPC",&itsAtITSTPC);
+      schema.Fill();
+      continue;
+    }
     (*fTreeSRedirector)<<"itsTPC"<<
       "indexAll="<<indexAll<<          // index of closest track (chi2)
       "indexTPC="<<indexTPC<<          // index of closest TPCalone tracks
@@ -22,6 +22,17 @@
    3.) "Laser"      - dump laser tracks with space points if exists
    4.) "CosmicTree" - cosmic track candidate (random or triggered) + esdTracks(up/down)+ optional points
    5.) "dEdx"       - tree with high dEdx tpc tracks
+
+   Output modes:
+     default        - trees written by TTreeSRedirector, branches defined by the first fill
+     SetSchemaOutput - the same trees written with declared schemas (AliFilteredTreeSchema):
+                      flat split columns (tracks as <name>_<member> summaries, e.g. esdTrack_fTPCsignal,
+                      esdTrack_fP[5]) with per-tree compression and basket size; whole AliESDtrack and
+                      AliESDfriendTrack objects are streamed only if requested. The event info and itsTPC
+                      matching trees are written with schemas as well. Track parameters and vertices are
+                      in double precision, SetSchemaColumnType sets the precision per column.
+                      The default aliases (SetDefaultAliases*) refer to the object branches and do not apply.
+                      Read performance of the two forms: macros/BenchmarkFilteredTreeRead.C
 */
 class AliESDEvent;
 class AliMCEvent;
@@ -45,6 +56,7 @@ class TTreeSRedirector;
 class TParticle;
 class TH3D;
 class AliESDtools;
+class AliFilteredTreeSchema;
 #include <string>
 
 #include "AliTriggerAnalysis.h"
@@ -117,6 +129,12 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   void SetLowPtTrackDownscaligF(Double_t fact) { fLowPtTrackDownscaligF = fact; }
   void SetLowPtV0DownscaligF(Double_t fact)    { fLowPtV0DownscaligF = fact; }
   void SetFriendDownscaling(Double_t fact)    { fFriendDownscaling = fact; }
+  void SetSchemaOutput(Bool_t flag, Bool_t streamTrackObjects=kTRUE) { fSchemaOutput = flag; fStreamTrackObjects = streamTrackObjects; }
+  void SetSchemaCompression(Int_t compression, Int_t basketSize=256000) { fSchemaCompression = compression; fSchemaBasketSize = basketSize; }
+  void SetSchemaColumnCompression(const char *treeName, const char *prefix, Int_t compression);
+  void SetSchemaColumnBasketSize(const char *treeName, const char *prefix, Int_t basketSize);
+  void SetSchemaColumnType(const char *treeName, const char *prefix, Char_t type);
+  Bool_t GetSchemaOutput() const { return fSchemaOutput; }
   
   void   SetProcessCosmics(Bool_t flag) { fProcessCosmics = flag; }
   Bool_t GetProcessCosmics() { return fProcessCosmics; }
@@ -143,6 +161,8 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   static Int_t    DownsampleTsalisCharged(Double_t pt, Double_t factorPt, Double_t factor1Pt,  Double_t sqrts=5020, Double_t mass=0.2);
   Int_t  PIDSelection(AliESDtrack *track);
  private:
+  void DeclareSchemas();
+  Int_t GetSchemas(AliFilteredTreeSchema **schemas) const;
   AliESDEvent *fESD;    //! ESD event
   AliMCEvent *fMC;      //! MC event
   AliESDfriend *fESDfriend; //! ESDfriend event
@@ -162,6 +182,22 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   EAnalysisMode fAnalysisMode;   // analysis mode TPC only, TPC + ITS
 
   TTreeSRedirector* fTreeSRedirector;      //! temp tree to dump output
+  Bool_t fSchemaOutput;          // write the output trees with declared schemas instead of TTreeSRedirector
+  Bool_t fStreamTrackObjects;    // schema output: stream whole AliESDtrack/AliESDfriendTrack objects in addition to the flat columns
+  Int_t  fSchemaCompression;     // schema output: compression settings of the trees (-1 - file default)
+  Int_t  fSchemaBasketSize;      // schema output: basket size of the branches
+  TObjArray* fSchemaColumnCompression; // schema output: per-column compression settings, TParameter<Int_t> named "<tree>/<column prefix>"
+  TObjArray* fSchemaColumnBasketSize;  // schema output: per-column basket sizes, TParameter<Int_t> named "<tree>/<column prefix>"
+  TObjArray* fSchemaColumnType;        // schema output: per-column precision ('F'/'D'), TParameter<Int_t> named "<tree>/<column prefix>"
+  AliFilteredTreeSchema* fHighPtSchema;      //! schema of the highPt tree
+  AliFilteredTreeSchema* fV0Schema;          //! schema of the V0s tree
+  AliFilteredTreeSchema* fdEdxSchema;        //! schema of the dEdx tree
+  AliFilteredTreeSchema* fLaserSchema;       //! schema of the Laser tree
+  AliFilteredTreeSchema* fMCEffSchema;       //! schema of the MCEffTree tree
+  AliFilteredTreeSchema* fCosmicPairsSchema; //! schema of the CosmicPairs tree
+  AliFilteredTreeSchema* fEventInfoTracksSchema; //! schema of the eventInfoTracks tree
+  AliFilteredTreeSchema* fEventInfoV0Schema;     //! schema of the eventInfoV0 tree
+  AliFilteredTreeSchema* fITSTPCSchema;          //! schema of the itsTPC matching tree (with fProcessITSTPCmatchOut)
 
   TString fCentralityEstimator;     // use centrality can be "VOM" (default), "FMD", "TRK", "TKL", "CL0", "CL1", "V0MvsFMD", "TKLvsV0M", "ZEMvsZDC"
 
@@ -202,7 +238,7 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
 
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 4); // example of analysis
 };
 
 #endif
@@ -0,0 +1,486 @@
+/**************************************************************************
+* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <TTree.h>
+#include <TBranch.h>
+#include <TClass.h>
+#include <TString.h>
+#include <TVectorD.h>
+
+#include "AliLog.h"
+#include "AliExternalTrackParam.h"
+#include "AliESDtrack.h"
+#include "AliESDVertex.h"
+#include "AliESDv0.h"
+
+#include "AliFilteredTreeSchema.h"
+
+using namespace std;
+
+ClassImp(AliFilteredTreeSchema)
+
+namespace {
+  //_____________________________________________________________________________
+  template <typename T> void StoreValue(char *address, Char_t type, Int_t i, T value)
+  {
+    // store one element of a numeric column with the type of its leaf
+    switch (type) {
+      case 'F': reinterpret_cast<Float_t*>(address)[i]   = value; break;
+      case 'D': reinterpret_cast<Double_t*>(address)[i]  = value; break;
+      case 'I': reinterpret_cast<Int_t*>(address)[i]     = value; break;
+      case 'i': reinterpret_cast<UInt_t*>(address)[i]    = value; break;
+      case 'L': reinterpret_cast<Long64_t*>(address)[i]  = value; break;
+      case 'l': reinterpret_cast<ULong64_t*>(address)[i] = value; break;
+      case 'b': reinterpret_cast<UChar_t*>(address)[i]   = value; break;
+      default: break;
+    }
+  }
+}
+
+//_____________________________________________________________________________
+AliFilteredTreeSchema::AliFilteredTreeSchema(const char *treeName, const char *treeTitle) :
+  fName(treeName),
+  fTitle(treeTitle),
+  fColumns(),
+  fIndex(),
+  fBuffer(),
+  fObjects(),
+  fDefaults(),
+  fUnknown(),
+  fTree(0)
+{
+  // constructor - columns are declared with the Add* methods
+}
+
+//_____________________________________________________________________________
+AliFilteredTreeSchema::~AliFilteredTreeSchema()
+{
+  // the tree belongs to its directory - the default objects are owned here
+  for (UInt_t i = 0; i < fColumns.size(); i++) {
+    const Column &col = fColumns[i];
+    if (col.fType == 'X' && fDefaults[col.fOffset]) col.fClass->Destructor(fDefaults[col.fOffset]);
+  }
+}
+
+//_____________________________________________________________________________
+Int_t AliFilteredTreeSchema::TypeSize(Char_t type)
+{
+  // size of one element of a leaf type
+  switch (type) {
+    case 'F': case 'I': case 'i': return 4;
+    case 'D': case 'L': case 'l': return 8;
+    case 'b': case 'C': return 1;
+    default: return 0;
+  }
+}
+
+//_____________________________________________________________________________
+Int_t AliFilteredTreeSchema::Declare(const char *name, Char_t type, Int_t size)
+{
+  // register a column, returns its index or -1
+  if (fTree) {
+    AliErrorClassF("%s: column %s declared after MakeTree", fName.c_str(), name);
+    return -1;
+  }
+  if (fIndex.count(name)) {
+    AliErrorClassF("%s: column %s declared twice", fName.c_str(), name);
+    return -1;
+  }
+  if (size < 1) size = 1;
+
+  Column col;
+  col.fName        = name;
+  col.fType        = type;
+  col.fSize        = size;
+  col.fSplit       = 0;
+  col.fCompression = -1;
+  col.fBasketSize  = 0;
+  col.fClass       = 0;
+  col.fOffset      = -1;  // buffer columns are placed by MakeTree, after SetColumnType
+  if (type == 'X') {
+    col.fOffset = fObjects.size();
+    fObjects.push_back(0);
+    fDefaults.push_back(0);
+  }
+  fColumns.push_back(col);
+  fIndex[col.fName] = fColumns.size() - 1;
+  return fColumns.size() - 1;
+}
+
+//_____________________________________________________________________________
+Int_t AliFilteredTreeSchema::AddColumn(const char *name, Char_t type, Int_t size)
+{
+  // numeric column or fixed size array
+  if (TypeSize(type) == 0 || type == 'C') {
+    AliErrorClassF("%s: unsupported type %c of column %s", fName.c_str(), type, name);
+    return -1;
+  }
+  return Declare(name, type, size);
+}
+
+//_____________________________________________________________________________
+Int_t AliFilteredTreeSchema::AddString(const char *name, Int_t maxLength)
+{
+  // string column, longer strings are truncated
+  return Declare(name, 'C', maxLength);
+}
+
+//_____________________________________________________________________________
+Int_t AliFilteredTreeSchema::AddObject(const char *name, const char *className, Int_t splitLevel)
+{
+  // object column - the branch is named "name." so that the split
+  // branches keep the names of the TTreeSRedirector output (e.g. friendTrack.fPoints)
+  TClass *cl = TClass::GetClass(className);
+  if (!cl) {
+    AliErrorClassF("%s: unknown class %s of column %s", fName.c_str(), className, name);
+    return -1;
+  }
+  Int_t index = Declare(name, 'X', 1);
+  if (index < 0) return index;
+  fColumns[index].fClass = cl;
+  fColumns[index].fSplit = splitLevel;
+  return index;
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::AddTrackParam(const char *name, Char_t type)
+{
+  // track parameters name_fX, name_fAlpha, name_fP[5], name_fC[15] - double precision
+  // by default as in AliExternalTrackParam, 'F' halves the size
+  string prefix(name);
+  AddColumn((prefix + "_fX").c_str(), type);
+  AddColumn((prefix + "_fAlpha").c_str(), type);
+  AddColumn((prefix + "_fP").c_str(), type, 5);
+  AddColumn((prefix + "_fC").c_str(), type, 15);
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::AddESDtrack(const char *name, Bool_t streamObject)
+{
+  // flat summary of an ESD track: parameters at the DCA, inner (fIp), TPC inner (fTPCInner)
+  // and outer (fOp) parameters, status, detector signals and cluster counts, impact parameters
+  // and labels. With streamObject the whole AliESDtrack is written in addition.
+  string prefix(name);
+  prefix += "_";
+  AddTrackParam(name);
+  AddTrackParam((prefix + "fIp").c_str());
+  AddTrackParam((prefix + "fTPCInner").c_str());
+  AddTrackParam((prefix + "fOp").c_str());
+  AddColumn((prefix + "fFlags").c_str(), 'l');
+  AddColumn((prefix + "fLabel").c_str(), 'I');
+  AddColumn((prefix + "fTPCLabel").c_str(), 'I');
+  AddColumn((prefix + "fTPCsignal").c_str(), 'F');
+  AddColumn((prefix + "fTPCsignalN").c_str(), 'I');
+  AddColumn((prefix + "fTPCncls").c_str(), 'I');
+  AddColumn((prefix + "fTPCnclsF").c_str(), 'I');
+  AddColumn((prefix + "fTPCCrossedRows").c_str(), 'F');
+  AddColumn((prefix + "fTPCchi2").c_str(), 'F');
+  AddColumn((prefix + "fITSncls").c_str(), 'I');
+  AddColumn((prefix + "fITSClusterMap").c_str(), 'b');
+  AddColumn((prefix + "fITSchi2").c_str(), 'F');
+  AddColumn((prefix + "fITSsignal").c_str(), 'F');
+  AddColumn((prefix + "fTRDncls").c_str(), 'I');
+  AddColumn((prefix + "fTRDsignal").c_str(), 'F');
+  AddColumn((prefix + "fTOFsignal").c_str(), 'F');
+  AddColumn((prefix + "fD").c_str(), 'F');
+  AddColumn((prefix + "fZ").c_str(), 'F');
+  AddColumn((prefix + "fCdd").c_str(), 'F');
+  AddColumn((prefix + "fCdz").c_str(), 'F');
+  AddColumn((prefix + "fCzz").c_str(), 'F');
+  if (streamObject) AddObject(name, "AliESDtrack");
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::AddVertex(const char *name, Char_t type)
+{
+  // vertex position and covariance (double precision by default), chi2 and number of contributors
+  string prefix(name);
+  prefix += "_";
+  AddColumn((prefix + "fPosition").c_str(), type, 3);
+  AddColumn((prefix + "fCovXYZ").c_str(), type, 6);
+  AddColumn((prefix + "fChi2").c_str(), 'F');
+  AddColumn((prefix + "fNContributors").c_str(), 'I');
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::AddV0(const char *name)
+{
+  // V0 topology: decay position, pt, daughter indices and the quantities used in the V0 selection
+  string prefix(name);
+  prefix += "_";
+  AddColumn((prefix + "fPos").c_str(), 'F', 3);
+  AddColumn((prefix + "fRr").c_str(), 'F');
+  AddColumn((prefix + "fPt").c_str(), 'F');
+  AddColumn((prefix + "fIndex").c_str(), 'I', 2);
+  AddColumn((prefix + "fOnFlyStatus").c_str(), 'b');
+  AddColumn((prefix + "fChi2V0").c_str(), 'F');
+  AddColumn((prefix + "fDcaV0Daughters").c_str(), 'F');
+  AddColumn((prefix + "fPointAngle").c_str(), 'F');
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetColumnType(const char *prefix, Char_t type)
+{
+  // precision ('F' or 'D') of the floating point columns starting with prefix
+  if (type != 'F' && type != 'D') {
+    AliErrorClassF("%s: column type %c is not a floating point type", fName.c_str(), type);
+    return;
+  }
+  if (fTree) {
+    AliErrorClassF("%s: column type of %s set after MakeTree", fName.c_str(), prefix);
+    return;
+  }
+  size_t n = strlen(prefix);
+  for (UInt_t i = 0; i < fColumns.size(); i++) {
+    Column &col = fColumns[i];
+    if (col.fType != 'F' && col.fType != 'D') continue;
+    if (col.fName.compare(0, n, prefix) == 0) col.fType = type;
+  }
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetColumnCompression(const char *prefix, Int_t compression)
+{
+  // compression settings of all the columns starting with prefix (-1: tree default)
+  size_t n = strlen(prefix);
+  for (UInt_t i = 0; i < fColumns.size(); i++) {
+    if (fColumns[i].fName.compare(0, n, prefix) == 0) fColumns[i].fCompression = compression;
+  }
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetColumnBasketSize(const char *prefix, Int_t basketSize)
+{
+  // basket size of all the columns starting with prefix (0: tree default)
+  size_t n = strlen(prefix);
+  for (UInt_t i = 0; i < fColumns.size(); i++) {
+    if (fColumns[i].fName.compare(0, n, prefix) == 0) fColumns[i].fBasketSize = basketSize;
+  }
+}
+
+//_____________________________________________________________________________
+TTree *AliFilteredTreeSchema::MakeTree(Int_t compression, Int_t basketSize)
+{
+  // make the tree in the current directory with one branch per column
+  if (fTree) return fTree;
+  // every buffer column starts on an 8-byte boundary
+  UInt_t nWords = 0;
+  for (UInt_t i = 0; i < fColumns.size(); i++) {
+    Column &col = fColumns[i];
+    if (col.fType == 'X') continue;
+    Int_t bytes = (col.fType == 'C') ? col.fSize + 1 : col.fSize * TypeSize(col.fType);
+    col.fOffset = nWords * sizeof(Double_t);
+    nWords += (bytes + sizeof(Double_t) - 1) / sizeof(Double_t);
+  }
+  fBuffer.assign(nWords, 0.);
+  fTree = new TTree(fName.c_str(), fTitle.c_str());
+  char *base = fBuffer.empty() ? 0 : reinterpret_cast<char*>(&fBuffer[0]);
+
+  for (UInt_t i = 0; i < fColumns.size(); i++) {
+    const Column &col = fColumns[i];
+    Int_t basket = (col.fBasketSize > 0) ? col.fBasketSize : basketSize;
+    TBranch *br = 0;
+    if (col.fType == 'X') {
+      fDefaults[col.fOffset] = col.fClass->New();
+      fObjects[col.fOffset] = fDefaults[col.fOffset];
+      string branchName = col.fName;
+      if (col.fSplit > 0) branchName += ".";
+      br = fTree->Branch(branchName.c_str(), col.fClass->GetName(), &fObjects[col.fOffset], basket, col.fSplit);
+    } else {
+      TString leaves = col.fName.c_str();
+      if (col.fType != 'C' && col.fSize > 1) leaves += TString::Format("[%d]", col.fSize);
+      leaves += "/";
+      leaves += col.fType;
+      br = fTree->Branch(col.fName.c_str(), base + col.fOffset, leaves.Data(), basket);
+    }
+    if (!br) {
+      AliErrorClassF("%s: branch %s not created", fName.c_str(), col.fName.c_str());
+      continue;
+    }
+    Int_t settings = (col.fCompression >= 0) ? col.fCompression : compression;
+    if (settings >= 0) br->SetCompressionSettings(settings);
+  }
+  return fTree;
+}
+
+//_____________________________________________________________________________
+AliFilteredTreeSchema::Column *AliFilteredTreeSchema::Find(const char *name)
+{
+  // column by name - undeclared names are reported once, nothing is set before MakeTree
+  if (!fTree) {
+    AliErrorClassF("%s: column %s set before MakeTree", fName.c_str(), name);
+    return 0;
+  }
+  std::map<string, Int_t>::const_iterator it = fIndex.find(name);
+  if (it != fIndex.end()) return &fColumns[it->second];
+  if (fUnknown.insert(name).second) AliWarningClassF("%s: column %s not declared, ignored", fName.c_str(), name);
+  return 0;
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetValue(const char *name, Double_t value)
+{
+  // set a numeric column (first element of arrays)
+  Column *col = Find(name);
+  if (!col || col->fType == 'C' || col->fType == 'X') return;
+  StoreValue(reinterpret_cast<char*>(&fBuffer[0]) + col->fOffset, col->fType, 0, value);
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetInteger(const char *name, Long64_t value)
+{
+  // set a numeric column from an integer - exact for the 64 bit columns (e.g. gid)
+  Column *col = Find(name);
+  if (!col || col->fType == 'C' || col->fType == 'X') return;
+  StoreValue(reinterpret_cast<char*>(&fBuffer[0]) + col->fOffset, col->fType, 0, value);
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetArray(const char *name, const Double_t *values, Int_t n)
+{
+  // set an array column, extra values are ignored
+  Column *col = Find(name);
+  if (!col || !values || col->fType == 'C' || col->fType == 'X') return;
+  char *address = reinterpret_cast<char*>(&fBuffer[0]) + col->fOffset;
+  for (Int_t i = 0; i < n && i < col->fSize; i++) StoreValue(address, col->fType, i, values[i]);
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetArray(const char *name, const TVectorD &values)
+{
+  SetArray(name, values.GetMatrixArray(), values.GetNrows());
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetString(const char *name, const char *value)
+{
+  // set a string column, truncated to the declared length
+  Column *col = Find(name);
+  if (!col || col->fType != 'C') return;
+  char *address = reinterpret_cast<char*>(&fBuffer[0]) + col->fOffset;
+  if (value) strncpy(address, value, col->fSize);
+  address[col->fSize] = 0;
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetObject(const char *name, const TObject *object)
+{
+  // set an object column - the object is not copied and has to live until Fill,
+  // NULL writes the default object
+  Column *col = Find(name);
+  if (!col || col->fType != 'X') return;
+  fObjects[col->fOffset] = object ? const_cast<TObject*>(object) : fDefaults[col->fOffset];
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetTrackParam(const char *name, const AliExternalTrackParam *param)
+{
+  // set the columns of AddTrackParam, NULL leaves them at 0
+  if (!param) return;
+  string prefix(name);
+  SetValue((prefix + "_fX").c_str(), param->GetX());
+  SetValue((prefix + "_fAlpha").c_str(), param->GetAlpha());
+  SetArray((prefix + "_fP").c_str(), param->GetParameter(), 5);
+  SetArray((prefix + "_fC").c_str(), param->GetCovariance(), 15);
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetESDtrack(const char *name, const AliESDtrack *track)
+{
+  // set the columns of AddESDtrack
+  if (!track) return;
+  string prefix(name);
+  if (HasColumn(name)) SetObject(name, track);
+  SetTrackParam(name, track);
+  prefix += "_";
+  SetTrackParam((prefix + "fIp").c_str(), track->GetInnerParam());
+  SetTrackParam((prefix + "fTPCInner").c_str(), track->GetTPCInnerParam());
+  SetTrackParam((prefix + "fOp").c_str(), track->GetOuterParam());
+  SetInteger((prefix + "fFlags").c_str(), track->GetStatus());
+  SetInteger((prefix + "fLabel").c_str(), track->GetLabel());
+  SetInteger((prefix + "fTPCLabel").c_str(), track->GetTPCLabel());
+  SetValue((prefix + "fTPCsignal").c_str(), track->GetTPCsignal());
+  SetInteger((prefix + "fTPCsignalN").c_str(), track->GetTPCsignalN());
+  SetInteger((prefix + "fTPCncls").c_str(), track->GetTPCNcls());
+  SetInteger((prefix + "fTPCnclsF").c_str(), track->GetTPCNclsF());
+  SetValue((prefix + "fTPCCrossedRows").c_str(), track->GetTPCCrossedRows());
+  SetValue((prefix + "fTPCchi2").c_str(), track->GetTPCchi2());
+  SetInteger((prefix + "fITSncls").c_str(), track->GetITSNcls());
+  SetInteger((prefix + "fITSClusterMap").c_str(), track->GetITSClusterMap());
+  SetValue((prefix + "fITSchi2").c_str(), track->GetITSchi2());
+  SetValue((prefix + "fITSsignal").c_str(), track->GetITSsignal());
+  SetInteger((prefix + "fTRDncls").c_str(), track->GetTRDncls());
+  SetValue((prefix + "fTRDsignal").c_str(), track->GetTRDsignal());
+  SetValue((prefix + "fTOFsignal").c_str(), track->GetTOFsignal());
+  Float_t dz[2], cov[3];
+  track->GetImpactParameters(dz, cov);
+  SetValue((prefix + "fD").c_str(), dz[0]);
+  SetValue((prefix + "fZ").c_str(), dz[1]);
+  SetValue((prefix + "fCdd").c_str(), cov[0]);
+  SetValue((prefix + "fCdz").c_str(), cov[1]);
+  SetValue((prefix + "fCzz").c_str(), cov[2]);
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetVertex(const char *name, const AliESDVertex *vertex)
+{
+  // set the columns of AddVertex
+  if (!vertex) return;
+  string prefix(name);
+  prefix += "_";
+  Double_t pos[3], cov[6];
+  vertex->GetXYZ(pos);
+  vertex->GetCovarianceMatrix(cov);
+  SetArray((prefix + "fPosition").c_str(), pos, 3);
+  SetArray((prefix + "fCovXYZ").c_str(), cov, 6);
+  SetValue((prefix + "fChi2").c_str(), vertex->GetChi2());
+  SetInteger((prefix + "fNContributors").c_str(), vertex->GetNContributors());
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeSchema::SetV0(const char *name, const AliESDv0 *v0)
+{
+  // set the columns of AddV0
+  if (!v0) return;
+  string prefix(name);
+  prefix += "_";
+  Double_t pos[3];
+  v0->GetXYZ(pos[0], pos[1], pos[2]);
+  Double_t index[2] = {Double_t(v0->GetIndex(0)), Double_t(v0->GetIndex(1))};
+  SetArray((prefix + "fPos").c_str(), pos, 3);
+  SetValue((prefix + "fRr").c_str(), v0->GetRr());
+  SetValue((prefix + "fPt").c_str(), v0->Pt());
+  SetArray((prefix + "fIndex").c_str(), index, 2);
+  SetInteger((prefix + "fOnFlyStatus").c_str(), v0->GetOnFlyStatus());
+  SetValue((prefix + "fChi2V0").c_str(), v0->GetChi2V0());
+  SetValue((prefix + "fDcaV0Daughters").c_str(), v0->GetDcaV0Daughters());
+  SetValue((prefix + "fPointAngle").c_str(), v0->GetV0CosineOfPointingAngle());
+}
+
+//_____________________________________________________________________________
+Int_t AliFilteredTreeSchema::Fill()
+{
+  // fill the entry and reset all the columns for the next one
+  if (!fTree) {
+    AliErrorClassF("%s: Fill called before MakeTree", fName.c_str());
+    return 0;
+  }
+  Int_t nbytes = fTree->Fill();
+  std::fill(fBuffer.begin(), fBuffer.end(), 0.);
+  for (UInt_t i = 0; i < fObjects.size(); i++) fObjects[i] = fDefaults[i];
+  return nbytes;
+}
@@ -0,0 +1,112 @@
+#ifndef ALIFILTEREDTREESCHEMA_H
+#define ALIFILTEREDTREESCHEMA_H
+
+//------------------------------------------------------------------------------
+/*
+   Declared schema of one output tree of AliAnalysisTaskFilteredTree
+
+   All the columns are declared before the tree is made (MakeTree), so the
+   branch set does not depend on the first entry as with TTreeSRedirector:
+     - numeric columns and fixed size arrays are flat leaf-list branches
+       (types: 'F','D','I','i','L','l','b' as in TTree::Branch)
+     - strings are 'C' leaves
+     - objects (tracks, friend tracks, V0s, MC particles) are split object
+       branches and are optional - whole tracks can be written as flat
+       summaries instead (AddESDtrack/SetESDtrack)
+   Track parameters and vertices are in double precision by default; the
+   precision ('F'/'D'), compression and basket size can be set per column
+   (by name prefix) before MakeTree.
+
+   Usage:
+     schema.AddColumn("runNumber",'I');
+     schema.AddTrackParam("extInnerParamC");
+     schema.MakeTree(505,256000);
+     ...
+     schema.SetValue("runNumber",run);
+     schema.SetTrackParam("extInnerParamC",param);
+     schema.Fill();      // columns not set for the entry are written as 0
+*/
+//------------------------------------------------------------------------------
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "Rtypes.h"
+
+class TTree;
+class TClass;
+class TObject;
+class TVectorD;
+class AliExternalTrackParam;
+class AliESDtrack;
+class AliESDVertex;
+class AliESDv0;
+
+class AliFilteredTreeSchema {
+ public:
+  AliFilteredTreeSchema(const char *treeName = "", const char *treeTitle = "");
+  virtual ~AliFilteredTreeSchema();
+
+  // declaration
+  Int_t AddColumn(const char *name, Char_t type = 'F', Int_t size = 1);
+  Int_t AddString(const char *name, Int_t maxLength = 512);
+  Int_t AddObject(const char *name, const char *className, Int_t splitLevel = 99);
+  void  AddTrackParam(const char *name, Char_t type = 'D');
+  void  AddESDtrack(const char *name, Bool_t streamObject = kFALSE);
+  void  AddVertex(const char *name, Char_t type = 'D');
+  void  AddV0(const char *name);
+  void  SetColumnType(const char *prefix, Char_t type);
+  void  SetColumnCompression(const char *prefix, Int_t compression);
+  void  SetColumnBasketSize(const char *prefix, Int_t basketSize);
+  TTree *MakeTree(Int_t compression = -1, Int_t basketSize = 32000);
+
+  // filling
+  void  SetValue(const char *name, Double_t value);
+  void  SetInteger(const char *name, Long64_t value);
+  void  SetArray(const char *name, const Double_t *values, Int_t n);
+  void  SetArray(const char *name, const TVectorD &values);
+  void  SetString(const char *name, const char *value);
+  void  SetObject(const char *name, const TObject *object);
+  void  SetTrackParam(const char *name, const AliExternalTrackParam *param);
+  void  SetESDtrack(const char *name, const AliESDtrack *track);
+  void  SetVertex(const char *name, const AliESDVertex *vertex);
+  void  SetV0(const char *name, const AliESDv0 *v0);
+  Int_t Fill();
+
+  const char *GetName() const { return fName.c_str(); }
+  TTree *GetTree() const { return fTree; }
+  Int_t  GetNColumns() const { return fColumns.size(); }
+  Bool_t HasColumn(const char *name) const { return fIndex.count(name) > 0; }
+
+ private:
+  struct Column {
+    std::string fName;      // branch name
+    Char_t      fType;      // leaf type, 'C' for strings, 'X' for objects
+    Int_t       fSize;      // number of elements (max. length for strings)
+    Int_t       fOffset;    // offset in fBuffer (bytes, set by MakeTree), slot in fObjects for objects
+    Int_t       fSplit;     // split level of object branches
+    Int_t       fCompression; // compression settings, -1 for the tree default
+    Int_t       fBasketSize;  // basket size, 0 for the tree default
+    TClass     *fClass;     // class of object branches
+  };
+  Int_t  Declare(const char *name, Char_t type, Int_t size);
+  Column *Find(const char *name);
+  static Int_t TypeSize(Char_t type);
+
+  std::string fName;                      //! tree name
+  std::string fTitle;                     //! tree title
+  std::vector<Column> fColumns;           //! declared columns, in branch order
+  std::map<std::string, Int_t> fIndex;    //! column index by name
+  std::vector<Double_t> fBuffer;          //! values of the numeric and string columns (8-byte aligned)
+  std::vector<void*> fObjects;            //! addresses of the object columns
+  std::vector<void*> fDefaults;           //! default objects, written when no object is set
+  std::set<std::string> fUnknown;         //! undeclared names already reported
+  TTree *fTree;                           //! output tree (owned by its directory)
+
+  AliFilteredTreeSchema(const AliFilteredTreeSchema&); // not implemented
+  AliFilteredTreeSchema& operator=(const AliFilteredTreeSchema&); // not implemented
+  ClassDef(AliFilteredTreeSchema, 1); // declared schema of a filtered tree
+};
+
+#endif
@@ -47,6 +47,7 @@
 #pragma link C++ class AliPerformanceDEdx+;
 #pragma link C++ class AliPerformanceDCA+;
 #pragma link C++ class AliPerformanceTPC+;
+#pragma link C++ class AliPerformanceSparseBuffer+;
 #pragma link C++ class AliPerformanceMC+;
 #pragma link C++ class AliPerformanceMatch+;
 #pragma link C++ class AliPerformancePtCalib+;
@@ -95,6 +96,7 @@
 
 #pragma link C++ class AliAnalysisTaskFilteredTree+;
 #pragma link C++ class AliFilteredTreeEventCuts+;
+#pragma link C++ class AliFilteredTreeSchema+;
 #pragma link C++ class AliFilteredTreeAcceptanceCuts+;
 
 #pragma link C++ class AliTaskConfigOCDB+;
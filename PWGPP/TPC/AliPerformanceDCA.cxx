@@ -67,6 +67,7 @@ AliPerformanceDCA::AliPerformanceDCA(const Char_t* name, const Char_t* title,Int
 
   // DCA histograms
   fDCAHisto(0),
+  fDCABuffer(),
 
   // histogram folder 
   fAnalysisFolder(0)
@@ -167,7 +168,7 @@ void AliPerformanceDCA::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
   if (vTrack->GetTPCNcls()<fCutsRC.GetMinNClustersTPC()) return; // min. nb. TPC clusters  
  
 Double_t vDCAHisto[5]={dca[0],dca[1],etpTrack->Eta(),etpTrack->Pt(),etpTrack->Phi()};
-  fDCAHisto->Fill(vDCAHisto);
+  fDCABuffer.Fill(fDCAHisto,vDCAHisto);
 
   //
   // Fill rec vs MC information
@@ -209,7 +210,7 @@ void AliPerformanceDCA::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
   if(vTrack->GetITSclusters(0)<fCutsRC.GetMinNClustersITS()) return;  // min. nb. ITS clusters
 
   Double_t vDCAHisto[5]={dca[0],dca[1],vTrack->Eta(),vTrack->Pt(),vTrack->Phi()};
-  fDCAHisto->Fill(vDCAHisto);
+  fDCABuffer.Fill(fDCAHisto,vDCAHisto);
 
   //
   // Fill rec vs MC information
@@ -236,6 +237,7 @@ Long64_t AliPerformanceDCA::Merge(TCollection* const list)
   if (list->IsEmpty())
   return 1;
 
+  FlushOutputData();
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
 
@@ -246,6 +248,7 @@ Long64_t AliPerformanceDCA::Merge(TCollection* const list)
     AliPerformanceDCA* entry = dynamic_cast<AliPerformanceDCA*>(obj);
     if (entry == 0) continue; 
 
+    entry->FlushOutputData();
     fDCAHisto->Add(entry->fDCAHisto);
     count++;
   }
@@ -337,6 +340,7 @@ void AliPerformanceDCA::Analyse()
   // in the analysis folder "folderDCA" 
   //
   
+  FlushOutputData();
   TH1::AddDirectory(kFALSE);
   TH1F *h1D=0;
   TH2F *h2D=0;
@@ -23,6 +23,7 @@ class TRootIOCtor;
 
 #include "THnSparse.h"
 #include "AliPerformanceObject.h"
+#include "AliPerformanceSparseBuffer.h"
 
 class AliPerformanceDCA : public AliPerformanceObject {
 public :
@@ -57,7 +58,9 @@ public :
   void ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const vTrack, AliVEvent* const vEvent);
 
   // getters
-  THnSparse* GetDCAHisto() const {return fDCAHisto;}
+  THnSparse* GetDCAHisto() const {fDCABuffer.Flush(); return fDCAHisto;}
+
+  virtual void FlushOutputData() { fDCABuffer.Flush(); }
 
   // Make stat histograms
   TH1F* MakeStat1D(TH2 *hist, Int_t delta1, Int_t type);
@@ -67,6 +70,7 @@ private:
 
   // DCA histograms
   THnSparseF *fDCAHisto; //-> dca_r:dca_z:eta:pt:phi 
+  mutable AliPerformanceSparseBuffer fDCABuffer; //! buffered fills of fDCAHisto
  
   // analysis folder 
   TFolder *fAnalysisFolder; // folder for analysed histograms
@@ -74,7 +78,7 @@ private:
   AliPerformanceDCA(const AliPerformanceDCA&); // not implemented
   AliPerformanceDCA& operator=(const AliPerformanceDCA&); // not implemented
 
-  ClassDef(AliPerformanceDCA,2);
+  ClassDef(AliPerformanceDCA,3);
 };
 
 #endif
@@ -76,6 +76,7 @@ AliPerformanceDEdx::AliPerformanceDEdx(TRootIOCtor* b):
  AliPerformanceObject(b),
   // dEdx 
   fDeDxHisto(0),
+  fDeDxBuffer(),
   // histogram folder 
   fAnalysisFolder(0),
   fFolderObj(0),
@@ -96,6 +97,7 @@ AliPerformanceDEdx::AliPerformanceDEdx(const Char_t* name, const Char_t* title,
 
   // dEdx 
   fDeDxHisto(0),
+  fDeDxBuffer(),
   // histogram folder 
   fAnalysisFolder(0),
   fFolderObj(0),
@@ -304,7 +306,7 @@ void AliPerformanceDEdx::ProcessInnerTPC(AliMCEvent* const mcev, AliVTrack *cons
     
     //Double_t vDeDxHisto[10] = {dedx,phi,y,z,snp,tgl,ncls,p,TPCSignalN,nCrossedRows};
     Double_t vDeDxHisto[10] = {dedx,phi,y,z,snp,tgl,Double_t(ncls),p,Double_t(TPCSignalN),nClsF};
-    if(fUseSparse) fDeDxHisto->Fill(vDeDxHisto);
+    if(fUseSparse) fDeDxBuffer.Fill(fDeDxHisto,vDeDxHisto);
     else  FilldEdxHisotgram(vDeDxHisto);
     
     if(!mcev) return;
@@ -339,6 +341,7 @@ Long64_t AliPerformanceDEdx::Merge(TCollection* const list)
   
   Bool_t merge = ((fgUseMergeTHnSparse && fgMergeTHnSparse) || (!fgUseMergeTHnSparse && fMergeTHnSparseObj));
 
+  FlushOutputData();
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
   TObjArray* objArrayList = 0;
@@ -351,6 +354,7 @@ Long64_t AliPerformanceDEdx::Merge(TCollection* const list)
     AliPerformanceDEdx* entry = dynamic_cast<AliPerformanceDEdx*>(obj);
     if (entry == 0) continue; 
     if (merge) {
+        entry->FlushOutputData();
         if ((fDeDxHisto) && (entry->fDeDxHisto)) { fDeDxHisto->Add(entry->fDeDxHisto); }        
     }
     // the analysisfolder is only merged if present
@@ -467,6 +471,7 @@ void AliPerformanceDEdx::Analyse()
   //fai fit con range p(.32,.38) and dEdx(65- 120 or 100) e ripeti cosa fatta per pion e fai trending della media e res, poio la loro differenza
   //fai dedx vs lamda ma for e e pion separati
   //
+  FlushOutputData();
   TH1::AddDirectory(kFALSE);
   TH1::SetDefaultSumw2(kFALSE);
     if(fUseSparse){
@@ -698,6 +703,7 @@ void AliPerformanceDEdx::FilldEdxHisotgram(double *vDeDxHisto){
 void AliPerformanceDEdx::ResetOutputData(){
 
     if(fUseSparse){
+        fDeDxBuffer.Clear();
         if(fDeDxHisto) fDeDxHisto->Reset("ICE");
     }
     else{
@@ -23,6 +23,7 @@ class TRootIOCtor;
 
 #include "THnSparse.h"
 #include "AliPerformanceObject.h"
+#include "AliPerformanceSparseBuffer.h"
 
 class AliPerformanceDEdx : public AliPerformanceObject {
 public :
@@ -70,11 +71,12 @@ public :
   //
   // TPC dE/dx 
   //
-  THnSparse* GetDeDxHisto() const {return fDeDxHisto;}
+  THnSparse* GetDeDxHisto() const {fDeDxBuffer.Flush(); return fDeDxHisto;}
   TObjArray* GetHistos() const { return fFolderObj; }
   TCollection* GetListOfDrawableObjects();
     
   virtual void ResetOutputData();
+  virtual void FlushOutputData() { fDeDxBuffer.Flush(); }
 
 private:
 
@@ -83,6 +85,7 @@ private:
   
   // TPC dE/dx 
   THnSparseF *fDeDxHisto; //-> signal:phi:y:z:snp:tgl:ncls:p:nclsDEdx:nclsF
+  mutable AliPerformanceSparseBuffer fDeDxBuffer; //! buffered fills of fDeDxHisto
   // analysis folder 
   TFolder *fAnalysisFolder; // folder for analysed histograms
   
@@ -98,7 +101,7 @@ private:
   AliPerformanceDEdx(const AliPerformanceDEdx&); // not implemented
   AliPerformanceDEdx& operator=(const AliPerformanceDEdx&); // not implemented
 
-  ClassDef(AliPerformanceDEdx,8);
+  ClassDef(AliPerformanceDEdx,9);
 };
 
 #endif
@@ -64,6 +64,8 @@ AliPerformanceEff::AliPerformanceEff(TRootIOCtor* b):
   // histograms
   fEffHisto(NULL),
   fEffSecHisto(NULL),
+  fEffBuffer(),
+  fEffSecBuffer(),
   fTrackPtNCls(NULL),
   fTrackNClsFound(NULL),
   // histogram folder 
@@ -81,6 +83,8 @@ AliPerformanceEff::AliPerformanceEff(const Char_t* name, const Char_t* title, In
   // histograms
   fEffHisto(NULL),
   fEffSecHisto(NULL),
+  fEffBuffer(),
+  fEffSecBuffer(),
   fTrackPtNCls(NULL),
   fTrackNClsFound(NULL),
 
@@ -326,7 +330,7 @@ void AliPerformanceEff::ProcessTPC(AliMCEvent* const mcEvent, AliVEvent *const v
 
     // Fill histograms
     Double_t vEffHisto[9] = {mceta, mcphi, mcpt, static_cast<Double_t>(pid), static_cast<Double_t>(recStatus), static_cast<Double_t>(findable), static_cast<Double_t>(charge), static_cast<Double_t>(nClones), static_cast<Double_t>(nFakes)}; 
-    fEffHisto->Fill(vEffHisto);
+    fEffBuffer.Fill(fEffHisto,vEffHisto);
   }
   if(labelsRec) delete [] labelsRec; labelsRec = 0;
   if(labelsAllRec) delete [] labelsAllRec; labelsAllRec = 0;
@@ -488,7 +492,7 @@ void AliPerformanceEff::ProcessTPCSec(AliMCEvent* const mcEvent, AliVEvent *cons
 	
 	// Fill histograms
 	Double_t vEffSecHisto[12] = { mceta, mcphi, mcpt, static_cast<Double_t>(pid), static_cast<Double_t>(recStatus), static_cast<Double_t>(findable), mcR, mother_phi, mother_eta, static_cast<Double_t>(charge), static_cast<Double_t>(nClones), static_cast<Double_t>(nFakes) }; 
-	fEffSecHisto->Fill(vEffSecHisto);
+	fEffSecBuffer.Fill(fEffSecHisto,vEffSecHisto);
       }
   }
   
@@ -595,7 +599,7 @@ void AliPerformanceEff::ProcessTPCITS(AliMCEvent* const mcEvent, AliVEvent *cons
     
     // Fill histograms
     Double_t vEffHisto[9] = { mceta, mcphi, mcpt, static_cast<Double_t>(pid), static_cast<Double_t>(recStatus), static_cast<Double_t>(findable), static_cast<Double_t>(charge), static_cast<Double_t>(nClones), static_cast<Double_t>(nFakes)}; 
-    fEffHisto->Fill(vEffHisto);
+    fEffBuffer.Fill(fEffHisto,vEffHisto);
   }
 
   if(labelsRecTPCITS) delete [] labelsRecTPCITS; labelsRecTPCITS = 0;
@@ -697,7 +701,7 @@ void AliPerformanceEff::ProcessConstrained(AliMCEvent* const mcEvent, AliVEvent
 
     // Fill histograms
     Double_t vEffHisto[9] = { mceta, mcphi, mcpt, static_cast<Double_t>(pid), static_cast<Double_t>(recStatus), static_cast<Double_t>(findable), static_cast<Double_t>(charge), static_cast<Double_t>(nClones), static_cast<Double_t>(nFakes) }; 
-    fEffHisto->Fill(vEffHisto);
+    fEffBuffer.Fill(fEffHisto,vEffHisto);
   }
 
   if(labelsRecConstrained) delete [] labelsRecConstrained; labelsRecConstrained = 0;
@@ -888,6 +892,7 @@ Long64_t AliPerformanceEff::Merge(TCollection* const list)
   if (list->IsEmpty())
   return 1;
 
+  FlushOutputData();
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
 
@@ -899,6 +904,7 @@ Long64_t AliPerformanceEff::Merge(TCollection* const list)
     AliPerformanceEff* entry = dynamic_cast<AliPerformanceEff*>(obj);
     if (entry == 0) continue; 
   
+    entry->FlushOutputData();
     fEffHisto->Add(entry->fEffHisto);
     fEffSecHisto->Add(entry->fEffSecHisto);
     if (fTrackPtNCls && entry->fTrackPtNCls) fTrackPtNCls->Add(entry->fTrackPtNCls);
@@ -915,6 +921,7 @@ void AliPerformanceEff::Analyse()
   // Analyse comparison information and store output histograms
   // in the folder "folderEff" 
   //
+  FlushOutputData();
   TH1::AddDirectory(kFALSE);
   TObjArray *aFolderObj = new TObjArray;
   if(!aFolderObj) return;
@@ -24,6 +24,7 @@ class AliVtrack;
 class TRootIOCtor;
 
 #include "AliPerformanceObject.h"
+#include "AliPerformanceSparseBuffer.h"
 
 class AliPerformanceEff : public AliPerformanceObject {
 public :
@@ -66,8 +67,10 @@ public :
   Bool_t HasTPCReference(const AliMCEvent *mcEvent, Int_t label);
   Int_t TransformToPID(TParticle *mcPart);
 
-  THnSparseF* GetEffHisto() const {return fEffHisto;}
-  THnSparseF* GetEffSecHisto() const {return fEffSecHisto;}
+  THnSparseF* GetEffHisto() const {fEffBuffer.Flush(); return fEffHisto;}
+  THnSparseF* GetEffSecHisto() const {fEffSecBuffer.Flush(); return fEffSecHisto;}
+
+  virtual void FlushOutputData() { fEffBuffer.Flush(); fEffSecBuffer.Flush(); }
   
   static void SetfReadNClsTree(bool v) {fReadNClsTree = v;}
 
@@ -82,6 +85,8 @@ private:
   // Control histograms
   THnSparseF *fEffHisto; //-> mceta:mcphi:mcpt:pid:isPrim:recStatus:findable:charge
   THnSparseF *fEffSecHisto; //-> mceta:mcphi:mcpt:pid:isPrim:recStatus:findable:mcR:mother_phi:mother_eta:charge
+  mutable AliPerformanceSparseBuffer fEffBuffer; //! buffered fills of fEffHisto
+  mutable AliPerformanceSparseBuffer fEffSecBuffer; //! buffered fills of fEffSecHisto
   
   TH1D* fTrackPtNCls; //
   TH2D* fTrackNClsFound; //
@@ -97,7 +102,7 @@ private:
   AliPerformanceEff(const AliPerformanceEff&); // not implemented
   AliPerformanceEff& operator=(const AliPerformanceEff&); // not implemented
 
-  ClassDef(AliPerformanceEff,4);
+  ClassDef(AliPerformanceEff,5);
 };
 
 #endif
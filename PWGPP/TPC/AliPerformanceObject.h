@@ -117,6 +117,9 @@ public :
   Bool_t IsUseTOFBunchCrossing() { return fUseTOFBunchCrossing; }
 
   virtual void ResetOutputData() { ; }
+
+  // Insert the buffered fills (AliPerformanceSparseBuffer) into the output histograms
+  virtual void FlushOutputData() { ; }
     
 protected: 
 
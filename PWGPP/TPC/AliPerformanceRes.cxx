@@ -71,6 +71,8 @@ AliPerformanceRes::AliPerformanceRes(TRootIOCtor* b):
   AliPerformanceObject(b),
   fResolHisto(0),
   fPullHisto(0),
+  fResolBuffer(),
+  fPullBuffer(),
 
   // histogram folder 
   fAnalysisFolder(0),
@@ -85,6 +87,8 @@ AliPerformanceRes::AliPerformanceRes(const Char_t* name, const Char_t* title, In
   AliPerformanceObject(name,title),
   fResolHisto(0),
   fPullHisto(0),
+  fResolBuffer(),
+  fPullBuffer(),
 
   // histogram folder 
   fAnalysisFolder(0),
@@ -314,10 +318,10 @@ void AliPerformanceRes::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
     else pull1PtTPC = 0.; 
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,particle->Vy(),particle->Vz(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    fResolBuffer.Fill(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    fPullBuffer.Fill(fPullHisto,vPullHisto);
   }
 }
 
@@ -410,10 +414,10 @@ void AliPerformanceRes::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,particle->Vy(),particle->Vz(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    fResolBuffer.Fill(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    fPullBuffer.Fill(fPullHisto,vPullHisto);
 
    
     /*
@@ -437,10 +441,10 @@ void AliPerformanceRes::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,delta1PtTPC,particle->Vy(),particle->Vz(),mceta,mcphi,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    fResolBuffer.Fill(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mceta,mcphi,mcpt};
-    fPullHisto->Fill(vPullHisto);
+    fPullBuffer.Fill(fPullHisto,vPullHisto);
     */
   }
 }
@@ -536,10 +540,10 @@ void AliPerformanceRes::ProcessConstrained(AliMCEvent* const mcev, AliVTrack *co
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,particle->Vy(),particle->Vz(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    fResolBuffer.Fill(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    fPullBuffer.Fill(fPullHisto,vPullHisto);
 
     /*
 
@@ -564,10 +568,10 @@ void AliPerformanceRes::ProcessConstrained(AliMCEvent* const mcev, AliVTrack *co
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,delta1PtTPC,particle->Vy(),particle->Vz(),mceta,mcphi,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    fResolBuffer.Fill(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mceta,mcphi,mcpt};
-    fPullHisto->Fill(vPullHisto);
+    fPullBuffer.Fill(fPullHisto,vPullHisto);
 
     */
   }
@@ -738,10 +742,10 @@ void AliPerformanceRes::ProcessInnerTPC(AliMCEvent *const mcEvent, AliVTrack *co
     }
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,ref0->Y(),ref0->Z(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    fResolBuffer.Fill(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,ref0->Y(),ref0->Z(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    fPullBuffer.Fill(fPullHisto,vPullHisto);
   }
 
   if(track) delete track;
@@ -860,10 +864,10 @@ void AliPerformanceRes::ProcessOuterTPC(AliMCEvent *const mcEvent, AliVTrack *co
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,ref0->Y(),ref0->Z(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    fResolBuffer.Fill(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,ref0->Y(),ref0->Z(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    fPullBuffer.Fill(fPullHisto,vPullHisto);
   }
 
   if(track) delete track;
@@ -1103,6 +1107,7 @@ void AliPerformanceRes::Analyse() {
   // Analyse comparison information and store output histograms
   // in the folder "folderRes"
   //
+  FlushOutputData();
   TH1::AddDirectory(kFALSE);
   TH1F *h=0;
   TH2F *h2D=0;
@@ -1260,6 +1265,7 @@ Long64_t AliPerformanceRes::Merge(TCollection* const list)
   if (list->IsEmpty())
   return 1;
 
+  FlushOutputData();
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
 
@@ -1270,6 +1276,7 @@ Long64_t AliPerformanceRes::Merge(TCollection* const list)
   AliPerformanceRes* entry = dynamic_cast<AliPerformanceRes*>(obj);
   if (entry == 0) continue; 
   if (fResolHisto->GetEntries()<fgkMergeEntriesCut){
+    entry->FlushOutputData();
     fResolHisto->Add(entry->fResolHisto);  
     fPullHisto->Add(entry->fPullHisto);
   }
@@ -27,6 +27,7 @@ class TRootIOCtor;
 
 #include "THnSparse.h"
 #include "AliPerformanceObject.h"
+#include "AliPerformanceSparseBuffer.h"
 
 class AliPerformanceRes : public AliPerformanceObject {
 public :
@@ -69,8 +70,9 @@ public :
 
   // getters
   //
-  THnSparse *GetResolHisto() const  { return fResolHisto; }
-  THnSparse *GetPullHisto()  const  { return fPullHisto; }
+  THnSparse *GetResolHisto() const  { fResolBuffer.Flush(); return fResolHisto; }
+  THnSparse *GetPullHisto()  const  { fPullBuffer.Flush(); return fPullHisto; }
+  virtual void FlushOutputData() { fResolBuffer.Flush(); fPullBuffer.Flush(); }
   static void SetMergeEntriesCut(Double_t entriesCut){fgkMergeEntriesCut = entriesCut;}
   
   struct comparisonContainer
@@ -91,6 +93,10 @@ private:
   //THnSparseF *fPullHisto;  //-> pull_y:pull_z:pull_phi:pull_lambda:pull_1pt:y:z:eta:phi:pt
   THnSparseF *fPullHisto;  //-> pull_y:pull_z:pull_snp:pull_tgl:pull_1pt:y:z:snp:tgl:1pt
 
+  // buffered fills of fResolHisto and fPullHisto
+  mutable AliPerformanceSparseBuffer fResolBuffer; //!
+  mutable AliPerformanceSparseBuffer fPullBuffer;  //!
+
   // analysis folder 
   TFolder *fAnalysisFolder; // folder for analysed histograms
 
@@ -100,7 +106,7 @@ private:
   char* fValidLabels; //!
   comparisonContainer* fComparisonContainer; //!
   
-  ClassDef(AliPerformanceRes,4);
+  ClassDef(AliPerformanceRes,5);
 };
 
 #endif
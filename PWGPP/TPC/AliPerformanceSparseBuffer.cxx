@@ -0,0 +1,152 @@
+/**************************************************************************
+* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+//------------------------------------------------------------------------------
+// Implementation of the AliPerformanceSparseBuffer class. It buffers the
+// THnSparse fills of the AliPerformance* objects and inserts them in bulk.
+//------------------------------------------------------------------------------
+
+#include "TAxis.h"
+#include "THnSparse.h"
+
+#include "AliPerformanceSparseBuffer.h"
+
+ClassImp(AliPerformanceSparseBuffer)
+
+Int_t AliPerformanceSparseBuffer::fgMaxBins = 1<<14;
+
+namespace {
+  //_____________________________________________________________________________
+  Int_t NBits(Int_t nValues)
+  {
+    // number of bits to store values 0..nValues-1
+    Int_t nbits = 0;
+    while ((1LL << nbits) < nValues) nbits++;
+    return nbits;
+  }
+}
+
+//_____________________________________________________________________________
+AliPerformanceSparseBuffer::AliPerformanceSparseBuffer():
+  fHisto(0),
+  fPacked(kFALSE),
+  fWord(),
+  fShift(),
+  fNBits(),
+  fKeys(),
+  fSumw(),
+  fNFills(0),
+  fIndex()
+{
+  // default constructor, the histogram is attached at the first fill
+}
+
+//_____________________________________________________________________________
+void AliPerformanceSparseBuffer::Attach(THnSparse *histo)
+{
+  // flush the fills of the previous histogram and prepare the packing of the coordinates
+  Flush();
+  fHisto = histo;
+  fPacked = kFALSE;
+  fWord.clear();
+  fShift.clear();
+  fNBits.clear();
+  if (!fHisto) return;
+
+  // with errors THnBase::Fill also sums w*x and w*x*x per axis, which can only
+  // be set through Fill itself: such histograms are filled directly
+  Int_t ndim = fHisto->GetNdimensions();
+  Int_t word = 0, shift = 0;
+  fPacked = !fHisto->GetCalculateErrors();
+  for (Int_t d = 0; d < ndim; d++) {
+    Int_t nbits = NBits(fHisto->GetAxis(d)->GetNbins() + 2); // with under- and overflow
+    if (shift + nbits > 64) {
+      word++;
+      shift = 0;
+    }
+    if (word > 1 || nbits > 32) fPacked = kFALSE;
+    fWord.push_back(word);
+    fShift.push_back(shift);
+    fNBits.push_back(nbits);
+    shift += nbits;
+  }
+}
+
+//_____________________________________________________________________________
+void AliPerformanceSparseBuffer::Fill(THnSparse *histo, const Double_t *x, Double_t w)
+{
+  // same as histo->Fill(x,w), buffered
+  if (!histo) return;
+  if (histo != fHisto) Attach(histo);
+  else if (fPacked && histo->GetCalculateErrors()) Attach(histo); // Sumw2 called since the last fill
+  if (!fPacked || fgMaxBins <= 0) {
+    histo->Fill(x, w);
+    return;
+  }
+
+  // bin coordinates as in THnSparse::GetBin(const Double_t*)
+  Int_t ndim = fShift.size();
+  Key key = {{0, 0}};
+  for (Int_t d = 0; d < ndim; d++) {
+    ULong64_t bin = fHisto->GetAxis(d)->FindBin(x[d]);
+    key.fWord[fWord[d]] |= bin << fShift[d];
+  }
+
+  std::unordered_map<Key, Int_t, KeyHash>::iterator it = fIndex.find(key);
+  Int_t index = 0;
+  if (it == fIndex.end()) {
+    index = fKeys.size();
+    fIndex[key] = index;
+    fKeys.push_back(key);
+    fSumw.push_back(0.);
+  } else {
+    index = it->second;
+  }
+  fSumw[index] += w;
+  fNFills++;
+
+  if ((Int_t)fKeys.size() >= fgMaxBins) Flush();
+}
+
+//_____________________________________________________________________________
+void AliPerformanceSparseBuffer::Flush()
+{
+  // insert the buffered bins in order of their first fill, so that the
+  // histogram allocates its bins in the same order as with direct filling
+  if (!fHisto || fNFills == 0) return;
+
+  Int_t ndim = fShift.size();
+  std::vector<Int_t> coord(ndim);
+  Double_t entries = fHisto->GetEntries();
+  for (UInt_t i = 0; i < fKeys.size(); i++) {
+    for (Int_t d = 0; d < ndim; d++) {
+      coord[d] = (fKeys[i].fWord[fWord[d]] >> fShift[d]) & ((1ULL << fNBits[d]) - 1);
+    }
+    Long64_t bin = fHisto->GetBin(&coord[0], kTRUE);
+    fHisto->AddBinContent(bin, fSumw[i]);
+  }
+  fHisto->SetEntries(entries + fNFills);
+  Clear();
+}
+
+//_____________________________________________________________________________
+void AliPerformanceSparseBuffer::Clear()
+{
+  // drop the buffered fills
+  fKeys.clear();
+  fSumw.clear();
+  fIndex.clear();
+  fNFills = 0;
+}
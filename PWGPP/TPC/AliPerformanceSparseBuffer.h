@@ -0,0 +1,78 @@
+#ifndef ALIPERFORMANCESPARSEBUFFER_H
+#define ALIPERFORMANCESPARSEBUFFER_H
+
+//------------------------------------------------------------------------------
+// Fill buffer of a THnSparse used by the AliPerformance* QA objects.
+//
+// THnSparse::Fill hashes the compacted bin coordinates and updates the bin
+// chunks for every track. The buffer collects the fills as packed bin
+// coordinates with summed weights (in order of first appearance) and inserts
+// them in bulk (Flush) with the public THnSparse interface: one GetBin and
+// AddBinContent per distinct bin instead of one per fill. Bin numbering,
+// contents and entries are the same as with direct filling (up to the
+// rounding of the summation order), so the output objects are unchanged.
+// Histograms with errors (Sumw2) also keep unbinned statistics that only
+// THnBase::Fill updates, and histograms whose coordinates do not fit in 128
+// bits are filled directly. See macros/BenchmarkPerformanceSparseBuffer.C.
+//
+// The owner flushes before the histogram is used (Analyse, Merge, getters);
+// the buffer is also flushed when it holds GetMaxBins() distinct bins.
+//------------------------------------------------------------------------------
+
+#include <functional>
+#include <vector>
+#include <unordered_map>
+#include "Rtypes.h"
+
+class THnSparse;
+
+class AliPerformanceSparseBuffer {
+public :
+  AliPerformanceSparseBuffer();
+  virtual ~AliPerformanceSparseBuffer() {}
+
+  // fill histo at x with weight w (buffered)
+  void Fill(THnSparse *histo, const Double_t *x, Double_t w = 1.);
+  // insert the buffered fills into the histogram
+  void Flush();
+  // drop the buffered fills (histogram reset)
+  void Clear();
+
+  Long64_t GetNFills() const { return fNFills; }
+  Int_t GetNBins() const { return fKeys.size(); }
+
+  // max. number of distinct bins kept before a flush, 0 - fill directly
+  static void  SetMaxBins(Int_t maxBins) { fgMaxBins = maxBins; }
+  static Int_t GetMaxBins() { return fgMaxBins; }
+
+private:
+  // bin coordinates packed in two words, no axis crosses a word boundary
+  struct Key {
+    ULong64_t fWord[2];
+    bool operator==(const Key &other) const { return fWord[0] == other.fWord[0] && fWord[1] == other.fWord[1]; }
+  };
+  struct KeyHash {
+    size_t operator()(const Key &key) const { return std::hash<ULong64_t>()(key.fWord[0] ^ (key.fWord[1] * 0x9E3779B97F4A7C15ULL)); }
+  };
+
+  void Attach(THnSparse *histo);
+
+  static Int_t fgMaxBins;     // max. number of distinct buffered bins
+
+  THnSparse *fHisto;          //! buffered histogram (not owned)
+  Bool_t fPacked;             //! coordinates fit in the key and the histogram has no errors
+  std::vector<Int_t> fWord;   //! key word of each axis
+  std::vector<Int_t> fShift;  //! bit offset of each axis in its word
+  std::vector<Int_t> fNBits;  //! number of bits of each axis
+  std::vector<Key> fKeys;     //! packed coordinates, in order of first fill
+  std::vector<Double_t> fSumw;    //! sum of weights per key
+  Long64_t fNFills;           //! number of buffered fills
+  std::unordered_map<Key, Int_t, KeyHash> fIndex; //! key -> position in fKeys
+
+  AliPerformanceSparseBuffer(const AliPerformanceSparseBuffer&); // not implemented
+  AliPerformanceSparseBuffer& operator=(const AliPerformanceSparseBuffer&); // not implemented
+
+  ClassDef(AliPerformanceSparseBuffer,2);
+};
+
+#endif
@@ -85,6 +85,8 @@ AliPerformanceTPC::AliPerformanceTPC(TRootIOCtor*):
   fTPCClustHisto(0),
   fTPCEventHisto(0),
   fTPCTrackHisto(0),
+  fTPCClustBuffer(),
+  fTPCTrackBuffer(),
   fFolderObj(0),
 
   // histogram folder
@@ -129,6 +131,8 @@ AliPerformanceTPC::AliPerformanceTPC(const Char_t* name, const Char_t* title,Int
   fTPCClustHisto(0),
   fTPCEventHisto(0),
   fTPCTrackHisto(0),
+  fTPCClustBuffer(),
+  fTPCTrackBuffer(),
   fFolderObj(0),
 
   // histogram folder 
@@ -629,7 +633,7 @@ void AliPerformanceTPC::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
     else if(q < 0.000001) fMultN++;
     
     if(fUseSparse) {
-      fTPCTrackHisto->Fill(vTPCTrackHisto);
+      fTPCTrackBuffer.Fill(fTPCTrackHisto,vTPCTrackHisto);
     } else {
         if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
         if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
@@ -729,7 +733,7 @@ void AliPerformanceTPC::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     else if(q < 0.000001) fMultN++;
     
     if(fUseSparse) {
-      fTPCTrackHisto->Fill(vTPCTrackHisto);
+      fTPCTrackBuffer.Fill(fTPCTrackHisto,vTPCTrackHisto);
     } else {
         if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
         if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
@@ -902,7 +906,7 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
 	    //Int_t detector = cluster->GetDetector();
 	    //Double_t vTPCClust[6] = { irow, phi, TPCside, pad, detector, gclf[2] };
 	    Double_t vTPCClust[3] = { static_cast<Double_t>(irow), phi, static_cast<Double_t>(TPCside) };
-	    if(fUseSparse) fTPCClustHisto->Fill(vTPCClust);
+	    if(fUseSparse) fTPCClustBuffer.Fill(fTPCClustHisto,vTPCClust);
 	    else{
 	      h_tpc_clust_0_1_2->Fill(vTPCClust[0],vTPCClust[1],vTPCClust[2]);
 	    }
@@ -949,6 +953,7 @@ void AliPerformanceTPC::Analyse()
 //    TH1::AddDirectory(kFALSE);
 //    TH1::SetDefaultSumw2(kFALSE);
 
+    FlushOutputData();
     if(fUseSparse){
         TObjArray *aFolderObj = new TObjArray;
         TString selString;
@@ -1109,6 +1114,7 @@ Long64_t AliPerformanceTPC::Merge(TCollection* list)
   
   Bool_t merge = ((fgUseMergeTHnSparse && fgMergeTHnSparse) || (!fgUseMergeTHnSparse && fMergeTHnSparseObj));
 
+  FlushOutputData();
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
   TObjArray* objArrayList = 0;
@@ -1121,6 +1127,7 @@ Long64_t AliPerformanceTPC::Merge(TCollection* list)
     AliPerformanceTPC* entry = dynamic_cast<AliPerformanceTPC*>(obj);
     if (entry == 0) continue; 
     if (merge) {
+        entry->FlushOutputData();
         if ((fTPCClustHisto) && (entry->fTPCClustHisto)) { fTPCClustHisto->Add(entry->fTPCClustHisto); }
         if ((fTPCEventHisto) && (entry->fTPCEventHisto)) { fTPCEventHisto->Add(entry->fTPCEventHisto); }
         if ((fTPCTrackHisto) && (entry->fTPCTrackHisto)) { fTPCTrackHisto->Add(entry->fTPCTrackHisto); }
@@ -1164,6 +1171,8 @@ TTree* AliPerformanceTPC::CreateSummary()
 void AliPerformanceTPC::ResetOutputData(){
 
     if(fUseSparse){
+        fTPCClustBuffer.Clear();
+        fTPCTrackBuffer.Clear();
         if(fTPCClustHisto) fTPCClustHisto->Reset("ICE");
         if(fTPCEventHisto) fTPCEventHisto->Reset("ICE");
         if(fTPCTrackHisto) fTPCTrackHisto->Reset("ICE");
@@ -30,6 +30,7 @@ class TRootIOCtor;
 
 #include "THnSparse.h"
 #include "AliPerformanceObject.h"
+#include "AliPerformanceSparseBuffer.h"
 
 class AliPerformanceTPC : public AliPerformanceObject {
 public :
@@ -68,9 +69,9 @@ public :
 
   // getters
   //
-  THnSparse *GetTPCClustHisto() const  { return fTPCClustHisto; }
+  THnSparse *GetTPCClustHisto() const  { fTPCClustBuffer.Flush(); return fTPCClustHisto; }
   THnSparse *GetTPCEventHisto() const  { return fTPCEventHisto; }
-  THnSparse *GetTPCTrackHisto() const  { return fTPCTrackHisto; }
+  THnSparse *GetTPCTrackHisto() const  { fTPCTrackBuffer.Flush(); return fTPCTrackHisto; }
   
   TObjArray* GetHistos() const { return fFolderObj; }
   
@@ -81,6 +82,7 @@ public :
   Bool_t GetUseHLT() { return fUseHLT; }
   TCollection* GetListOfDrawableObjects();
   virtual void ResetOutputData();
+  virtual void FlushOutputData() { fTPCClustBuffer.Flush(); fTPCTrackBuffer.Flush(); }
 
     
 private:
@@ -92,6 +94,8 @@ private:
   THnSparseF *fTPCClustHisto; //-> padRow:phi:TPCside
   THnSparseF *fTPCEventHisto;  //-> Xv:Yv:Zv:mult:multP:multN:vertStatus
   THnSparseF *fTPCTrackHisto;  //-> nClust:chi2PerClust:nClust/nFindableClust:DCAr:DCAz:eta:phi:pt:charge:vertStatus
+  mutable AliPerformanceSparseBuffer fTPCClustBuffer; //! buffered fills of fTPCClustHisto
+  mutable AliPerformanceSparseBuffer fTPCTrackBuffer; //! buffered fills of fTPCTrackHisto (fTPCEventHisto is filled once per event)
   TObjArray* fFolderObj; // array of analysed histograms
 
   // analysis folder 
@@ -135,7 +139,7 @@ private:
   AliPerformanceTPC(const AliPerformanceTPC&); // not implemented
   AliPerformanceTPC& operator=(const AliPerformanceTPC&); // not implemented
 
-  ClassDef(AliPerformanceTPC,15);
+  ClassDef(AliPerformanceTPC,16);
 };
 
 #endif
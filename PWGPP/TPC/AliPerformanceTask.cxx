@@ -343,6 +343,7 @@ void AliPerformanceTask::FinishTaskOutput()
       itOut->Reset();
       while(( pObj = dynamic_cast<AliPerformanceObject*>(itOut->Next())) != NULL) {
           //pObj->SetRunNumber(fCurrentRunNumber);
+          pObj->FlushOutputData();
           pObj->Analyse();
       }
     
@@ -39,7 +39,12 @@
 #include <TRandom.h>
 #include <TProfile.h>
 #include <TProfile2D.h>
+#include <TRandom3.h>
 #include <AliLog.h>
+#include <vector>
+#if __cplusplus >= 201103L
+#include <thread>
+#endif
 
 ClassImp(AliMultiplicityCorrection)
 
@@ -59,6 +64,493 @@ Double_t AliMultiplicityCorrection::fgVtxRangeEnd[kESDHists] =   {  10.0,  5.5,
 Int_t AliMultiplicityCorrection::fgQualityRegionsB[kQualityRegions] = {1,  20, 70};
 Int_t AliMultiplicityCorrection::fgQualityRegionsE[kQualityRegions] = {10, 65, 80};
 
+namespace {
+  //
+  // Regularized chi2 unfolding with analytic gradient and Hessian (ApplyChi2Fit, Chi2StatisticalUncertainty,
+  // ScanChi2Regularization). The inputs are copied once into plain arrays, so that the independent fits
+  // (randomized inputs, regularization weights) run on several threads without creating ROOT objects
+  //
+  struct Chi2Input { // shared by all the threads, read only
+    Int_t                 fNMeasured;     // number of measured bins
+    Int_t                 fNTrue;         // number of unfolded bins
+    std::vector<Double_t> fCorrelation;   // response counts, fNTrue x fNMeasured (true bin major)
+    std::vector<Double_t> fEfficiency;    // efficiency per true bin
+    std::vector<Double_t> fMeasured;      // measured spectrum
+    std::vector<Double_t> fError;         // error of the measured spectrum
+    std::vector<Double_t> fInitial;       // start values, empty: measured spectrum corrected for efficiency
+    Double_t              fNotFound;      // events without vertex (constraint on the inefficiency), 0: no constraint
+    Int_t                 fRegType;       // AliUnfolding::RegularizationType
+    Bool_t                fRandomizeMeasured;
+    Bool_t                fRandomizeResponse;
+    std::vector<Double_t> fWeight;        // regularization weight of each fit
+    std::vector<UInt_t>   fSeed;          // random seed of each fit, 0: original inputs
+  };
+
+  struct Chi2Output {
+    std::vector<Double_t> fResult;        // unfolded spectrum
+    std::vector<Double_t> fError;         // errors from the covariance matrix 2 H^-1
+    Double_t              fChi2;          // chi2 of the measured spectrum at the minimum
+    Double_t              fPenalty;       // regularization term at the minimum (without weight)
+    Int_t                 fStatus;        // 0: converged
+  };
+
+  struct Chi2Problem { // chi2(u) = fC - fB.u + u.fH.u/2 + weight * penalty(u)
+    Int_t                 fN;             // number of unfolded bins
+    std::vector<Double_t> fH;             // Hessian of the measured part, 2 A^T V^-1 A, fN x fN
+    std::vector<Double_t> fB;             // 2 A^T V^-1 y
+    Double_t              fC;             // y^T V^-1 y
+    Double_t              fScale;         // integral of the measured spectrum
+    Double_t              fMinimum;       // lower bound of the unfolded values
+    std::vector<Double_t> fPrior;         // a priori distribution of kEntropy (normalized start values)
+    Int_t                 fRegType;
+    Double_t              fWeight;
+  };
+
+  //____________________________________________________________________
+  void BuildProblem(const Chi2Input& in, const std::vector<Double_t>& correlation, const std::vector<Double_t>& measured, const std::vector<Double_t>& error, Chi2Problem& p)
+  {
+    //
+    // response A(m,t) = P(m|t) * efficiency(t) from the counts, and the quadratic part of the chi2.
+    // The events without vertex give one more measurement : sum_t (1 - efficiency(t)) u(t)
+    //
+
+    const Int_t nT = in.fNTrue;
+    const Int_t nM = in.fNMeasured;
+    std::vector<Double_t> response(nT * nM, 0.);
+    for (Int_t t=0; t<nT; ++t)
+    {
+      Double_t sum = 0;
+      for (Int_t m=0; m<nM; ++m)
+        sum += correlation[t * nM + m];
+      if (sum <= 0 || in.fEfficiency[t] <= 0)
+        continue;
+      for (Int_t m=0; m<nM; ++m)
+        response[t * nM + m] = correlation[t * nM + m] / sum * in.fEfficiency[t];
+    }
+
+    p.fN = nT;
+    p.fH.assign(nT * nT, 0.);
+    p.fB.assign(nT, 0.);
+    p.fC = 0;
+    p.fScale = 0;
+
+    std::vector<Double_t> row(nT);
+    for (Int_t m=0; m<=nM; ++m)
+    {
+      Double_t value = 0, sigma = 0;
+      if (m < nM)
+      {
+        for (Int_t t=0; t<nT; ++t)
+          row[t] = response[t * nM + m];
+        value = measured[m];
+        sigma = error[m];
+        p.fScale += value;
+      }
+      else
+      {
+        if (in.fNotFound <= 0)
+          break;
+        for (Int_t t=0; t<nT; ++t)
+          row[t] = 1 - in.fEfficiency[t];
+        value = in.fNotFound;
+        sigma = TMath::Sqrt(in.fNotFound);
+      }
+      // empty bins count with an error of 1
+      Double_t weight = 1.0 / TMath::Max(sigma * sigma, 1.);
+
+      p.fC += weight * value * value;
+      for (Int_t i=0; i<nT; ++i)
+      {
+        if (row[i] == 0)
+          continue;
+        p.fB[i] += 2 * weight * row[i] * value;
+        Double_t wi = 2 * weight * row[i];
+        for (Int_t j=i; j<nT; ++j)
+          p.fH[i * nT + j] += wi * row[j];
+      }
+    }
+    for (Int_t i=0; i<nT; ++i)
+      for (Int_t j=0; j<i; ++j)
+        p.fH[i * nT + j] = p.fH[j * nT + i];
+
+    p.fMinimum = 1e-10 * TMath::Max(p.fScale, 1.);
+    p.fRegType = in.fRegType;
+  }
+
+  //____________________________________________________________________
+  Double_t Penalty(const Chi2Problem& p, const std::vector<Double_t>& u, std::vector<Double_t>* grad, std::vector<Double_t>* hess)
+  {
+    //
+    // regularization term; adds weight * gradient and weight * Hessian if requested
+    // same definitions and factors as AliUnfolding::RegularizationPol0, Pol1, Log and Entropy:
+    //   kPol0    : sum (1 - u_t-1 / u_t)^2 / 100                                     (prefers a constant)
+    //   kPol1    : sum ((u_t - u_t-1) - (u_t-1 - u_t-2))^2 / u_t-1^2                 (prefers a straight line)
+    //   kLog     : sum ((ln u_t - ln u_t-1) - (ln u_t-1 - ln u_t-2))^2 * 100         (prefers an exponential)
+    //   kEntropy : 100 + sum p_t ln(p_t / a_t) with p_t = u_t / sum u, a the a priori distribution
+    // all of them are independent of the normalization of u, so that they are the same for the spectrum in counts
+    // and for the one normalized to the measured integral fitted by AliUnfolding
+    //
+
+    const Int_t n = p.fN;
+    const Double_t w = p.fWeight;
+    Double_t penalty = 0;
+
+    switch (p.fRegType)
+    {
+      case AliUnfolding::kNone:
+        break;
+
+      case AliUnfolding::kPol0:
+      case AliUnfolding::kPol1:
+      case AliUnfolding::kLog:
+      {
+        const Int_t nPoints = (p.fRegType == AliUnfolding::kPol0) ? 2 : 3;
+        const Double_t factor = (p.fRegType == AliUnfolding::kPol0) ? 0.01 : ((p.fRegType == AliUnfolding::kLog) ? 100 : 1);
+        for (Int_t t=nPoints-1; t<n; ++t)
+        {
+          // term factor * f^2 of the bins first to t, with the first and second derivatives of f
+          const Int_t first = t - nPoints + 1;
+          const Double_t* x = &u[first];
+          Double_t f = 0;
+          Double_t df[3] = { 0, 0, 0 };
+          Double_t d2f[3][3] = { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } };
+          if (p.fRegType == AliUnfolding::kPol0)
+          {
+            f = 1 - x[0] / x[1];
+            df[0] = -1 / x[1];
+            df[1] = x[0] / (x[1] * x[1]);
+            d2f[0][1] = d2f[1][0] = 1 / (x[1] * x[1]);
+            d2f[1][1] = -2 * x[0] / (x[1] * x[1] * x[1]);
+          }
+          else if (p.fRegType == AliUnfolding::kPol1)
+          {
+            f = (x[0] + x[2]) / x[1] - 2;
+            df[0] = df[2] = 1 / x[1];
+            df[1] = -(x[0] + x[2]) / (x[1] * x[1]);
+            d2f[0][1] = d2f[1][0] = d2f[1][2] = d2f[2][1] = -1 / (x[1] * x[1]);
+            d2f[1][1] = 2 * (x[0] + x[2]) / (x[1] * x[1] * x[1]);
+          }
+          else
+          {
+            f = TMath::Log(x[0]) - 2 * TMath::Log(x[1]) + TMath::Log(x[2]);
+            df[0] = 1 / x[0];
+            df[1] = -2 / x[1];
+            df[2] = 1 / x[2];
+            d2f[0][0] = -1 / (x[0] * x[0]);
+            d2f[1][1] = 2 / (x[1] * x[1]);
+            d2f[2][2] = -1 / (x[2] * x[2]);
+          }
+          penalty += factor * f * f;
+
+          if (grad)
+            for (Int_t k=0; k<nPoints; ++k)
+              (*grad)[first+k] += w * factor * 2 * f * df[k];
+          if (hess)
+            for (Int_t k=0; k<nPoints; ++k)
+              for (Int_t l=0; l<nPoints; ++l)
+                (*hess)[(first+k) * n + first+l] += w * factor * 2 * (df[k] * df[l] + f * d2f[k][l]);
+        }
+        break;
+      }
+
+      case AliUnfolding::kEntropy:
+      {
+        Double_t sum = 0;
+        for (Int_t t=0; t<n; ++t)
+          sum += u[t];
+        std::vector<Double_t> logRatio(n);
+        Double_t entropy = 0;
+        for (Int_t t=0; t<n; ++t)
+        {
+          logRatio[t] = TMath::Log(u[t] / sum / p.fPrior[t]);
+          entropy += u[t] / sum * logRatio[t];
+        }
+        penalty = 100 + entropy;
+
+        if (grad)
+          for (Int_t t=0; t<n; ++t)
+            (*grad)[t] += w * (logRatio[t] - entropy) / sum;
+        if (hess)
+          for (Int_t i=0; i<n; ++i)
+          {
+            (*hess)[i * n + i] += w / (u[i] * sum);
+            for (Int_t j=0; j<n; ++j)
+              (*hess)[i * n + j] -= w * (1 + logRatio[i] + logRatio[j] - 2 * entropy) / (sum * sum);
+          }
+        break;
+      }
+
+      default:
+        break;
+    }
+
+    return penalty;
+  }
+
+  //____________________________________________________________________
+  Double_t Chi2Measured(const Chi2Problem& p, const std::vector<Double_t>& u, std::vector<Double_t>* grad)
+  {
+    // measured part of the chi2; sets the gradient if requested
+
+    const Int_t n = p.fN;
+    Double_t chi2 = p.fC;
+    for (Int_t i=0; i<n; ++i)
+    {
+      Double_t hu = 0;
+      for (Int_t j=0; j<n; ++j)
+        hu += p.fH[i * n + j] * u[j];
+      chi2 += u[i] * (0.5 * hu - p.fB[i]);
+      if (grad)
+        (*grad)[i] = hu - p.fB[i];
+    }
+    return chi2;
+  }
+
+  //____________________________________________________________________
+  Bool_t Cholesky(std::vector<Double_t>& a, Int_t n)
+  {
+    // in place Cholesky decomposition a = L L^T of a symmetric n x n matrix (lower triangle); kFALSE if not positive definite
+
+    for (Int_t j=0; j<n; ++j)
+    {
+      Double_t diag = a[j * n + j];
+      for (Int_t k=0; k<j; ++k)
+        diag -= a[j * n + k] * a[j * n + k];
+      if (!(diag > 0))
+        return kFALSE;
+      diag = TMath::Sqrt(diag);
+      a[j * n + j] = diag;
+      for (Int_t i=j+1; i<n; ++i)
+      {
+        Double_t value = a[i * n + j];
+        for (Int_t k=0; k<j; ++k)
+          value -= a[i * n + k] * a[j * n + k];
+        a[i * n + j] = value / diag;
+      }
+    }
+    return kTRUE;
+  }
+
+  //____________________________________________________________________
+  void CholeskySolve(const std::vector<Double_t>& l, Int_t n, std::vector<Double_t>& x)
+  {
+    // solves L L^T x = b, b given in x
+
+    for (Int_t i=0; i<n; ++i)
+    {
+      for (Int_t k=0; k<i; ++k)
+        x[i] -= l[i * n + k] * x[k];
+      x[i] /= l[i * n + i];
+    }
+    for (Int_t i=n-1; i>=0; --i)
+    {
+      for (Int_t k=i+1; k<n; ++k)
+        x[i] -= l[k * n + i] * x[k];
+      x[i] /= l[i * n + i];
+    }
+  }
+
+  //____________________________________________________________________
+  Int_t Minimize(const Chi2Problem& p, std::vector<Double_t>& u, Chi2Output& out)
+  {
+    //
+    // damped Newton minimization (Levenberg-Marquardt) with the analytic gradient and Hessian,
+    // the unfolded values are kept >= fMinimum : bins at the bound with a positive gradient are fixed for the step.
+    // The errors are sqrt of the diagonal of 2 H^-1 at the minimum (as Minuit's for a chi2 function)
+    //
+
+    const Int_t n = p.fN;
+    const Int_t kMaxIterations = 1000;
+    const Double_t kTolerance = 1e-10;
+
+    for (Int_t t=0; t<n; ++t)
+      u[t] = TMath::Max(u[t], p.fMinimum);
+
+    std::vector<Double_t> grad(n), hess(n * n), step(n), trial(n), reduced;
+    std::vector<Int_t> free;
+    Double_t lambda = 1e-9;
+    Int_t status = 1;
+
+    Double_t value = Chi2Measured(p, u, &grad);
+    hess = p.fH;
+    value += p.fWeight * Penalty(p, u, &grad, &hess);
+
+    for (Int_t iteration=0; iteration<kMaxIterations; ++iteration)
+    {
+      free.clear();
+      for (Int_t t=0; t<n; ++t)
+        if (u[t] > p.fMinimum || grad[t] < 0)
+          free.push_back(t);
+      const Int_t nFree = free.size();
+
+      Double_t gradNorm = 0;
+      for (Int_t i=0; i<nFree; ++i)
+        gradNorm += grad[free[i]] * grad[free[i]];
+      if (nFree == 0 || gradNorm == 0)
+      {
+        status = 0;
+        break;
+      }
+
+      // Newton step on the free bins with the diagonal damped by (1 + lambda)
+      reduced.assign(nFree * nFree, 0.);
+      for (Int_t i=0; i<nFree; ++i)
+        for (Int_t j=0; j<nFree; ++j)
+          reduced[i * nFree + j] = hess[free[i] * n + free[j]];
+      for (Int_t i=0; i<nFree; ++i)
+        reduced[i * nFree + i] = TMath::Max(reduced[i * nFree + i], 0.) * (1 + lambda) + lambda * 1e-12;
+      if (!Cholesky(reduced, nFree))
+      {
+        lambda *= 10;
+        if (lambda > 1e12)
+          break;
+        continue;
+      }
+      step.resize(nFree);
+      for (Int_t i=0; i<nFree; ++i)
+        step[i] = -grad[free[i]];
+      CholeskySolve(reduced, nFree, step);
+
+      // projected step, halved until the chi2 decreases
+      Bool_t accepted = kFALSE;
+      Double_t trialValue = value;
+      for (Double_t alpha = 1; alpha > 1e-4; alpha *= 0.5)
+      {
+        trial = u;
+        for (Int_t i=0; i<nFree; ++i)
+          trial[free[i]] = TMath::Max(u[free[i]] + alpha * step[i], p.fMinimum);
+        trialValue = Chi2Measured(p, trial, 0) + p.fWeight * Penalty(p, trial, 0, 0);
+        if (trialValue < value)
+        {
+          accepted = kTRUE;
+          break;
+        }
+      }
+
+      if (!accepted)
+      {
+        // no decrease within the numerical precision : minimum reached
+        if (lambda > 1e6)
+        {
+          status = 0;
+          break;
+        }
+        lambda *= 10;
+        continue;
+      }
+
+      // converged if a (nearly) undamped step does not improve the chi2 any more
+      Bool_t converged = (lambda < 1e-6 && value - trialValue < kTolerance * (1 + TMath::Abs(value)));
+      u = trial;
+      value = Chi2Measured(p, u, &grad);
+      hess = p.fH;
+      value += p.fWeight * Penalty(p, u, &grad, &hess);
+      lambda = TMath::Max(lambda * 0.1, 1e-12);
+
+      if (converged)
+      {
+        status = 0;
+        break;
+      }
+    }
+
+    out.fResult = u;
+    out.fChi2 = Chi2Measured(p, u, 0);
+    out.fPenalty = Penalty(p, u, 0, 0);
+    out.fStatus = status;
+
+    // errors from the inverse of the Hessian, only from its diagonal if it is not positive definite
+    out.fError.assign(n, 0.);
+    reduced = hess;
+    if (Cholesky(reduced, n))
+    {
+      // (H^-1)_tt = sum_k (L^-1)_kt^2
+      std::vector<Double_t> column(n);
+      for (Int_t t=0; t<n; ++t)
+      {
+        Double_t variance = 0;
+        for (Int_t i=t; i<n; ++i)
+        {
+          Double_t value2 = (i == t) ? 1 : 0;
+          for (Int_t k=t; k<i; ++k)
+            value2 -= reduced[i * n + k] * column[k];
+          column[i] = value2 / reduced[i * n + i];
+          variance += column[i] * column[i];
+        }
+        out.fError[t] = TMath::Sqrt(2 * variance);
+      }
+    }
+    else
+    {
+      for (Int_t t=0; t<n; ++t)
+        if (hess[t * n + t] > 0)
+          out.fError[t] = TMath::Sqrt(2 / hess[t * n + t]);
+    }
+
+    return status;
+  }
+
+  //____________________________________________________________________
+  void FitRange(const Chi2Input* in, Int_t firstFit, Int_t lastFit, TRandom3* random, std::vector<Chi2Output>* out)
+  {
+    //
+    // fits firstFit to lastFit-1 : randomizes the inputs if the fit has a seed (Poisson, as in
+    // StatisticalUncertainty), builds the chi2 and minimizes it
+    //
+
+    const Int_t nT = in->fNTrue;
+    const Int_t nM = in->fNMeasured;
+    std::vector<Double_t> correlation, measured, error, u;
+    Chi2Problem problem;
+
+    for (Int_t iFit=firstFit; iFit<lastFit; ++iFit)
+    {
+      correlation = in->fCorrelation;
+      measured = in->fMeasured;
+      error = in->fError;
+
+      if (in->fSeed[iFit] != 0)
+      {
+        random->SetSeed(in->fSeed[iFit]);
+        if (in->fRandomizeResponse)
+          for (Int_t i=0; i<nT*nM; ++i)
+            correlation[i] = random->Poisson(correlation[i]);
+        if (in->fRandomizeMeasured)
+          for (Int_t m=0; m<nM; ++m)
+          {
+            measured[m] = random->Poisson(in->fMeasured[m]);
+            error[m] = TMath::Sqrt(measured[m]);
+          }
+      }
+
+      BuildProblem(*in, correlation, measured, error, problem);
+      problem.fWeight = in->fWeight[iFit];
+
+      if (in->fInitial.size() > 0)
+      {
+        u = in->fInitial;
+      }
+      else
+      {
+        u.assign(nT, 1.);
+        for (Int_t t=0; t<nT && t<nM; ++t)
+          if (in->fEfficiency[t] > 0)
+            u[t] = TMath::Max(measured[t] / in->fEfficiency[t], 1.);
+      }
+
+      // a priori distribution of kEntropy: the start values
+      Double_t sum = 0;
+      for (Int_t t=0; t<nT; ++t)
+        sum += TMath::Max(u[t], problem.fMinimum);
+      problem.fPrior.resize(nT);
+      for (Int_t t=0; t<nT; ++t)
+        problem.fPrior[t] = TMath::Max(u[t], problem.fMinimum) / sum;
+
+      Minimize(problem, u, (*out)[iFit]);
+    }
+  }
+}
+
 //____________________________________________________________________
 void AliMultiplicityCorrection::SetQualityRegions(Bool_t SPDStudy)
 {
@@ -98,7 +590,7 @@ void AliMultiplicityCorrection::SetQualityRegions(Bool_t SPDStudy)
 
 //____________________________________________________________________
 AliMultiplicityCorrection::AliMultiplicityCorrection() :
-  TNamed(), fCurrentESD(0), fCurrentCorrelation(0), fCurrentEfficiency(0), fLastBinLimit(0), fLastChi2MC(0), fLastChi2MCLimit(0), fLastChi2Residuals(0), fRatioAverage(0), fVtxBegin(0), fVtxEnd(0)
+  TNamed(), fCurrentESD(0), fCurrentCorrelation(0), fCurrentEfficiency(0), fLastBinLimit(0), fLastChi2MC(0), fLastChi2MCLimit(0), fLastChi2Residuals(0), fRatioAverage(0), fVtxBegin(0), fVtxEnd(0), fNThreads(1)
 {
   //
   // default constructor
@@ -163,7 +655,8 @@ AliMultiplicityCorrection::AliMultiplicityCorrection(const Char_t* name, const C
   fLastChi2Residuals(0),
   fRatioAverage(0),
   fVtxBegin(0),
-  fVtxEnd(0)
+  fVtxEnd(0),
+  fNThreads(1)
 {
   //
   // named constructor
@@ -909,6 +1402,17 @@ void AliMultiplicityCorrection::Calculate0Bin(Int_t inputRange, EventType eventT
   if (eventType == kTrVtx)
     return;
   
+  AliUnfolding::SetNotFoundEvents(GetNotFoundEvents(inputRange, eventType, zeroBinEvents));
+}
+
+//____________________________________________________________________
+Double_t AliMultiplicityCorrection::GetNotFoundEvents(Int_t inputRange, EventType eventType, Int_t zeroBinEvents)
+{
+  // number of triggered events without vertex for the 0 bin estimate, corrected for the vertex range
+
+  if (eventType == kTrVtx)
+    return 0;
+  
   Double_t fractionEventsInVertexRange = fMultiplicityESD[inputRange]->Integral(1, fMultiplicityESD[inputRange]->GetXaxis()->GetNbins()) / fMultiplicityESD[inputRange]->Integral(0, fMultiplicityESD[inputRange]->GetXaxis()->GetNbins() + 1);
   
   // difference of fraction that is inside the considered range between triggered events and events with vertex
@@ -920,7 +1424,7 @@ void AliMultiplicityCorrection::Calculate0Bin(Int_t inputRange, EventType eventT
   Printf("  Fraction in range: %.1f%%", fractionEventsInVertexRange * 100);
   Printf("  Difference Vtx Dist: %f", differenceVtxDist);
   
-  AliUnfolding::SetNotFoundEvents(zeroBinEvents * fractionEventsInVertexRange * differenceVtxDist);
+  return zeroBinEvents * fractionEventsInVertexRange * differenceVtxDist;
 }
 
 //____________________________________________________________________
@@ -1697,6 +2201,261 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
   return standardDeviation;
 }
 
+//____________________________________________________________________
+Int_t AliMultiplicityCorrection::ApplyChi2Fit(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, AliUnfolding::RegularizationType regType, Double_t regWeight, TH1* initialConditions)
+{
+  //
+  // correct spectrum with a regularized chi2 fit minimized with the analytic gradient and Hessian
+  // (instead of Minuit with numerical derivatives as in ApplyMinuitFit)
+  //
+  // chi2 = sum_m (y_m - sum_t A_mt u_t)^2 / e_m^2 + regWeight * penalty(u)
+  //   A_mt is the response matrix normalized to the efficiency, y and e the measured spectrum and its errors
+  //   (empty bins have an error of 1); for zeroBinEvents > 0 the events without vertex are one more measurement
+  //   of sum_t (1 - efficiency_t) u_t, see Calculate0Bin
+  //   penalty: kNone, kPol0, kPol1, kLog or kEntropy, see Penalty() at the top of this file (kEntropy with the
+  //   start values as a priori distribution)
+  //   The chi2 is the one of AliUnfolding::kChi2Minimization: normalizing the measured spectrum and its errors
+  //   to the integral (as AliUnfolding does) does not change the measured part, and the penalties are the ones of
+  //   AliUnfolding and independent of the normalization. regWeight is therefore the weight given to
+  //   AliUnfolding::SetChi2Regularization for ApplyMinuitFit, see CompareChi2Fit in
+  //   PWGUD/selectors/multiplicity/correct.C
+  //
+  // the errors are taken from the covariance matrix 2 H^-1 at the minimum
+  // returns 0 if the minimization converged
+  //
+
+  Int_t correlationID = inputRange + ((fullPhaseSpace == kFALSE) ? 0 : 4);
+
+  TH1* result = 0;
+  Double_t chi2 = 0;
+  Double_t penalty = 0;
+  Int_t status = -1;
+  if (Chi2Unfold(inputRange, fullPhaseSpace, eventType, zeroBinEvents, regType, 1, &regWeight, kFALSE, kFALSE, initialConditions, &result, &chi2, &penalty, &status) < 0)
+    return -1;
+
+  Printf("AliMultiplicityCorrection::ApplyChi2Fit: chi2 = %f, penalty = %e (weight %e)", chi2, penalty, regWeight);
+
+  for (Int_t i=1; i<=fMultiplicityESDCorrected[correlationID]->GetNbinsX(); ++i)
+  {
+    fMultiplicityESDCorrected[correlationID]->SetBinContent(i, result->GetBinContent(i));
+    fMultiplicityESDCorrected[correlationID]->SetBinError(i, result->GetBinError(i));
+  }
+  delete result;
+
+  return status;
+}
+
+//____________________________________________________________________
+TH1* AliMultiplicityCorrection::Chi2StatisticalUncertainty(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, AliUnfolding::RegularizationType regType, Double_t regWeight, Bool_t randomizeMeasured, Bool_t randomizeResponse, Int_t nIterations)
+{
+  //
+  // same as StatisticalUncertainty for the chi2 fit of ApplyChi2Fit : unfolds the spectrum with the default
+  // inputs and nIterations-1 randomized ones (Poisson in each cell of the response matrix and/or of the measured
+  // spectrum). The fits run on SetNThreads() threads
+  //
+  // fills fMultiplicityESDCorrected with the normalized result and the standard deviation of the randomized results,
+  // returns the relative standard deviation
+  //
+
+  Int_t correlationID = inputRange + ((fullPhaseSpace == kFALSE) ? 0 : 4);
+
+  if (nIterations < 2)
+    return 0;
+
+  std::vector<Double_t> weights(nIterations, regWeight);
+  std::vector<TH1*> results(nIterations);
+  std::vector<Int_t> status(nIterations);
+  if (Chi2Unfold(inputRange, fullPhaseSpace, eventType, zeroBinEvents, regType, nIterations, &weights[0], randomizeMeasured, randomizeResponse, 0, &results[0], 0, 0, &status[0]) < 0)
+    return 0;
+
+  // the failed fits are not used (the Minuit based StatisticalUncertainty repeats them)
+  std::vector<TH1*> converged;
+  for (Int_t n=0; n<nIterations; ++n)
+  {
+    if (status[n] != 0 || (n > 0 && status[0] != 0))
+    {
+      delete results[n];
+      continue;
+    }
+    results[n]->Scale(1.0 / results[n]->Integral());
+    converged.push_back(results[n]);
+  }
+  if (status[0] != 0 || converged.size() < 2)
+  {
+    AliError(Form("Only %d of %d fits converged", (Int_t) converged.size(), nIterations));
+    for (UInt_t n=0; n<converged.size(); ++n)
+      delete converged[n];
+    return 0;
+  }
+  if ((Int_t) converged.size() < nIterations)
+    Printf("WARNING: %d of %d randomized fits did not converge", nIterations - (Int_t) converged.size(), nIterations - 1);
+
+  TH1* standardDeviation = CalculateStdDev(&converged[0], converged.size());
+
+  for (Int_t i=1; i<=fMultiplicityESDCorrected[correlationID]->GetNbinsX(); ++i)
+  {
+    fMultiplicityESDCorrected[correlationID]->SetBinContent(i, converged[0]->GetBinContent(i));
+    fMultiplicityESDCorrected[correlationID]->SetBinError(i, standardDeviation->GetBinContent(i) * converged[0]->GetBinContent(i));
+  }
+
+  for (UInt_t n=0; n<converged.size(); ++n)
+    delete converged[n];
+
+  return standardDeviation;
+}
+
+//____________________________________________________________________
+Int_t AliMultiplicityCorrection::ScanChi2Regularization(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, AliUnfolding::RegularizationType regType, Int_t nWeights, const Double_t* weights, TH1** results, Double_t* chi2, Double_t* penalty, Int_t* status)
+{
+  //
+  // unfolds the spectrum with ApplyChi2Fit for each of the nWeights regularization weights, on SetNThreads() threads
+  // results[i] is the unfolded spectrum for weights[i] (owned by the caller); chi2[i], penalty[i] and status[i]
+  // (optional) are the chi2 of the measured spectrum and the regularization term (without weight) at the minimum,
+  // e.g. for the L-curve, and the return code of the fit (0: converged)
+  // returns the number of converged fits
+  //
+
+  if (nWeights < 1)
+    return 0;
+
+  return Chi2Unfold(inputRange, fullPhaseSpace, eventType, zeroBinEvents, regType, nWeights, weights, kFALSE, kFALSE, 0, results, chi2, penalty, status);
+}
+
+//____________________________________________________________________
+Int_t AliMultiplicityCorrection::Chi2Unfold(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, AliUnfolding::RegularizationType regType, Int_t nFits, const Double_t* weights, Bool_t randomizeMeasured, Bool_t randomizeResponse, const TH1* initialConditions, TH1** results, Double_t* chi2, Double_t* penalty, Int_t* status)
+{
+  //
+  // performs nFits chi2 fits (see ApplyChi2Fit) with the regularization weights <weights>: the first on the default
+  // inputs, the others on randomized inputs if randomizeMeasured or randomizeResponse
+  // the fits are shared among fNThreads threads; each randomized fit uses its own random seed drawn from gRandom,
+  // so that the result does not depend on the number of threads
+  //
+  // results[i] (owned by the caller), chi2[i], penalty[i] and status[i] (optional) as in ScanChi2Regularization
+  // returns the number of converged fits, -1 if the fit cannot be done
+  //
+
+  if (regType != AliUnfolding::kNone && regType != AliUnfolding::kPol0 && regType != AliUnfolding::kPol1 && regType != AliUnfolding::kLog && regType != AliUnfolding::kEntropy)
+  {
+    AliError(Form("Regularization type %d not supported by the analytic chi2 fit", (Int_t) regType));
+    return -1;
+  }
+
+  Int_t correlationID = inputRange + ((fullPhaseSpace == kFALSE) ? 0 : 4);
+
+  // use here only vtx efficiency (to MB sample) which is always needed if we use the 0 bin
+  SetupCurrentHists(inputRange, fullPhaseSpace, (eventType == kTrVtx) ? kTrVtx : kMB);
+
+  Chi2Input in;
+  in.fNMeasured = fCurrentCorrelation->GetNbinsY();
+  in.fNTrue = 0;
+  in.fRegType = regType;
+  in.fRandomizeMeasured = randomizeMeasured;
+  in.fRandomizeResponse = randomizeResponse;
+
+  // unfolded bins: up to the last one with entries in the response matrix
+  for (Int_t t=1; t<=fCurrentCorrelation->GetNbinsX() && t<=fMultiplicityESDCorrected[correlationID]->GetNbinsX(); ++t)
+    if (fCurrentCorrelation->Integral(t, t, 1, in.fNMeasured) > 0 && fCurrentEfficiency->GetBinContent(t) > 0)
+      in.fNTrue = t;
+  if (in.fNTrue == 0 || fCurrentESD->Integral(1, in.fNMeasured) <= 0)
+  {
+    AliError("Empty response matrix or measured spectrum");
+    return -1;
+  }
+
+  in.fCorrelation.resize(in.fNTrue * in.fNMeasured);
+  for (Int_t t=0; t<in.fNTrue; ++t)
+  {
+    in.fEfficiency.push_back(fCurrentEfficiency->GetBinContent(t+1));
+    for (Int_t m=0; m<in.fNMeasured; ++m)
+      in.fCorrelation[t * in.fNMeasured + m] = fCurrentCorrelation->GetBinContent(t+1, m+1);
+  }
+  for (Int_t m=0; m<in.fNMeasured; ++m)
+  {
+    in.fMeasured.push_back(fCurrentESD->GetBinContent(m+1));
+    in.fError.push_back(fCurrentESD->GetBinError(m+1));
+  }
+
+  in.fNotFound = (zeroBinEvents > 0) ? GetNotFoundEvents(inputRange, eventType, zeroBinEvents) : 0;
+
+  // initial conditions are scaled to the measured spectrum
+  if (initialConditions && initialConditions->Integral(1, in.fNTrue) > 0)
+  {
+    Double_t scale = fCurrentESD->Integral(1, in.fNMeasured) / initialConditions->Integral(1, in.fNTrue);
+    for (Int_t t=0; t<in.fNTrue; ++t)
+      in.fInitial.push_back(initialConditions->GetBinContent(t+1) * scale);
+  }
+
+  // seed 0 would mean a time-dependent seed in TRandom3
+  for (Int_t n=0; n<nFits; ++n)
+  {
+    in.fWeight.push_back(weights[n]);
+    in.fSeed.push_back((n > 0 && (randomizeMeasured || randomizeResponse)) ? 1 + gRandom->Integer(kMaxUInt - 1) : 0);
+  }
+
+  Int_t nThreads = fNThreads;
+#if __cplusplus >= 201103L
+  if (nThreads <= 0)
+    nThreads = std::thread::hardware_concurrency();
+#else
+  nThreads = 1;
+#endif
+  if (nThreads < 1)
+    nThreads = 1;
+  if (nThreads > nFits)
+    nThreads = nFits;
+
+  Printf("AliMultiplicityCorrection::Chi2Unfold: %d fit(s) of %d bins from %d measured bins on %d thread(s)", nFits, in.fNTrue, in.fNMeasured, nThreads);
+
+  // the random generators are created here, the threads do not create any ROOT object
+  std::vector<TRandom3*> random(nThreads);
+  for (Int_t i=0; i<nThreads; ++i)
+    random[i] = new TRandom3(1);
+  std::vector<Chi2Output> out(nFits);
+#if __cplusplus >= 201103L
+  std::vector<std::thread> threads;
+  for (Int_t i=1; i<nThreads; ++i)
+    threads.push_back(std::thread(FitRange, &in, i * nFits / nThreads, (i + 1) * nFits / nThreads, random[i], &out));
+#endif
+  FitRange(&in, 0, nFits / nThreads, random[0], &out);
+#if __cplusplus >= 201103L
+  for (UInt_t i=0; i<threads.size(); ++i)
+    threads[i].join();
+#endif
+  for (Int_t i=0; i<nThreads; ++i)
+    delete random[i];
+
+  // correct for the trigger bias if requested
+  TH1* triggerEff = (eventType > kMB) ? GetTriggerEfficiency(inputRange, eventType) : 0;
+
+  Int_t nConverged = 0;
+  for (Int_t n=0; n<nFits; ++n)
+  {
+    if (chi2)
+      chi2[n] = out[n].fChi2;
+    if (penalty)
+      penalty[n] = out[n].fPenalty;
+    if (status)
+      status[n] = out[n].fStatus;
+
+    if (out[n].fStatus == 0)
+      ++nConverged;
+    else
+      Printf("WARNING: chi2 fit %d did not converge", n);
+
+    results[n] = (TH1*) fMultiplicityESDCorrected[correlationID]->Clone(Form("%s_chi2_%d", fMultiplicityESDCorrected[correlationID]->GetName(), n));
+    results[n]->Reset();
+    for (Int_t t=0; t<in.fNTrue; ++t)
+    {
+      Double_t eff = (triggerEff && triggerEff->GetBinContent(t+1) > 0) ? triggerEff->GetBinContent(t+1) : 1;
+      results[n]->SetBinContent(t+1, out[n].fResult[t] / eff);
+      results[n]->SetBinError(t+1, out[n].fError[t] / eff);
+    }
+  }
+  delete triggerEff;
+
+  return nConverged;
+}
+
 //____________________________________________________________________
 void AliMultiplicityCorrection::ApplyBayesianMethod(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Float_t regPar, Int_t nIterations, TH1* initialConditions, Int_t determineError)
 {
@@ -64,6 +64,11 @@ class AliMultiplicityCorrection : public TNamed {
     static TH1* CalculateStdDev(TH1** results, Int_t max);
     TH1* StatisticalUncertainty(AliUnfolding::MethodType methodType, Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, Bool_t randomizeMeasured, Bool_t randomizeResponse, const TH1* compareTo = 0);
 
+    Int_t ApplyChi2Fit(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, AliUnfolding::RegularizationType regType, Double_t regWeight, TH1* initialConditions = 0);
+    TH1* Chi2StatisticalUncertainty(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, AliUnfolding::RegularizationType regType, Double_t regWeight, Bool_t randomizeMeasured, Bool_t randomizeResponse, Int_t nIterations = 20);
+    Int_t ScanChi2Regularization(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, AliUnfolding::RegularizationType regType, Int_t nWeights, const Double_t* weights, TH1** results, Double_t* chi2 = 0, Double_t* penalty = 0, Int_t* status = 0);
+    void SetNThreads(Int_t n = 0) { fNThreads = n; } // threads for Chi2StatisticalUncertainty and ScanChi2Regularization, 0 = all available cores
+
     Int_t ApplyNBDFit(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType);
     void ApplyGaussianMethod(Int_t inputRange, Bool_t fullPhaseSpace);
 
@@ -119,6 +124,8 @@ class AliMultiplicityCorrection : public TNamed {
 
   protected:
     void SetupCurrentHists(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType);
+    Double_t GetNotFoundEvents(Int_t inputRange, EventType eventType, Int_t zeroBinEvents);
+    Int_t Chi2Unfold(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, AliUnfolding::RegularizationType regType, Int_t nFits, const Double_t* weights, Bool_t randomizeMeasured, Bool_t randomizeResponse, const TH1* initialConditions, TH1** results, Double_t* chi2 = 0, Double_t* penalty = 0, Int_t* status = 0);
 
     Float_t BayesCovarianceDerivate(Float_t matrixM[251][251], const TH2* hResponse, Int_t k, Int_t i, Int_t r, Int_t u);
     
@@ -147,6 +154,8 @@ class AliMultiplicityCorrection : public TNamed {
     
     Int_t fVtxBegin;            //! vertex range for analysis
     Int_t fVtxEnd;              //! vertex range for analysis
+
+    Int_t fNThreads;            //! number of threads for the chi2 fits of Chi2StatisticalUncertainty and ScanChi2Regularization (0 = all available cores)
     
     static Double_t fgVtxRangeBegin[kESDHists]; //! begin of allowed vertex range for this eta bin
     static Double_t fgVtxRangeEnd[kESDHists];   //! end of allowed vertex range for this eta bin
@@ -159,7 +168,7 @@ class AliMultiplicityCorrection : public TNamed {
     AliMultiplicityCorrection(const AliMultiplicityCorrection&);
     AliMultiplicityCorrection& operator=(const AliMultiplicityCorrection&);
 
-  ClassDef(AliMultiplicityCorrection, 7);
+  ClassDef(AliMultiplicityCorrection, 8);
 };
 
 #endif